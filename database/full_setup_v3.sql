@@ -39,7 +39,13 @@ create table if not exists telemetry (
   temperature numeric,
   alarm integer,
   mac_address text,
-  device_type integer
+  device_type integer,
+
+  -- Aralik istatistikleri (son gonderimden bu yana)
+  min_battery_voltage numeric,
+  max_battery_voltage numeric,
+  max_pv_power numeric,
+  interval_stats jsonb
 );
 
 -- PERMISSIONS (Önemli: API erişimi için)
@@ -39,7 +39,13 @@ create table if not exists telemetry (
   temperature numeric,
   alarm integer,
   mac_address text, -- To distinguish devices (MPPT vs Shunt)
-  device_type integer -- 1: Solar, 2: Battery, 3: Inverter, etc.
+  device_type integer, -- 1: Solar, 2: Battery, 3: Inverter, etc.
+
+  -- Aralik istatistikleri (son gonderimden bu yana)
+  min_battery_voltage numeric,
+  max_battery_voltage numeric,
+  max_pv_power numeric,
+  interval_stats jsonb
 );
 
 -- ENABLE RLS
@@ -50,7 +50,12 @@ BEGIN
             consumed_ah,
             remaining_mins,
             aux_voltage,
-            load_state
+            load_state,
+            min_battery_voltage,
+            max_battery_voltage,
+            max_pv_power,
+            interval_stats,
+            created_at
         ) VALUES (
             v_boat_id,
             item->>'mac_address',
@@ -71,7 +76,16 @@ BEGIN
             (item->>'consumed_ah')::numeric,
             (item->>'remaining_mins')::numeric,
             (item->>'aux_voltage')::numeric,
-            (item->>'load_state')::int
+            (item->>'load_state')::int,
+            -- Aralık istatistikleri (update_schema_v3.sql); eski firmware göndermez
+            (item->>'min_battery_voltage')::numeric,
+            (item->>'max_battery_voltage')::numeric,
+            (item->>'max_pv_power')::numeric,
+            item->'interval_stats',
+            -- Flash kuyruğundan gecikmeli gelen ölçüm: age_s saniye önce alındı
+            CASE WHEN item ? 'age_s'
+                 THEN NOW() - make_interval(secs => (item->>'age_s')::numeric)
+                 ELSE NOW() END
         );
         
         v_count := v_count + 1;
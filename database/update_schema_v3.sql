@@ -0,0 +1,5 @@
+-- Aralik istatistikleri (firmware TELEMETRY_FLAG_SAMPLES): son gonderimden bu yana
+ALTER TABLE telemetry ADD COLUMN IF NOT EXISTS min_battery_voltage numeric;
+ALTER TABLE telemetry ADD COLUMN IF NOT EXISTS max_battery_voltage numeric;
+ALTER TABLE telemetry ADD COLUMN IF NOT EXISTS max_pv_power numeric;
+ALTER TABLE telemetry ADD COLUMN IF NOT EXISTS interval_stats jsonb;
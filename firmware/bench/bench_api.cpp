@@ -0,0 +1,91 @@
+// /api/data: DeviceJsonStream chunked ciktisi. Kucuk ve buyuk parcalarla
+// ayni JSON uretildigi, cihazlarin MAC sirasiyla ve eksiksiz yazildigi,
+// ?fields= / ?mac= filtreleri ve istek basina bellek kontrol edilir.
+
+#include <Arduino.h>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include "DeviceJsonStream.h"
+
+static std::string drain(DeviceJsonStream& stream, size_t chunk, size_t& calls) {
+    std::string out;
+    uint8_t buf[1460];
+    calls = 0;
+    for (;;) {
+        size_t n = stream.fill(buf, chunk);
+        calls++;
+        if (n == 0) break;
+        if (n > chunk) return "<overflow>";
+        out.append((const char*)buf, n);
+    }
+    return out;
+}
+
+static size_t countChar(const std::string& s, char c) {
+    size_t n = 0;
+    for (char x : s) n += (x == c);
+    return n;
+}
+
+bool runApiCase(const VictronBLE& scanner, const VictronSnapshot& snapshot) {
+    size_t bigCalls, smallCalls;
+    DeviceJsonStream big(scanner);
+    std::string full = drain(big, 1460, bigCalls);
+    DeviceJsonStream small(scanner);
+    std::string pieces = drain(small, 7, smallCalls);
+    if (full != pieces || full.size() < 2 || full.front() != '[' || full.back() != ']') {
+        printf("HATA: /api/data parcali cikti tutarsiz\n%s\n%s\n", full.c_str(), pieces.c_str());
+        return false;
+    }
+    if (countChar(full, '{') != snapshot.count) {
+        printf("HATA: /api/data %zu cihaz yazdi, snapshot %zu\n", countChar(full, '{'), snapshot.count);
+        return false;
+    }
+
+    // MAC sirasi: getDeviceAfter tum cihazlari artan sirada gezer
+    uint64_t last = 0;
+    size_t seen = 0;
+    VictronData data;
+    while (scanner.getDeviceAfter(last, data)) {
+        if (data.mac <= last) {
+            printf("HATA: getDeviceAfter sirasi bozuk\n");
+            return false;
+        }
+        last = data.mac;
+        seen++;
+    }
+    if (seen != snapshot.count) {
+        printf("HATA: getDeviceAfter %zu cihaz, snapshot %zu\n", seen, snapshot.count);
+        return false;
+    }
+
+    // ?fields=mac,voltage&mac=<ilk cihaz>
+    uint32_t fields = 0;
+    if (!parseDeviceJsonFields("mac,voltage", fields) || parseDeviceJsonFields("mac,bogus", fields)) {
+        printf("HATA: fields ayristirma\n");
+        return false;
+    }
+    char mac[18];
+    formatMacAddress(snapshot.devices[0].mac, mac);
+    DeviceJsonStream filtered(scanner, fields);
+    if (!filtered.setMacFilter(mac) || filtered.setMacFilter("zz:00")) {
+        printf("HATA: mac filtresi ayristirma\n");
+        return false;
+    }
+    filtered.setMacFilter(mac);
+    size_t calls;
+    std::string one = drain(filtered, 64, calls);
+    std::string expectPrefix = std::string("[{\"mac\":\"") + mac + "\",\"voltage\":";
+    if (one.compare(0, expectPrefix.size(), expectPrefix) != 0 || countChar(one, ',') != 1) {
+        printf("HATA: filtreli cikti: %s\n", one.c_str());
+        return false;
+    }
+
+    size_t legacyPeak = sizeof(VictronSnapshot) + 4096 + full.size();
+    printf("/api/data: %zu cihaz, %zu byte JSON (%zu parca @1460, %zu parca @7); "
+           "istek basina %zu byte (eski: snapshot + 4 KB dokuman + String ~%zu byte); "
+           "filtreli %zu byte\n",
+           snapshot.count, full.size(), bigCalls, smallCalls, sizeof(DeviceJsonStream), legacyPeak, one.size());
+    return true;
+}
@@ -0,0 +1,97 @@
+// Kritik degisim karari: eski sabit esikler (lastSent* map'leri) ile
+// ChangeDetector'in (olu bant + histerezis) gurultulu olcumde tetikledigi
+// gonderim sayisi. Gercek bir basamak degisimi yine de yakalanmali.
+
+#include <Arduino.h>
+#include <stdio.h>
+#include <math.h>
+#include "VictronBLE.h"
+#include "ChangeDetector.h"
+
+// Deterministik gurultu (xorshift32), -1..1
+static uint32_t noiseState = 0x12345678;
+static float noise() {
+    noiseState ^= noiseState << 13;
+    noiseState ^= noiseState >> 17;
+    noiseState ^= noiseState << 5;
+    return (float)(noiseState % 20001) / 10000.0f - 1.0f;
+}
+
+bool runChangeCase() {
+    const unsigned long CHECK_MS = 5000;      // TELEMETRY_MIN_INTERVAL
+    const unsigned long HEARTBEAT_MS = 60000; // TELEMETRY_INTERVAL
+    const unsigned long DURATION_MS = 4UL * 3600 * 1000;
+    const unsigned long STEP_AT_MS = 2UL * 3600 * 1000 + 20000; // Sarj basladi (heartbeat arasinda): +0.5V, +300W
+
+    VictronData d;
+    d.mac = 0xAABBCCDDEE01ULL;
+    d.type = SOLAR_CHARGER;
+    d.soc = 0.0f;
+    d.alarm = 0;
+    d.deviceState = 3;
+
+    ChangeDetector detector;
+    float oldVoltage = 0.0f, oldPower = 0.0f, oldSoc = 0.0f;
+    int oldAlarm = 0;
+    unsigned long oldLastSend = 0, newLastSend = 0;
+    int oldUploads = 0, newUploads = 0;
+    long newStepDelayMs = -1, oldStepDelayMs = -1;
+
+    for (unsigned long now = CHECK_MS; now <= DURATION_MS; now += CHECK_MS) {
+        bool charging = now >= STEP_AT_MS;
+        // Voltaj: +-0.12V gurultu, %3 ihtimalle 0.25V tepe; guc: +-35W, %3 ihtimalle 70W tepe
+        float spike = (noiseState % 100) < 3 ? 1.0f : 0.0f;
+        d.voltage = (charging ? 13.1f : 12.6f) + noise() * 0.12f + spike * 0.25f;
+        d.power = (charging ? 500.0f : 200.0f) + noise() * 35.0f + spike * 70.0f;
+        d.current = d.power / d.voltage;
+
+        // Eski mantik: son gonderimle fark esigi astiysa hemen gonder
+        bool oldHeartbeat = now - oldLastSend > HEARTBEAT_MS;
+        bool oldChanged = fabsf(d.voltage - oldVoltage) >= 0.2f || fabsf(d.soc - oldSoc) >= 1.0f ||
+                          d.alarm != oldAlarm || fabsf(d.power - oldPower) >= 50.0f;
+        if (oldHeartbeat || oldChanged) {
+            if (!oldHeartbeat) oldUploads++;
+            if (charging && oldStepDelayMs < 0) oldStepDelayMs = (long)(now - STEP_AT_MS);
+            oldVoltage = d.voltage;
+            oldPower = d.power;
+            oldSoc = d.soc;
+            oldAlarm = d.alarm;
+            oldLastSend = now;
+        }
+
+        bool newHeartbeat = now - newLastSend > HEARTBEAT_MS;
+        bool newChanged = !newHeartbeat && detector.check(d, d.power, now);
+        if (newHeartbeat || newChanged) {
+            if (newChanged) newUploads++;
+            if (charging && newStepDelayMs < 0) newStepDelayMs = (long)(now - STEP_AT_MS);
+            detector.commit(d, d.power, now);
+            newLastSend = now;
+        }
+    }
+
+    printf("degisim tespiti (4 saat, 5 sn kontrol): eski esikler %d, olu bant %d heartbeat disi gonderim; "
+           "basamak gecikmesi %ld / %ld ms\n",
+           oldUploads, newUploads, oldStepDelayMs, newStepDelayMs);
+
+    if (newStepDelayMs < 0 || newStepDelayMs > (long)(2 * CHECK_MS)) {
+        printf("HATA: basamak degisimi zamaninda yakalanmadi\n");
+        return false;
+    }
+    if (newUploads >= oldUploads) {
+        printf("HATA: olu bant gurultu kaynakli gonderimi azaltmadi\n");
+        return false;
+    }
+
+    // Ayrik alan: alarm aninda gider; cihaz ayarindan bant
+    d.alarm = 1;
+    if (!detector.check(d, d.power, DURATION_MS + CHECK_MS)) {
+        printf("HATA: alarm degisimi aninda yakalanmadi\n");
+        return false;
+    }
+    if (!detector.setBand(d.mac, "voltage", 0.05f) || detector.setBand(d.mac, "yok", 1.0f) ||
+        detector.setBand(d.mac, "power", -1.0f)) {
+        printf("HATA: cihaz esigi ayari\n");
+        return false;
+    }
+    return true;
+}
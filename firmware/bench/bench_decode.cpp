@@ -0,0 +1,346 @@
+// VictronBLE decode hattı için host benchmark'ı ([env:native]).
+//
+// Çalıştırma:
+//   pio run -e native && .pio/build/native/program [iterasyon]
+//
+// Önce golden vektörlerin doğru çözüldüğü ve uplink kodlamalarının geri
+// açılabildiği doğrulanır, sonra her readout
+// tipi için onResult (kuyruğa yazma) -> update (decryptData ->
+// parseDecryptedData) hattı ve ayrıca sadece decryptData ölçülür.
+
+#include <Arduino.h>
+#include <NimBLEDevice.h>
+#include <stdio.h>
+#include <math.h>
+#include <chrono>
+#include <string>
+#include <vector>
+#include "VictronBLE.h"
+
+// Emulator ve simulator ile ayni test anahtari
+static const char* GOLDEN_KEY = "0102030405060708090a0b0c0d0e0f10";
+
+// Victron manufacturer data: E1 02 | 10, Len, ModelL, ModelH, Type, IV_L, IV_H, KeyCheck | sifreli veri
+// Sifreli kisim openssl ile uretildi:
+//   openssl enc -aes-128-ctr -K <GOLDEN_KEY> -iv <IV_L><IV_H>000...0
+
+// MPPT (0x01): Bulk, 13.45V, 12.3A, 180W, 0.85kWh, yuk akimi yok (0x1FF)
+static const uint8_t GOLDEN_MPPT[] = {
+    0xE1, 0x02, 0x10, 0x02, 0x60, 0xA0, 0x01, 0x34, 0x12, 0x01,
+    0xec, 0x19, 0x24, 0xfd, 0xec, 0x46, 0x1d, 0x42, 0xf1, 0xcf, 0x0a, 0x24,
+    0x3a,
+};
+
+// SmartShunt (0x02): 600dk, 12.85V, -5.200A, -23.4Ah, SOC %85.5
+static const uint8_t GOLDEN_SHUNT[] = {
+    0xE1, 0x02, 0x10, 0x02, 0x89, 0xA3, 0x02, 0x78, 0x56, 0x01,
+    0xb8, 0xa3, 0x84, 0x3b, 0x18, 0x13, 0x2c, 0x3d, 0x25, 0xed, 0x98, 0xd0,
+    0xe6, 0x9a, 0xfc, 0x2b,
+};
+
+// Phoenix Inverter (0x03): Inverting, 12.60V, 350VA, 230.00V AC, 1.5A AC
+static const uint8_t GOLDEN_INVERTER[] = {
+    0xE1, 0x02, 0x10, 0x02, 0x31, 0xA2, 0x03, 0xbc, 0x9a, 0x01,
+    0x31, 0x13, 0xf0, 0x63, 0xdf, 0xc4, 0x55, 0x17, 0xe2, 0xb5, 0x88,
+};
+
+// Tekne uzerindeki tipik filo: 8 kayitli cihaz, reklamlar sirayla gelir
+static const int FLEET_SIZE = 8;
+
+// decryptData private; sadece kripto maliyetini ayri olcmek icin
+struct VictronBenchAccess {
+    static bool decrypt(VictronBLE& scanner, uint64_t mac, const uint8_t* payload, size_t len, uint8_t* out) {
+        VictronDeviceEntry* entry = scanner.devices.find(mac);
+        return entry != nullptr && scanner.decryptData(entry->key, payload, len, out);
+    }
+    static void publishRxStats(VictronBLE& scanner) { scanner.publishRxStats(); }
+};
+
+// bench_metrics.cpp: alim istatistigini saniye beklemeden yayinlar
+void benchPublishRxStats(VictronBLE& scanner) {
+    VictronBenchAccess::publishRxStats(scanner);
+}
+
+// bench_telemetry.cpp
+bool runTelemetryCase(const VictronSnapshot& snapshot, long iterations);
+bool runQueueCase(const VictronSnapshot& snapshot);
+// bench_change.cpp
+bool runChangeCase();
+// bench_display.cpp
+bool runDisplayCase();
+// bench_api.cpp
+bool runApiCase(const VictronBLE& scanner, const VictronSnapshot& snapshot);
+// bench_live.cpp
+bool runLiveCase(const VictronSnapshot& snapshot);
+// bench_scan.cpp
+bool runScanCase();
+// bench_reload.cpp
+bool runReloadCase(const char* goldenKey, const uint8_t* advert, size_t advertLen);
+// bench_metrics.cpp
+bool runMetricsCase(const char* goldenKey, const uint8_t* advert, size_t advertLen);
+
+struct BenchCase {
+    const char* name;
+    const uint8_t* advert;
+    size_t len;
+};
+
+static NimBLEAddress fleetAddress(int idx) {
+    return NimBLEAddress(0xD05A1E000000ULL | (uint64_t)idx);
+}
+
+static bool near(float a, float b) {
+    return fabsf(a - b) < 0.001f;
+}
+
+static bool checkGolden(VictronBLE& scanner) {
+    NimBLEAdvertisedDevice mppt(fleetAddress(0), std::string((const char*)GOLDEN_MPPT, sizeof(GOLDEN_MPPT)));
+    NimBLEAdvertisedDevice shunt(fleetAddress(1), std::string((const char*)GOLDEN_SHUNT, sizeof(GOLDEN_SHUNT)));
+    NimBLEAdvertisedDevice inverter(fleetAddress(2), std::string((const char*)GOLDEN_INVERTER, sizeof(GOLDEN_INVERTER)));
+    scanner.onResult(&mppt);
+    scanner.onResult(&shunt);
+    scanner.onResult(&inverter);
+    scanner.update(); // Kuyrugu coz
+
+    static VictronSnapshot snapshot;
+    scanner.getSnapshot(snapshot);
+    bool ok = true;
+
+    auto findDevice = [&](uint64_t mac) -> const VictronData* {
+        for (size_t i = 0; i < snapshot.count; i++) {
+            if (snapshot.devices[i].mac == mac) return &snapshot.devices[i];
+        }
+        return nullptr;
+    };
+
+    const VictronData* found = findDevice((uint64_t)fleetAddress(0));
+    if (found == nullptr) {
+        printf("HATA: MPPT golden vektoru cozulemedi (%s)\n", scanner.lastError);
+        ok = false;
+    } else {
+        const VictronData& d = *found;
+        if (d.type != SOLAR_CHARGER || d.deviceState != 3 || d.alarm != 0 ||
+            !near(d.voltage, 13.45f) || !near(d.current, 12.3f) || !near(d.pvPower, 180.0f) ||
+            !near(d.yieldToday, 0.85f) || !near(d.loadCurrent, -1.0f) || d.loadState != 0) {
+            printf("HATA: MPPT golden degerleri uyusmuyor: V=%.2f I=%.1f PV=%.0f Y=%.2f\n",
+                   d.voltage, d.current, d.pvPower, d.yieldToday);
+            ok = false;
+        }
+    }
+
+    found = findDevice((uint64_t)fleetAddress(1));
+    if (found == nullptr) {
+        printf("HATA: SmartShunt golden vektoru cozulemedi (%s)\n", scanner.lastError);
+        ok = false;
+    } else {
+        const VictronData& d = *found;
+        if (d.type != BATTERY_MONITOR || d.remainingMins != 600 || d.alarm != 0 ||
+            !near(d.voltage, 12.85f) || !near(d.current, -5.2f) ||
+            !near(d.consumedAh, -23.4f) || !near(d.soc, 85.5f) || d.modelId != 0xA389 ||
+            d.auxInputType != 0) {
+            printf("HATA: SmartShunt golden degerleri uyusmuyor: V=%.2f I=%.3f Ah=%.1f SOC=%.1f\n",
+                   d.voltage, d.current, d.consumedAh, d.soc);
+            ok = false;
+        }
+    }
+
+    found = findDevice((uint64_t)fleetAddress(2));
+    if (found == nullptr) {
+        printf("HATA: Inverter golden vektoru cozulemedi (%s)\n", scanner.lastError);
+        ok = false;
+    } else {
+        const VictronData& d = *found;
+        if (d.type != INVERTER || d.deviceState != 9 || d.alarm != 0 || !near(d.voltage, 12.6f) ||
+            !near(d.acPower, 350.0f) || !near(d.acVoltage, 230.0f) || !near(d.acCurrent, 1.5f) ||
+            strcmp(d.chargeStateDesc, "Inverting") != 0) {
+            printf("HATA: Inverter golden degerleri uyusmuyor: V=%.2f VA=%.0f ACV=%.2f ACI=%.1f\n",
+                   d.voltage, d.acPower, d.acVoltage, d.acCurrent);
+            ok = false;
+        }
+    }
+
+    return ok;
+}
+
+// uniqueFrames: her reklam farkli IV tasir (deger degisimi, tam decode).
+// Aksi halde cihazlar ayni cerceveyi tekrarlar (parmak izi ile atlanir).
+static void runCase(VictronBLE& scanner, const BenchCase& bc, long iterations, bool uniqueFrames) {
+    // IV degisince sifreli veri anlamsiz olur ama kayit yine cozulur; olcum icin yeterli
+    const int VARIANTS = uniqueFrames ? 16 : 1;
+    std::vector<NimBLEAdvertisedDevice> adverts;
+    for (int v = 0; v < VARIANTS; v++) {
+        std::string frame((const char*)bc.advert, bc.len);
+        frame[7] = (char)(frame[7] + v); // IV_L (E1 02 + header ofset 5)
+        for (int i = 0; i < FLEET_SIZE; i++) adverts.emplace_back(fleetAddress(i), frame);
+    }
+    const long advertCount = (long)adverts.size();
+
+    // Callback kuyruga yazar, update() cozer. Kuyruk tasmasin diye
+    // BATCH reklamda bir bosaltilir; iki taraf ayri olculur.
+    const long BATCH = 16;
+
+    // Isinma
+    for (int i = 0; i < 1000; i++) {
+        scanner.onResult(&adverts[i % advertCount]);
+        if (i % BATCH == BATCH - 1) scanner.update();
+    }
+    scanner.update();
+
+    uint32_t dropsBefore = scanner.getAdvertDrops();
+    uint32_t duplicatesBefore = scanner.getDuplicateCount();
+    size_t serialBefore = Serial.bytesWritten;
+    std::chrono::nanoseconds callbackTime(0), decodeTime(0);
+    for (long i = 0; i < iterations; i += BATCH) {
+        auto t0 = std::chrono::steady_clock::now();
+        for (long j = i; j < i + BATCH && j < iterations; j++) {
+            scanner.onResult(&adverts[j % advertCount]);
+        }
+        auto t1 = std::chrono::steady_clock::now();
+        scanner.update();
+        auto t2 = std::chrono::steady_clock::now();
+        callbackTime += t1 - t0;
+        decodeTime += t2 - t1;
+    }
+    size_t serialBytes = Serial.bytesWritten - serialBefore;
+    uint32_t duplicates = scanner.getDuplicateCount() - duplicatesBefore;
+
+    if (scanner.getAdvertDrops() != dropsBefore) {
+        printf("HATA: benchmark sirasinda kuyruk tasti (%u drop)\n", scanner.getAdvertDrops() - dropsBefore);
+    }
+
+    char name[32];
+    snprintf(name, sizeof(name), "%s%s", bc.name, uniqueFrames ? "" : " tekrar");
+    double cbNs = (double)callbackTime.count() / (double)iterations;
+    double nsPerAdvert = (double)(callbackTime + decodeTime).count() / (double)iterations;
+    printf("%-20s %10ld advert  %9.1f ns/advert  %12.0f advert/s  %6.1f ns callback  %6.1f serial byte/advert  %5.1f%% tekrar\n",
+           name, iterations, nsPerAdvert, 1e9 / nsPerAdvert, cbNs, (double)serialBytes / (double)iterations,
+           100.0 * duplicates / (double)iterations);
+}
+
+// Sadece decryptData: tablo arama + AES-CTR
+static void runDecryptCase(VictronBLE& scanner, const BenchCase& bc, long iterations) {
+    uint64_t macs[FLEET_SIZE];
+    for (int i = 0; i < FLEET_SIZE; i++) macs[i] = (uint64_t)fleetAddress(i);
+
+    const uint8_t* payload = bc.advert + 2; // E1 02 atla
+    size_t payloadLen = bc.len - 2;
+    uint8_t decrypted[32];
+
+    auto start = std::chrono::steady_clock::now();
+    for (long i = 0; i < iterations; i++) {
+        if (!VictronBenchAccess::decrypt(scanner, macs[i % FLEET_SIZE], payload, payloadLen, decrypted)) {
+            printf("HATA: decryptData basarisiz (%s)\n", scanner.lastError);
+            return;
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    double ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    double nsPerAdvert = ns / (double)iterations;
+    printf("%-20s %10ld decrypt %9.1f ns/advert  %12.0f advert/s\n",
+           bc.name, iterations, nsPerAdvert, 1e9 / nsPerAdvert);
+}
+
+// Okuyucu maliyeti: yeni surum varken kopya, surum ayniyken atlama
+static void runSnapshotCase(VictronBLE& scanner, long iterations) {
+    static VictronSnapshot snapshot;
+    std::string frame((const char*)GOLDEN_MPPT, sizeof(GOLDEN_MPPT));
+    NimBLEAdvertisedDevice advert(fleetAddress(0), frame);
+
+    std::chrono::nanoseconds changedTime(0), unchangedTime(0);
+    for (long i = 0; i < iterations; i++) {
+        frame[7] = (char)i; // Yeni IV: tekrar sayilmasin
+        advert.setManufacturerData(frame);
+        scanner.onResult(&advert);
+        scanner.update(); // Yeni surum yayinlar
+
+        auto t0 = std::chrono::steady_clock::now();
+        scanner.getSnapshot(snapshot);
+        auto t1 = std::chrono::steady_clock::now();
+        scanner.getSnapshot(snapshot);
+        auto t2 = std::chrono::steady_clock::now();
+        changedTime += t1 - t0;
+        unchangedTime += t2 - t1;
+    }
+
+    printf("%-20s %10ld okuma  %9.1f ns yeni surum (%zu cihaz)  %6.1f ns ayni surum\n",
+           "snapshot", iterations, (double)changedTime.count() / (double)iterations, snapshot.count,
+           (double)unchangedTime.count() / (double)iterations);
+}
+
+// Artimli filo ozeti, snapshot'taki cihazlardan bastan hesaplananla ayni olmali
+static bool checkFleet(VictronBLE& scanner) {
+    static VictronSnapshot snapshot;
+    snapshot.version = 0;
+    scanner.getSnapshot(snapshot);
+
+    int mppts = 0, banks = 0;
+    float pvPower = 0, current = 0, soc = 0;
+    for (size_t i = 0; i < snapshot.count; i++) {
+        const VictronData& d = snapshot.devices[i];
+        if (d.type == SOLAR_CHARGER) {
+            mppts++;
+            pvPower += d.pvPower;
+        } else if (d.type == BATTERY_MONITOR || d.type == LYNX_BMS) {
+            banks++;
+            current += d.current;
+            soc += d.soc;
+        }
+    }
+    if (banks > 0) soc /= banks; // Kapasite ayari yok: esit agirlik
+
+    const FleetTotals& f = snapshot.fleet;
+    if (f.liveDevices != snapshot.count || f.mpptCount != mppts || f.batteryBanks != banks ||
+        fabsf(f.pvPower - pvPower) > 0.1f || fabsf(f.batteryCurrent - current) > 0.01f ||
+        fabsf(f.batterySoc - soc) > 0.1f) {
+        printf("HATA: filo ozeti uyusmuyor: cihaz %u/%zu MPPT %u/%d PV %.1f/%.1f banka %u/%d I %.2f/%.2f SOC %.1f/%.1f\n",
+               f.liveDevices, snapshot.count, f.mpptCount, mppts, f.pvPower, pvPower, f.batteryBanks, banks,
+               f.batteryCurrent, current, f.batterySoc, soc);
+        return false;
+    }
+    printf("filo ozeti OK (%u cihaz, %u MPPT %.0f W, %u banka %.2f A SOC %.1f%%)\n", f.liveDevices, f.mpptCount,
+           f.pvPower, f.batteryBanks, f.batteryCurrent, f.batterySoc);
+    return true;
+}
+
+int main(int argc, char** argv) {
+    long iterations = 200000;
+    if (argc > 1) iterations = atol(argv[1]);
+    if (iterations <= 0) iterations = 200000;
+
+    VictronBLE scanner;
+    scanner.begin();
+    for (int i = 0; i < FLEET_SIZE; i++) {
+        scanner.addDevice(String(fleetAddress(i).toString()), GOLDEN_KEY);
+    }
+
+    if (!checkGolden(scanner)) return 1;
+    printf("Golden vektorler OK (%d kayitli cihaz)\n", FLEET_SIZE);
+
+    // Golden cihazlar + simulasyon kayitlari: uplink govde boyutlari
+    static VictronSnapshot telemetrySnapshot;
+    scanner.simulate();
+    scanner.getSnapshot(telemetrySnapshot);
+    if (!runTelemetryCase(telemetrySnapshot, iterations / 100 + 1)) return 1;
+    if (!runQueueCase(telemetrySnapshot)) return 1;
+    if (!runChangeCase()) return 1;
+    if (!runDisplayCase()) return 1;
+    if (!runApiCase(scanner, telemetrySnapshot)) return 1;
+    if (!runLiveCase(telemetrySnapshot)) return 1;
+    if (!runReloadCase(GOLDEN_KEY, GOLDEN_MPPT, sizeof(GOLDEN_MPPT))) return 1;
+    if (!runScanCase()) return 1;
+    if (!runMetricsCase(GOLDEN_KEY, GOLDEN_MPPT, sizeof(GOLDEN_MPPT))) return 1;
+
+    const BenchCase cases[] = {
+        {"0x01 MPPT", GOLDEN_MPPT, sizeof(GOLDEN_MPPT)},
+        {"0x02 Shunt", GOLDEN_SHUNT, sizeof(GOLDEN_SHUNT)},
+        {"0x03 Inverter", GOLDEN_INVERTER, sizeof(GOLDEN_INVERTER)},
+    };
+    for (const BenchCase& bc : cases) runCase(scanner, bc, iterations, true);
+    for (const BenchCase& bc : cases) runCase(scanner, bc, iterations, false);
+    for (const BenchCase& bc : cases) runDecryptCase(scanner, bc, iterations);
+    runSnapshotCase(scanner, iterations / 10);
+    if (!checkFleet(scanner)) return 1;
+
+    return 0;
+}
@@ -0,0 +1,118 @@
+// Ekran: eski tam yeniden cizim (fillScreen + tum etiketler, 500 ms'de bir)
+// ile DisplayView'in (degisen widget -> sprite -> tek pencere) panele
+// gonderdigi piksel / SPI byte miktari. TFT_eSPI shim'i trafigi sayar.
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include <stdio.h>
+#include <math.h>
+#include "DisplayView.h"
+
+// updateDisplay'in eski dashboard dali (ayni cizim cagrilari)
+static void legacyRender(TFT_eSPI& tft, const DisplayState& s) {
+    char text[48];
+    tft.fillScreen(TFT_BLACK);
+    tft.setTextColor(TFT_CYAN, TFT_BLACK);
+    tft.setTextSize(2);
+    tft.drawString("Victron BLE", 0, 0, 1);
+    tft.setTextSize(1);
+    tft.setTextDatum(TR_DATUM);
+    tft.setTextColor(TFT_GREEN, TFT_BLACK);
+    snprintf(text, sizeof(text), "IP: %s", s.ip);
+    tft.drawString(text, tft.width() - 2, 5, 1);
+    tft.setTextDatum(TL_DATUM);
+    tft.drawLine(0, 22, tft.width(), 22, TFT_DARKGREY);
+
+    tft.setTextColor(TFT_LIGHTGREY, TFT_BLACK);
+    tft.setTextSize(1);
+    tft.drawString("AKU VOLTAJI", 0, 30, 1);
+    tft.setTextColor(TFT_WHITE, TFT_BLACK);
+    tft.setTextSize(3);
+    snprintf(text, sizeof(text), "%.2fV", s.batteryVoltage);
+    tft.drawString(text, 0, 45, 1);
+    tft.setTextColor(TFT_LIGHTGREY, TFT_BLACK);
+    tft.setTextSize(1);
+    tft.drawString("AKIM", 130, 30, 1);
+    tft.setTextSize(3);
+    tft.setTextColor(s.batteryCurrent > 0 ? TFT_GREEN : TFT_RED, TFT_BLACK);
+    snprintf(text, sizeof(text), "%.1fA", s.batteryCurrent);
+    tft.drawString(text, 130, 45, 1);
+
+    tft.setTextColor(TFT_YELLOW, TFT_BLACK);
+    tft.setTextSize(2);
+    snprintf(text, sizeof(text), "SOC: %.1f%%", s.batterySoc);
+    tft.drawString(text, 0, 72, 1);
+    int barWidth = tft.width() - 4;
+    tft.drawRect(0, 96, barWidth, 15, TFT_WHITE);
+    tft.fillRect(2, 98, (int)((s.batterySoc / 100.0) * (barWidth - 4)), 11, s.batterySoc > 50 ? TFT_GREEN : TFT_RED);
+
+    tft.setTextColor(TFT_ORANGE, TFT_BLACK);
+    tft.setTextSize(1);
+    snprintf(text, sizeof(text), "PV: %.0fW (%s)", s.pvPower, getMpptStateName(s.mpptState));
+    tft.drawString(text, 0, 118, 1);
+    tft.setTextColor(TFT_LIGHTGREY, TFT_BLACK);
+    snprintf(text, sizeof(text), "SURE: %ddk", s.batteryRemaining);
+    tft.drawString(text, 130, 118, 1);
+}
+
+// 10 dakika, 500 ms'de bir kare. Reklamlar ~1 sn'de bir; akim her reklamda,
+// voltaj birkac saniyede bir, SoC ve kalan sure dakikalar icinde degisir.
+static void stateAt(int frame, DisplayState& s) {
+    s.wifi = DISPLAY_WIFI_CONNECTED;
+    snprintf(s.ip, sizeof(s.ip), "192.168.1.42");
+    s.batteryFound = true;
+    s.mpptCount = 1;
+    s.mpptState = frame < 600 ? 3 : 4;
+    int advert = frame / 2;
+    s.batteryCurrent = 8.0f + (float)((advert * 7) % 5) * 0.1f;
+    s.batteryVoltage = 12.80f + (float)(advert / 4 % 3) * 0.01f;
+    s.batterySoc = 60.0f + (float)(frame / 240) * 0.1f;
+    s.batteryRemaining = 900 - frame / 120;
+    s.pvPower = 120.0f + (float)(advert / 3 % 4);
+}
+
+bool runDisplayCase() {
+    const int FRAMES = 1200;
+    DisplayState state;
+
+    TFT_eSPI legacy;
+    legacy.setRotation(1);
+    for (int f = 0; f < FRAMES; f++) {
+        stateAt(f, state);
+        legacyRender(legacy, state);
+    }
+
+    TFT_eSPI panel;
+    panel.setRotation(1);
+    DisplayView view(panel);
+    if (!view.begin()) {
+        printf("HATA: sprite ayrilamadi\n");
+        return false;
+    }
+    for (int f = 0; f < FRAMES; f++) {
+        stateAt(f, state);
+        view.render(state);
+    }
+
+    // Degismeyen kare panele hic bir sey gondermemeli
+    uint64_t before = panel.busStats().bytes;
+    view.render(state);
+    if (panel.busStats().bytes != before) {
+        printf("HATA: degismeyen kare panele yazildi\n");
+        return false;
+    }
+    // Baska kod ekrani cizdi: tam yeniden cizim
+    view.invalidate();
+    view.render(state);
+    if (view.stats().fullRedraws != 2) {
+        printf("HATA: invalidate tam cizim yapmadi\n");
+        return false;
+    }
+
+    const TFTBusStats& a = legacy.busStats();
+    const TFTBusStats& b = panel.busStats();
+    printf("ekran (%d kare): tam cizim %.0f byte/kare (%.0f pencere), widget %.0f byte/kare (%.1f pencere, %.2f widget)\n",
+           FRAMES, (double)a.bytes / FRAMES, (double)a.windows / FRAMES, (double)b.bytes / FRAMES,
+           (double)b.windows / FRAMES, (double)view.stats().widgetDraws / FRAMES);
+    return b.bytes * 4 < a.bytes;
+}
@@ -0,0 +1,131 @@
+// Canli itme (LiveFeed, /api/events) ile 3 sn'lik /api/data yoklamasinin
+// karsilastirmasi: 3 telefon, 10 dk, cihazlar 0.5-2 sn'de bir guncelleniyor.
+// Ayrica hiz siniri, degisiklik gecikmesi, dusen cihaz ve tam senkron
+// kontrol edilir.
+
+#include <Arduino.h>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include "LiveFeed.h"
+#include "DeviceJsonStream.h"
+
+static const int PHONES = 3;
+static const unsigned long DURATION_MS = 600000;
+static const unsigned long LOOP_MS = 10;
+static const unsigned long POLL_MS = 3000;
+
+static size_t snapshotJsonBytes(const VictronSnapshot& snap) {
+    size_t bytes = 2;
+    char obj[DEVICE_JSON_OBJECT_MAX];
+    for (size_t i = 0; i < snap.count; i++) {
+        bytes += writeDeviceJson(snap.devices[i], DEVICE_JSON_ALL_FIELDS, obj, sizeof(obj)) + (i > 0 ? 1 : 0);
+    }
+    return bytes;
+}
+
+static size_t countDevices(const char* msg) {
+    size_t n = 0;
+    for (const char* p = strstr(msg, "\"mac\":"); p; p = strstr(p + 1, "\"mac\":")) n++;
+    return n;
+}
+
+bool runLiveCase(const VictronSnapshot& base) {
+    static VictronSnapshot snap;
+    snap = base;
+    snap.version = 1;
+    if (snap.count < 2) {
+        printf("HATA: canli itme icin en az 2 cihaz gerekli\n");
+        return false;
+    }
+
+    LiveFeed feed;
+    static char msg[LIVE_FEED_MESSAGE_MAX];
+
+    // Ilk poll: tam liste
+    size_t len = feed.poll(snap, 1000, msg, sizeof(msg));
+    if (len == 0 || strncmp(msg, "{\"full\":true", 12) != 0 || countDevices(msg) != snap.count) {
+        printf("HATA: ilk mesaj tam liste degil: %s\n", msg);
+        return false;
+    }
+    // Degisim yok: mesaj yok
+    if (feed.poll(snap, 2000, msg, sizeof(msg)) != 0) {
+        printf("HATA: degisim yokken mesaj uretildi\n");
+        return false;
+    }
+
+    // Trafik: cihaz i her (500 + 300*i) ms'de bir yeni voltaj yayinlar
+    unsigned long lastSent = 0;
+    unsigned long minGap = ~0UL;
+    unsigned long maxLatency = 0;
+    unsigned long pendingSince = 0; // Itilmemis ilk degisim
+    uint64_t pushBytes = 0;
+    uint32_t pushMessages = 0;
+    for (unsigned long t = 3000; t < 3000 + DURATION_MS; t += LOOP_MS) {
+        bool changed = false;
+        for (size_t i = 0; i < snap.count; i++) {
+            unsigned long period = 500 + 300 * (unsigned long)i;
+            if (t % period == 0) {
+                snap.devices[i].voltage = 12.0f + (float)((t / period) % 50) * 0.01f;
+                changed = true;
+            }
+        }
+        if (changed) {
+            snap.version++;
+            if (pendingSince == 0) pendingSince = t;
+        }
+
+        len = feed.poll(snap, t, msg, sizeof(msg));
+        if (len == 0) continue;
+        if (lastSent != 0 && t - lastSent < minGap) minGap = t - lastSent;
+        lastSent = t;
+        if (pendingSince != 0 && t - pendingSince > maxLatency) maxLatency = t - pendingSince;
+        pendingSince = 0;
+        pushMessages++;
+        pushBytes += len;
+    }
+    if (minGap < LIVE_PUSH_INTERVAL_MS || maxLatency > LIVE_PUSH_INTERVAL_MS + LOOP_MS) {
+        printf("HATA: hiz siniri / gecikme: min aralik %lu ms, max gecikme %lu ms\n", minGap, maxLatency);
+        return false;
+    }
+
+    // Dusen cihaz "removed" ile bildirilir
+    char mac[18];
+    formatMacAddress(snap.devices[snap.count - 1].mac, mac);
+    snap.count--;
+    snap.version++;
+    len = feed.poll(snap, 3000 + DURATION_MS + 1000, msg, sizeof(msg));
+    if (len == 0 || strstr(msg, mac) == nullptr || strstr(msg, "\"removed\":[\"") == nullptr) {
+        printf("HATA: dusen cihaz bildirilmedi: %s\n", msg);
+        return false;
+    }
+
+    // Yeni istemci: tam senkron
+    feed.requestFullSync();
+    len = feed.poll(snap, 3000 + DURATION_MS + 2000, msg, sizeof(msg));
+    if (len == 0 || strncmp(msg, "{\"full\":true", 12) != 0 || countDevices(msg) != snap.count) {
+        printf("HATA: tam senkron: %s\n", msg);
+        return false;
+    }
+
+    // Yoklama: her telefon her istekte tam liste + HTTP istek/yanit basliklari (~350 byte).
+    // Her istek ayri ayristirma + serilestirme; SSE mesaji bir kez uretilip her telefona gider.
+    size_t listBytes = snapshotJsonBytes(base);
+    uint64_t polls = (uint64_t)PHONES * (DURATION_MS / POLL_MS);
+    uint64_t pollBytes = polls * (listBytes + 350);
+    uint64_t fastPolls = (uint64_t)PHONES * (DURATION_MS / LIVE_PUSH_INTERVAL_MS);
+    uint64_t fastPollBytes = fastPolls * (listBytes + 350);
+    uint64_t sseBytes = (uint64_t)PHONES * (pushBytes + pushMessages * 30); // Olay basligi ~30 byte
+    printf("Canli itme (%d telefon, %lu dk, %zu cihaz):\n"
+           "  yoklama %lu ms: %llu istek, %llu cihaz serilestirme, %llu KB, gecikme <= %lu ms\n"
+           "  yoklama %d ms: %llu istek, %llu cihaz serilestirme, %llu KB\n"
+           "  SSE: %u mesaj, %u cihaz serilestirme, %llu KB (%u tam senkron), max gecikme %lu ms\n",
+           PHONES, DURATION_MS / 60000, base.count,
+           POLL_MS, (unsigned long long)polls, (unsigned long long)(polls * base.count),
+           (unsigned long long)(pollBytes / 1024), POLL_MS,
+           LIVE_PUSH_INTERVAL_MS, (unsigned long long)fastPolls, (unsigned long long)(fastPolls * base.count),
+           (unsigned long long)(fastPollBytes / 1024),
+           pushMessages, feed.stats().devicesSent, (unsigned long long)(sseBytes / 1024),
+           feed.stats().fullSyncs, maxLatency);
+    return true;
+}
@@ -0,0 +1,149 @@
+// /api/metrics: cihaz basina alim sayaclari dogru birikmeli (tekrar, IV
+// boslugu, anahtar kontrolu), Prometheus ciktisi parca boyundan bagimsiz
+// ayni olmali ve her aile tek baslikla yazilmali. Dolu tablo (48 cihaz)
+// icin cikti boyu ve uretim suresi olculur.
+
+#include <Arduino.h>
+#include <NimBLEDevice.h>
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <string>
+#include "VictronBLE.h"
+#include "DeviceKeyTable.h"
+#include "Metrics.h"
+
+void benchPublishRxStats(VictronBLE& scanner); // bench_decode.cpp
+
+static std::string render(const VictronBLE& scanner, const GatewayMetrics& gateway, size_t chunk, unsigned long now) {
+    MetricsStream stream(scanner, gateway, now);
+    std::string out;
+    uint8_t buf[4096];
+    for (;;) {
+        size_t n = stream.fill(buf, chunk);
+        if (n == 0) break;
+        out.append((const char*)buf, n);
+    }
+    return out;
+}
+
+static bool contains(const std::string& text, const std::string& line) {
+    return text.find(line + "\n") != std::string::npos;
+}
+
+static size_t countOf(const std::string& text, const std::string& part) {
+    size_t count = 0;
+    for (size_t pos = text.find(part); pos != std::string::npos; pos = text.find(part, pos + 1)) count++;
+    return count;
+}
+
+// Ornek satiri: ad[{etiketler}] deger
+static bool validLines(const std::string& text) {
+    size_t start = 0;
+    while (start < text.size()) {
+        size_t end = text.find('\n', start);
+        if (end == std::string::npos) return false; // Son satir da '\n' ile bitmeli
+        std::string line = text.substr(start, end - start);
+        start = end + 1;
+        if (line.compare(0, 7, "# HELP ") == 0 || line.compare(0, 7, "# TYPE ") == 0) continue;
+        size_t space = line.rfind(' ');
+        if (space == std::string::npos || space == 0) return false;
+        char* parsed;
+        strtod(line.c_str() + space + 1, &parsed);
+        if (*parsed != '\0') return false;
+    }
+    return true;
+}
+
+static void feed(VictronBLE& scanner, uint64_t mac, const std::string& frame) {
+    NimBLEAdvertisedDevice dev{NimBLEAddress(mac), frame};
+    scanner.onResult(&dev);
+    scanner.update();
+}
+
+bool runMetricsCase(const char* goldenKey, const uint8_t* advert, size_t advertLen) {
+    uint8_t key[16];
+    if (!parseDeviceKey(goldenKey, key)) return false;
+
+    // A: ayni cerceve 5 kez, B: anahtari degismis cihaz, C: 3 IV atlayan cerceve
+    const uint64_t base = 0xD05A1E300000ULL;
+    static DeviceKeyTable table;
+    table.count = 0;
+    for (int i = 0; i < 3; i++) memcpy(table.upsert(base | (uint64_t)i)->key, key, 16);
+
+    static VictronBLE scanner;
+    scanner.begin();
+    scanner.reloadDevices(table);
+
+    // frame: Company ID (E1 02) + Victron payload; IV 7-8, anahtar kontrolu 9
+    std::string frame((const char*)advert, advertLen);
+    for (int i = 0; i < 5; i++) feed(scanner, base | 0, frame);
+    std::string wrongKey = frame;
+    wrongKey[9] ^= 0xFF;
+    feed(scanner, base | 1, wrongKey);
+    feed(scanner, base | 2, frame);
+    std::string skipped = frame;
+    uint16_t iv = (uint8_t)frame[7] | ((uint8_t)frame[8] << 8);
+    iv += 3;
+    skipped[7] = (char)(iv & 0xFF);
+    skipped[8] = (char)(iv >> 8);
+    feed(scanner, base | 2, skipped);
+    benchPublishRxStats(scanner);
+
+    GatewayMetrics gateway;
+    gateway.uptimeSec = 12.5;
+    gateway.bleQueueDrops = 4294967295.0;
+    unsigned long now = millis(); // Yas metrigi: tum cizimlerde ayni an
+    std::string text = render(scanner, gateway, 4096, now);
+    char macA[18], macB[18], macC[18];
+    formatMacAddress(base | 0, macA);
+    formatMacAddress(base | 1, macB);
+    formatMacAddress(base | 2, macC);
+    auto sample = [](const char* name, const char* mac, const char* value) {
+        return std::string(name) + "{mac=\"" + mac + "\"} " + value;
+    };
+
+    if (!contains(text, sample("victron_adverts_total", macA, "5")) ||
+        !contains(text, sample("victron_duplicate_adverts_total", macA, "4")) ||
+        !contains(text, sample("victron_decodes_total", macA, "1")) ||
+        !contains(text, std::string("victron_advert_interval_seconds_count{mac=\"") + macA + "\"} 4") ||
+        !contains(text, sample("victron_key_check_failures_total", macB, "1")) ||
+        !contains(text, sample("victron_decodes_total", macB, "0")) ||
+        !contains(text, sample("victron_frames_lost_total", macC, "2")) ||
+        !contains(text, "gateway_uptime_seconds 12.5") ||
+        !contains(text, "gateway_ble_queue_drops_total 4294967295")) {
+        printf("HATA: metrik degerleri yanlis:\n%s\n", text.c_str());
+        return false;
+    }
+    if (text.find("gateway_heap_free_bytes") != std::string::npos ||
+        text.find(std::string("victron_last_good_age_seconds{mac=\"") + macB) != std::string::npos) {
+        printf("HATA: olculmeyen deger yazildi\n");
+        return false;
+    }
+    if (countOf(text, "# TYPE victron_adverts_total counter\n") != 1 ||
+        countOf(text, "# TYPE victron_advert_interval_seconds histogram\n") != 1 || !validLines(text)) {
+        printf("HATA: Prometheus formati bozuk:\n%s\n", text.c_str());
+        return false;
+    }
+    if (render(scanner, gateway, 7, now) != text || render(scanner, gateway, 1, now) != text) {
+        printf("HATA: parca boyu ciktiyi degistirdi\n");
+        return false;
+    }
+
+    // Dolu tablo: her cihazdan bir reklam
+    static DeviceKeyTable full;
+    full.count = 0;
+    for (int i = 0; i < DEVICE_KEY_TABLE_MAX; i++) memcpy(full.upsert(base | (uint64_t)(i + 16))->key, key, 16);
+    scanner.reloadDevices(full);
+    for (int i = 0; i < DEVICE_KEY_TABLE_MAX; i++) feed(scanner, base | (uint64_t)(i + 16), frame);
+    benchPublishRxStats(scanner);
+
+    const int ITER = 50;
+    size_t bytes = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ITER; i++) bytes = render(scanner, gateway, 1436, millis()).size(); // TCP MSS
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+    printf("/api/metrics OK: %d cihaz %zu byte, uretim %.1f us, istek basina bellek %zu byte\n",
+           (int)DEVICE_KEY_TABLE_MAX, bytes, (double)ns.count() / ITER / 1000.0, sizeof(MetricsStream));
+    return true;
+}
@@ -0,0 +1,113 @@
+// Flash telemetri kuyrugu: yarim yazilmis kayit, yeniden acilis, tahliye ve
+// yas bilgisiyle bosaltma. LittleFS shim'i /tmp altinda gercek dosya kullanir.
+
+#include <Arduino.h>
+#include <LittleFS.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <chrono>
+#include <string>
+#include <vector>
+#include "VictronBLE.h"
+#include "TelemetryCodec.h"
+#include "TelemetryDecoder.h"
+#include "TelemetryQueue.h"
+
+static size_t drainAll(TelemetryQueue& queue, std::vector<TelemetryBatch>& out, uint32_t nowUptime) {
+    size_t total = 0;
+    static uint8_t aged[TELEMETRY_QUEUE_MAX_PAYLOAD + 8];
+    bool ok = true;
+    while (queue.pendingRecords() > 0 || total == 0) {
+        size_t n = queue.peek(
+            [&](const TelemetryQueueRecord& rec) {
+                size_t len = telemetrySetAge(rec.data, rec.len, nowUptime - rec.uptimeSec, aged, sizeof(aged));
+                TelemetryBatch batch;
+                if (len == 0 || telemetryDecode(aged, len, batch) != len) ok = false;
+                out.push_back(batch);
+            },
+            16, 4096);
+        if (n == 0) break;
+        queue.commit();
+        total += n;
+    }
+    return ok ? total : 0;
+}
+
+bool runQueueCase(const VictronSnapshot& snapshot) {
+    char root[] = "/tmp/tq-bench-XXXXXX";
+    if (!mkdtemp(root)) return false;
+    LittleFS.setRoot(root);
+    LittleFS.begin(true);
+
+    static uint8_t batch[TELEMETRY_QUEUE_MAX_PAYLOAD];
+    TelemetryEncoder encoder(batch, sizeof(batch));
+    encoder.begin("MyBoat-3F2A");
+    for (size_t i = 0; i < snapshot.count; i++) encoder.add(snapshot.devices[i], snapshot.devices[i].power);
+    size_t batchLen = encoder.finish();
+
+    // 1) Yaz, bir kismini tuket
+    TelemetryQueue queue;
+    queue.begin(1);
+    const int firstRun = 300;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < firstRun; i++) queue.push(batch, batchLen, 0, (uint32_t)i * 60);
+    auto t1 = std::chrono::steady_clock::now();
+
+    size_t peeked = queue.peek([](const TelemetryQueueRecord&) {}, 20, 1 << 20);
+    queue.commit();
+    if (peeked != 20 || queue.pendingRecords() != firstRun - 20) {
+        printf("HATA: kuyruk peek/commit (%zu, %u bekleyen)\n", peeked, queue.pendingRecords());
+        return false;
+    }
+
+    // 2) Elektrik kesintisi: son segmentin son kaydi yarim kalmis
+    char last[64];
+    snprintf(last, sizeof(last), "%s" TELEMETRY_QUEUE_DIR "/%08lx", root, 0x5ul);
+    FILE* f = fopen(last, "rb");
+    if (!f) {
+        printf("HATA: kuyruk segmenti yok: %s\n", last);
+        return false;
+    }
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fclose(f);
+    if (truncate(last, size - 7) != 0) return false;
+
+    TelemetryQueue reopened;
+    reopened.begin(2);
+    const uint32_t survivors = firstRun - 20 - 1;
+    if (reopened.pendingRecords() != survivors) {
+        printf("HATA: yeniden acilista %u bekleyen (beklenen %u)\n", reopened.pendingRecords(), survivors);
+        return false;
+    }
+    for (int i = 0; i < 5; i++) reopened.push(batch, batchLen, 0, 100000);
+
+    std::vector<TelemetryBatch> drained;
+    auto t2 = std::chrono::steady_clock::now();
+    size_t delivered = drainAll(reopened, drained, 100000 + 30);
+    auto t3 = std::chrono::steady_clock::now();
+    if (delivered != survivors + 5 || drained.back().ageSeconds != 30 || drained.back().rows.size() != snapshot.count) {
+        printf("HATA: bosaltma %zu kayit (beklenen %u)\n", delivered, survivors + 5);
+        return false;
+    }
+
+    // 3) Sinir: en eski segmentler silinir, bekleyen sayisi sinirli kalir
+    const int flood = 4000;
+    for (int i = 0; i < flood; i++) reopened.push(batch, batchLen, 0, 0);
+    uint32_t perSegment = TELEMETRY_QUEUE_SEGMENT_SIZE / (uint32_t)(batchLen + 18);
+    if (reopened.evictedRecords() == 0 ||
+        reopened.pendingRecords() > perSegment * TELEMETRY_QUEUE_MAX_SEGMENTS ||
+        reopened.pendingRecords() + reopened.evictedRecords() != (uint32_t)flood) {
+        printf("HATA: tahliye (%u bekleyen, %u silinen)\n", reopened.pendingRecords(), reopened.evictedRecords());
+        return false;
+    }
+
+    double pushUs = std::chrono::duration<double, std::micro>(t1 - t0).count() / firstRun;
+    double drainUs = std::chrono::duration<double, std::micro>(t3 - t2).count() / (double)delivered;
+    printf("kuyruk: push %.1f us/kayit, bosaltma %.1f us/kayit, %u bekleyen / %u silinen (%zu byte batch)\n",
+           pushUs, drainUs, reopened.pendingRecords(), reopened.evictedRecords(), batchLen);
+
+    LittleFS.format();
+    rmdir(root);
+    return true;
+}
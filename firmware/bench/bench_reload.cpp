@@ -0,0 +1,169 @@
+// Cihaz anahtar tablosu: NVS blob'u gidip gelmeli, bozuk blob reddedilmeli.
+// VictronBLE::reloadDevices ile silinen cihaz dusmeli, degismeyen ve anahtari
+// degisen cihazin canli verisi korunmali (veri boslugu yok). Tekrar eden
+// cerceve veri surumunu (ETag) degistirmemeli. Dolu tablo icin
+// blob cozme ve yeniden yukleme suresi olculur.
+
+#include <Arduino.h>
+#include <NimBLEDevice.h>
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <string>
+#include "VictronBLE.h"
+#include "DeviceKeyTable.h"
+
+static const VictronData* findLive(const VictronSnapshot& snap, uint64_t mac) {
+    for (size_t i = 0; i < snap.count; i++) {
+        if (snap.devices[i].mac == mac) return &snap.devices[i];
+    }
+    return nullptr;
+}
+
+static void fillTable(DeviceKeyTable& table, int count, uint64_t baseMac, const uint8_t key[16]) {
+    table.count = 0;
+    for (int i = 0; i < count; i++) {
+        DeviceKeyRecord* rec = table.upsert(baseMac | (uint64_t)i);
+        memcpy(rec->key, key, 16);
+        rec->capacityAh = (i % 3 == 0) ? 200.0f + i : 0.0f;
+        rec->deadband[0] = (i % 2 == 0) ? 0.1f : 0.0f;
+    }
+}
+
+static bool checkBlob(const uint8_t key[16]) {
+    static DeviceKeyTable table, decoded;
+    fillTable(table, DEVICE_KEY_TABLE_MAX, 0xD05A1E100000ULL, key);
+
+    static uint8_t blob[8 + DEVICE_KEY_TABLE_MAX * 64 + 4];
+    size_t len = encodeDeviceKeyBlob(table, blob, sizeof(blob));
+    if (len == 0 || len != deviceKeyBlobSize(table.count) || !decodeDeviceKeyBlob(blob, len, decoded) ||
+        decoded.count != table.count) {
+        printf("HATA: anahtar tablosu blob'u gidip gelmedi (%zu byte)\n", len);
+        return false;
+    }
+    for (uint16_t i = 0; i < table.count; i++) {
+        const DeviceKeyRecord& a = table.records[i];
+        const DeviceKeyRecord* b = decoded.find(a.mac);
+        if (b == nullptr || memcmp(a.key, b->key, 16) != 0 || a.capacityAh != b->capacityAh ||
+            a.deadband[0] != b->deadband[0]) {
+            printf("HATA: blob kaydi uyusmuyor (%d)\n", i);
+            return false;
+        }
+    }
+
+    blob[len / 2] ^= 0x01;
+    if (decodeDeviceKeyBlob(blob, len, decoded) || decoded.count != 0) {
+        printf("HATA: bozuk blob kabul edildi\n");
+        return false;
+    }
+    blob[len / 2] ^= 0x01;
+    if (decodeDeviceKeyBlob(blob, len - 1, decoded)) {
+        printf("HATA: kisa blob kabul edildi\n");
+        return false;
+    }
+
+    uint8_t parsed[16];
+    char text[33];
+    formatDeviceKey(key, text);
+    std::string spaced = std::string(" ") + std::string(text, 16) + " \t" + std::string(text + 16) + "\r\n";
+    if (!parseDeviceKey(spaced.c_str(), parsed) || memcmp(parsed, key, 16) != 0 ||
+        parseDeviceKey(std::string(text, 31).c_str(), parsed) || parseDeviceKey((std::string(text) + "0").c_str(), parsed)) {
+        printf("HATA: anahtar hex cozumu hatali\n");
+        return false;
+    }
+
+    const int ITER = 2000;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ITER; i++) decodeDeviceKeyBlob(blob, len, decoded);
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+    printf("anahtar tablosu: %u cihaz, blob %zu byte, cozme %.1f us\n", (unsigned)table.count, len,
+           (double)ns.count() / ITER / 1000.0);
+    return true;
+}
+
+bool runReloadCase(const char* goldenKey, const uint8_t* advert, size_t advertLen) {
+    uint8_t key[16];
+    if (!parseDeviceKey(goldenKey, key)) return false;
+    if (!checkBlob(key)) return false;
+
+    // Ayni golden cerceveyi yayinlayan 3 cihaz: A kalir, B'nin anahtari degisir, C silinir
+    const uint64_t base = 0xD05A1E200000ULL;
+    static DeviceKeyTable table;
+    fillTable(table, 3, base, key);
+
+    static VictronBLE scanner;
+    static VictronSnapshot snap;
+    scanner.begin();
+    if (!scanner.reloadDevices(table)) {
+        printf("HATA: ilk yukleme basarisiz\n");
+        return false;
+    }
+    std::string frame((const char*)advert, advertLen);
+    for (int i = 0; i < 3; i++) {
+        NimBLEAdvertisedDevice dev(NimBLEAddress(base | (uint64_t)i), frame);
+        scanner.onResult(&dev);
+    }
+    scanner.update();
+    snap.version = 0;
+    scanner.getSnapshot(snap);
+    if (snap.count != 3) {
+        printf("HATA: yeniden yukleme oncesi %zu/3 canli cihaz (%s)\n", snap.count, scanner.lastError);
+        return false;
+    }
+    uint32_t before = snap.version;
+
+    // Tekrar eden cerceve: snapshot yenilenir (RSSI) ama veri surumu (ETag) ayni kalir
+    uint32_t dataBefore = scanner.getDataVersion();
+    delay(VICTRON_SNAPSHOT_REFRESH_MS + 20);
+    NimBLEAdvertisedDevice repeat(NimBLEAddress(base | 0), frame);
+    scanner.onResult(&repeat);
+    scanner.update();
+    scanner.getSnapshot(snap);
+    if (snap.version == before || scanner.getDataVersion() != dataBefore) {
+        printf("HATA: tekrar eden cerceve veri surumunu degistirdi\n");
+        return false;
+    }
+    before = snap.version;
+
+    uint8_t rotated[16];
+    memcpy(rotated, key, 16);
+    rotated[0] ^= 0xFF;
+    table.count = 2;
+    memcpy(table.records[1].key, rotated, 16);
+    bool reloaded = scanner.reloadDevices(table);
+    scanner.update();
+    scanner.getSnapshot(snap);
+    if (!reloaded || snap.version == before || scanner.getDataVersion() == dataBefore || snap.count != 2 || findLive(snap, base | 0) == nullptr ||
+        findLive(snap, base | 1) == nullptr || findLive(snap, base | 2) != nullptr) {
+        printf("HATA: yeniden yukleme sonrasi canli cihazlar yanlis (%zu)\n", snap.count);
+        return false;
+    }
+
+    // B artik eski anahtarla sifrelenmis cerceveyi cozmez, veri yine de kalir
+    uint32_t decodes = scanner.getDecodeCount();
+    std::string changed = frame;
+    changed[7] ^= 0x01; // Farkli IV: tekrar sayilmasin
+    NimBLEAdvertisedDevice stale(NimBLEAddress(base | 1), changed);
+    scanner.onResult(&stale);
+    scanner.update();
+    scanner.getSnapshot(snap);
+    if (scanner.getDecodeCount() != decodes || findLive(snap, base | 1) == nullptr) {
+        printf("HATA: anahtari degisen cihaz eski anahtarla cozuldu ya da verisi dustu\n");
+        return false;
+    }
+
+    // Dolu tablo: ekleme + degistirme + silme karisik yeniden yukleme suresi
+    static DeviceKeyTable full;
+    fillTable(full, DEVICE_KEY_TABLE_MAX, base, key);
+    const int ITER = 200;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ITER; i++) {
+        full.records[i % full.count].key[1] ^= 0x5A;
+        full.count = (i % 2) ? DEVICE_KEY_TABLE_MAX : DEVICE_KEY_TABLE_MAX - 8;
+        scanner.reloadDevices(full);
+    }
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+    printf("yeniden yukleme OK: %u cihaz %.1f us, silinen cihaz dustu, anahtar degisiminde veri korundu\n",
+           (unsigned)DEVICE_KEY_TABLE_MAX, (double)ns.count() / ITER / 1000.0);
+    return true;
+}
@@ -0,0 +1,95 @@
+// Surekli tarama gorev orani (ScanPolicy) simulasyonu: 6 cihaz, her biri
+// saniyede bir yeni cerceve (IV + 1) ve cerceve basina 250 ms arayla 4 reklam.
+// Reklam, tarama penceresine denk gelirse (olasilik = gorev orani, WiFi
+// gonderimi sirasinda yarisi) alinir. 2 saat; 30-60. dakikalar arasi WiFi
+// yogun. Eski davranis: 5 sn'lik taramalar, cihaz basina sadece ilk reklam.
+
+#include <Arduino.h>
+#include <stdio.h>
+#include "ScanPolicy.h"
+
+static uint32_t rngState = 12345;
+static float nextRandom() {
+    rngState = rngState * 1664525u + 1013904223u;
+    return (float)(rngState >> 8) / 16777216.0f;
+}
+
+bool runScanCase() {
+    const int DEVICES = 6;
+    const int REPEATS = 4;
+    const unsigned long DURATION_MS = 2UL * 3600 * 1000;
+    const unsigned long BUSY_FROM = 30UL * 60 * 1000, BUSY_TO = 60UL * 60 * 1000;
+
+    ScanPolicy policy;
+    ScanWindow window;
+    uint32_t totalFrames = 0, totalLost = 0, busyLost = 0, busyFrames = 0;
+    uint64_t dutySum = 0;
+    int windows = 0, changes = 0;
+    uint8_t busyMaxLevel = 0;
+    uint16_t lastIv[DEVICES] = {0};
+    bool heard[DEVICES] = {false};
+
+    // Eski: 5 sn'lik tarama basina cihaz basina bir reklam (wantDuplicates yok)
+    uint32_t oldFrames = 0, oldTotal = 0;
+
+    for (unsigned long t = 0; t < DURATION_MS; t += 1000) {
+        bool busy = t >= BUSY_FROM && t < BUSY_TO;
+        const ScanDuty& duty = policy.duty();
+        float p = (float)duty.windowMs / duty.intervalMs;
+        if (busy) p *= 0.5f; // Radyo WiFi gonderimine gidiyor
+        if (busy) window.wifiTx += 2;
+
+        for (int d = 0; d < DEVICES; d++) {
+            uint16_t iv = (uint16_t)(t / 1000);
+            int received = 0;
+            for (int r = 0; r < REPEATS; r++) received += nextRandom() < p;
+            window.adverts += received;
+            bool got = received > 0;
+            if (got) {
+                if (heard[d]) {
+                    uint16_t gap = (uint16_t)(iv - lastIv[d]);
+                    if (gap > 1 && gap <= SCAN_MAX_IV_GAP) window.lost += gap - 1;
+                }
+                window.frames++;
+                lastIv[d] = iv;
+                heard[d] = true;
+            }
+            if (t % 5000 == 0) {
+                oldTotal += 5;
+                oldFrames += nextRandom() < 0.9f; // 5 sn'de en az bir reklam neredeyse kesin
+            }
+        }
+
+        if ((t + 1000) % SCAN_STATS_WINDOW_MS == 0) {
+            window.durationMs = SCAN_STATS_WINDOW_MS;
+            window.level = policy.level();
+            totalFrames += window.frames;
+            totalLost += window.lost;
+            if (busy) {
+                busyFrames += window.frames;
+                busyLost += window.lost;
+            }
+            dutySum += policy.duty().windowMs * 100 / policy.duty().intervalMs;
+            windows++;
+            changes += policy.onWindow(window);
+            if (busy && policy.level() > busyMaxLevel) busyMaxLevel = policy.level();
+            window = ScanWindow();
+        }
+    }
+
+    if (busyMaxLevel > SCAN_WIFI_BUSY_MAX_LEVEL) {
+        printf("HATA: WiFi yogunken gorev orani sinirlanmadi (seviye %u)\n", busyMaxLevel);
+        return false;
+    }
+    float coverage = 100.0f * totalFrames / (totalFrames + totalLost);
+    float oldCoverage = 100.0f * oldFrames / oldTotal;
+    if (coverage < 90.0f || coverage <= oldCoverage) {
+        printf("HATA: surekli tarama kapsamasi dusuk: %.1f%% (eski %.1f%%)\n", coverage, oldCoverage);
+        return false;
+    }
+    printf("BLE tarama (2 saat, %d cihaz): kapsama %.1f%% (WiFi yogunken %.1f%%), ortalama gorev %.0f%%, "
+           "%d ayar degisimi / %d pencere; eski 5 sn tarama %.1f%%\n",
+           DEVICES, coverage, 100.0f * busyFrames / (busyFrames + busyLost), (double)dutySum / windows, changes,
+           windows, oldCoverage);
+    return true;
+}
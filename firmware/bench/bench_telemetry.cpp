@@ -0,0 +1,178 @@
+// Uplink govde boyutlari: JSON, JSON + deflate ve ikili format.
+// Ikili batch referans cozucuyle geri acilip kaynak degerlerle karsilastirilir.
+
+#include <Arduino.h>
+#include <stdio.h>
+#include <math.h>
+#include <chrono>
+#include <string>
+#include "VictronBLE.h"
+#include "TelemetryCodec.h"
+#include "TelemetryDecoder.h"
+
+// Tekne adi: gercek kurulumlardaki PIN uzunlugunda
+static const char* BENCH_BOAT = "MyBoat-3F2A";
+
+static float fieldValue(const VictronData& d, int field) {
+    switch (field) {
+        case TF_VOLTAGE: return d.voltage;
+        case TF_CURRENT: return d.current;
+        case TF_POWER: return d.power;
+        case TF_TEMPERATURE: return d.temperature;
+        case TF_ALARM: return (float)d.alarm;
+        case TF_SOC: return d.soc;
+        case TF_PV_POWER: return d.pvPower;
+        case TF_PV_VOLTAGE: return d.pvVoltage;
+        case TF_PV_CURRENT: return d.pvCurrent;
+        case TF_LOAD_CURRENT: return d.loadCurrent;
+        case TF_DEVICE_STATE: return (float)d.deviceState;
+        case TF_YIELD_TODAY: return d.yieldToday;
+        case TF_EFFICIENCY: return d.efficiency;
+        case TF_CONSUMED_AH: return d.consumedAh;
+        case TF_REMAINING_MINS: return (float)d.remainingMins;
+        case TF_AUX_VOLTAGE: return d.auxVoltage;
+        case TF_LOAD_STATE: return (float)d.loadState;
+        default: return 0.0f;
+    }
+}
+
+// Aralik blogu (TELEMETRY_FLAG_SAMPLES): 60 sn boyunca saniyede 4 reklam
+static bool runSamplesCase(const VictronSnapshot& snapshot) {
+    static DeviceSamples samples[VictronDeviceTable::MAX_ENTRIES];
+    const uint32_t now = 60000;
+    for (size_t i = 0; i < snapshot.count; i++) {
+        const VictronData& d = snapshot.devices[i];
+        samples[i].reset();
+        for (uint32_t t = 0; t < now; t += 250) {
+            float wave = (float)((t / 250) % 9) - 4.0f; // -4..4
+            float values[SAMPLE_METRIC_COUNT] = {d.voltage + wave * 0.01f, d.current + wave * 0.1f,
+                                                 d.power + wave, d.pvPower + wave};
+            samples[i].add(t, values);
+        }
+    }
+
+    static uint8_t plain[4096], withSamples[4096];
+    TelemetryEncoder encoder(plain, sizeof(plain));
+    encoder.begin(BENCH_BOAT);
+    for (size_t i = 0; i < snapshot.count; i++) encoder.add(snapshot.devices[i], snapshot.devices[i].power);
+    size_t plainLen = encoder.finish();
+
+    TelemetryEncoder sampled(withSamples, sizeof(withSamples));
+    sampled.begin(BENCH_BOAT, TELEMETRY_FLAG_SAMPLES);
+    for (size_t i = 0; i < snapshot.count; i++) {
+        sampled.add(snapshot.devices[i], snapshot.devices[i].power, &samples[i], now);
+    }
+    size_t sampledLen = sampled.finish();
+
+    TelemetryBatch batch;
+    if (sampledLen == 0 || telemetryDecode(withSamples, sampledLen, batch) != sampledLen ||
+        batch.rows.size() != snapshot.count) {
+        printf("HATA: aralik blogu cozulemedi\n");
+        return false;
+    }
+    for (size_t i = 0; i < snapshot.count; i++) {
+        const TelemetryRow& row = batch.rows[i];
+        for (int m = 0; m < SAMPLE_METRIC_COUNT; m++) {
+            const MetricAggregate& agg = samples[i].stats[m];
+            float scale = TELEMETRY_FIELDS[TELEMETRY_SAMPLE_METRICS[m].field].scale;
+            if (!row.stats[m].present || row.stats[m].count != agg.count ||
+                fabs(row.stats[m].min - agg.min) > scale || fabs(row.stats[m].max - agg.max) > scale ||
+                fabs(row.stats[m].mean - agg.mean()) > scale) {
+                printf("HATA: %s aralik istatistigi uyusmuyor\n", TELEMETRY_SAMPLE_METRICS[m].name);
+                return false;
+            }
+        }
+        if (row.samples.size() != samples[i].ring.size()) {
+            printf("HATA: ham ornek sayisi uyusmuyor (%zu != %zu)\n", row.samples.size(), samples[i].ring.size());
+            return false;
+        }
+        for (size_t s = 0; s < row.samples.size(); s++) {
+            const TelemetrySample& src = samples[i].ring[s];
+            if (row.samples[s].ageMs != (now - src.timestamp) / 100 * 100 ||
+                fabs(row.samples[s].values[SM_VOLTAGE] - src.values[SM_VOLTAGE]) > 0.01) {
+                printf("HATA: ham ornek %zu uyusmuyor\n", s);
+                return false;
+            }
+        }
+    }
+
+    printf("aralik blogu (%zu cihaz, %zu ham ornek/cihaz): ikili %zu -> %zu byte\n", snapshot.count,
+           samples[0].ring.size(), plainLen, sampledLen);
+    return true;
+}
+
+bool runTelemetryCase(const VictronSnapshot& snapshot, long iterations) {
+    static uint8_t binary[2048];
+    TelemetryEncoder encoder(binary, sizeof(binary));
+    size_t binaryLen = 0;
+
+    auto t0 = std::chrono::steady_clock::now();
+    for (long n = 0; n < iterations; n++) {
+        encoder.begin(BENCH_BOAT);
+        for (size_t i = 0; i < snapshot.count; i++) {
+            const VictronData& d = snapshot.devices[i];
+            encoder.add(d, d.power);
+        }
+        binaryLen = encoder.finish();
+    }
+    auto t1 = std::chrono::steady_clock::now();
+
+    TelemetryBatch batch;
+    if (binaryLen == 0 || telemetryDecode(binary, binaryLen, batch) != binaryLen || batch.rows.size() != snapshot.count ||
+        batch.boatName != BENCH_BOAT) {
+        printf("HATA: ikili telemetri cozulemedi\n");
+        return false;
+    }
+    for (size_t i = 0; i < snapshot.count; i++) {
+        const VictronData& d = snapshot.devices[i];
+        const TelemetryRow& row = batch.rows[i];
+        if (row.deviceType != (int)d.type) {
+            printf("HATA: device_type uyusmuyor (%d != %d)\n", row.deviceType, (int)d.type);
+            return false;
+        }
+        for (int f = 0; f < TELEMETRY_FIELD_COUNT; f++) {
+            double expected = fieldValue(d, f);
+            if (fabs(row.values[f] - expected) > TELEMETRY_FIELDS[f].scale) {
+                printf("HATA: %s alani uyusmuyor (%.3f != %.3f)\n", TELEMETRY_FIELDS[f].name, row.values[f], expected);
+                return false;
+            }
+        }
+    }
+
+    if (!runSamplesCase(snapshot)) return false;
+
+    // Referans cozucunun JSON'u firmware'in ingest_telemetry govdesiyle ayni sekilde
+    std::string json = telemetryToJson({batch});
+    static uint8_t deflated[8192];
+    size_t deflatedLen = 0;
+    auto t2 = std::chrono::steady_clock::now();
+    for (long n = 0; n < iterations; n++) {
+        deflatedLen = telemetryDeflate((const uint8_t*)json.data(), json.size(), deflated, sizeof(deflated));
+    }
+    auto t3 = std::chrono::steady_clock::now();
+    if (deflatedLen == 0) {
+        printf("HATA: deflate basarisiz\n");
+        return false;
+    }
+
+    double encodeUs = std::chrono::duration<double, std::micro>(t1 - t0).count() / (double)iterations;
+    double deflateUs = std::chrono::duration<double, std::micro>(t3 - t2).count() / (double)iterations;
+    printf("telemetri (%zu cihaz): JSON %zu byte, deflate %zu byte (%.1f us), ikili %zu byte (%.2f us)\n",
+           snapshot.count, json.size(), deflatedLen, deflateUs, binaryLen, encodeUs);
+
+    // Istege bagli: deflate ciktisini dosyaya yaz (zlib ile dogrulamak icin)
+    if (const char* path = getenv("TELEMETRY_DEFLATE_OUT")) {
+        FILE* f = fopen(path, "wb");
+        if (f) {
+            fwrite(deflated, 1, deflatedLen, f);
+            fclose(f);
+        }
+        std::string jsonPath = std::string(path) + ".json";
+        f = fopen(jsonPath.c_str(), "wb");
+        if (f) {
+            fwrite(json.data(), 1, json.size(), f);
+            fclose(f);
+        }
+    }
+    return true;
+}
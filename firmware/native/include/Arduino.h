@@ -0,0 +1,105 @@
+#ifndef NATIVE_ARDUINO_H
+#define NATIVE_ARDUINO_H
+
+// Host (Linux) icin ince Arduino shim'i.
+// Sadece VictronBLE decode hattinin kullandigi API'yi taklit eder;
+// [env:native] ile benchmark derlemek icindir, cihazda kullanilmaz.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <string>
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+long random(long howbig);
+long random(long howsmall, long howbig);
+
+class String {
+public:
+    String() {}
+    String(const char* s) : s_(s ? s : "") {}
+    String(const std::string& s) : s_(s) {}
+    String(char c) : s_(1, c) {}
+    String(int v) : s_(std::to_string(v)) {}
+    String(unsigned int v) : s_(std::to_string(v)) {}
+    String(long v) : s_(std::to_string(v)) {}
+    String(unsigned long v) : s_(std::to_string(v)) {}
+
+    const char* c_str() const { return s_.c_str(); }
+    unsigned int length() const { return (unsigned int)s_.length(); }
+    char operator[](unsigned int i) const { return s_[i]; }
+    char charAt(unsigned int i) const { return s_[i]; }
+
+    String substring(unsigned int from) const { return from >= s_.length() ? String() : String(s_.substr(from)); }
+    String substring(unsigned int from, unsigned int to) const {
+        if (from >= s_.length() || to <= from) return String();
+        return String(s_.substr(from, to - from));
+    }
+    int indexOf(char c) const { size_t p = s_.find(c); return p == std::string::npos ? -1 : (int)p; }
+    int indexOf(const String& str) const { size_t p = s_.find(str.s_); return p == std::string::npos ? -1 : (int)p; }
+    bool endsWith(const String& suffix) const {
+        return s_.size() >= suffix.s_.size() && s_.compare(s_.size() - suffix.s_.size(), suffix.s_.size(), suffix.s_) == 0;
+    }
+    bool startsWith(const String& prefix) const { return s_.compare(0, prefix.s_.size(), prefix.s_) == 0; }
+
+    void trim() {
+        size_t b = s_.find_first_not_of(" \t\r\n");
+        size_t e = s_.find_last_not_of(" \t\r\n");
+        s_ = (b == std::string::npos) ? std::string() : s_.substr(b, e - b + 1);
+    }
+    void toLowerCase() { for (auto& c : s_) if (c >= 'A' && c <= 'Z') c = c - 'A' + 'a'; }
+    void toUpperCase() { for (auto& c : s_) if (c >= 'a' && c <= 'z') c = c - 'a' + 'A'; }
+    void replace(const String& from, const String& to) {
+        if (from.s_.empty()) return;
+        size_t pos = 0;
+        while ((pos = s_.find(from.s_, pos)) != std::string::npos) {
+            s_.replace(pos, from.s_.size(), to.s_);
+            pos += to.s_.size();
+        }
+    }
+
+    String& operator+=(const String& o) { s_ += o.s_; return *this; }
+    String& operator+=(const char* o) { s_ += o; return *this; }
+    String& operator+=(char c) { s_ += c; return *this; }
+
+    friend String operator+(const String& a, const String& b) { return String(a.s_ + b.s_); }
+    friend String operator+(const char* a, const String& b) { return String(std::string(a) + b.s_); }
+    friend String operator+(const String& a, const char* b) { return String(a.s_ + b); }
+    friend bool operator==(const String& a, const String& b) { return a.s_ == b.s_; }
+    friend bool operator!=(const String& a, const String& b) { return a.s_ != b.s_; }
+    friend bool operator<(const String& a, const String& b) { return a.s_ < b.s_; }
+
+private:
+    std::string s_;
+};
+
+// Serial: Host'ta cikti atilir, sadece yazilan byte sayisi tutulur.
+// Boylece benchmark, hot path'in UART'a ne kadar yuk bindirdigini de raporlar.
+class HardwareSerial {
+public:
+    void begin(unsigned long) {}
+    size_t printf(const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+    size_t print(const char* s);
+    size_t print(const String& s) { return print(s.c_str()); }
+    size_t println(const char* s = "");
+    size_t println(const String& s) { return println(s.c_str()); }
+
+    size_t bytesWritten = 0;
+    bool echo = false; // true ise stdout'a da yazar
+};
+
+extern HardwareSerial Serial;
+
+class EspClass {
+public:
+    uint32_t getFreeHeap() { return 0; }
+    void restart() { exit(0); }
+};
+
+extern EspClass ESP;
+
+#endif
@@ -0,0 +1,83 @@
+#ifndef NATIVE_FS_H
+#define NATIVE_FS_H
+
+// Host icin Arduino FS shim'i: dosyalar gercek dosya sistemine, kok dizin
+// altina yazilir (LittleFS.setRoot). Sadece TelemetryQueue'nun kullandigi
+// API'yi taklit eder.
+
+#include <Arduino.h>
+#include <stdio.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace fs {
+
+class File {
+public:
+    File() {}
+    File(FILE* fp, const std::string& path) : m_fp(fp, &fclose), m_path(path) {}
+    File(const std::string& path, const std::vector<std::string>& entries, const std::string& root)
+        : m_path(path), m_entries(new std::vector<std::string>(entries)), m_root(root), m_isDir(true) {}
+
+    explicit operator bool() const { return m_fp != nullptr || m_isDir; }
+    bool isDirectory() const { return m_isDir; }
+
+    size_t read(uint8_t* buf, size_t size) { return m_fp ? fread(buf, 1, size, m_fp.get()) : 0; }
+    size_t write(const uint8_t* buf, size_t size) { return m_fp ? fwrite(buf, 1, size, m_fp.get()) : 0; }
+    bool seek(uint32_t pos) { return m_fp && fseek(m_fp.get(), pos, SEEK_SET) == 0; }
+    size_t position() const { return m_fp ? (size_t)ftell(m_fp.get()) : 0; }
+    size_t size() const {
+        if (!m_fp) return 0;
+        long cur = ftell(m_fp.get());
+        fseek(m_fp.get(), 0, SEEK_END);
+        long end = ftell(m_fp.get());
+        fseek(m_fp.get(), cur, SEEK_SET);
+        return (size_t)end;
+    }
+    void flush() { if (m_fp) fflush(m_fp.get()); }
+    void close() { m_fp.reset(); m_isDir = false; }
+
+    // ESP32 core 2.x gibi: sadece dosya adi (dizin yok)
+    const char* name() const {
+        size_t slash = m_path.rfind('/');
+        return m_path.c_str() + (slash == std::string::npos ? 0 : slash + 1);
+    }
+    const char* path() const { return m_path.c_str(); }
+
+    File openNextFile();
+
+private:
+    std::shared_ptr<FILE> m_fp;
+    std::string m_path;
+    std::shared_ptr<std::vector<std::string>> m_entries;
+    std::string m_root;
+    size_t m_next = 0;
+    bool m_isDir = false;
+};
+
+class FS {
+public:
+    void setRoot(const std::string& root) { m_root = root; }
+    File open(const char* path, const char* mode = "r");
+    File open(const String& path, const char* mode = "r") { return open(path.c_str(), mode); }
+    bool exists(const char* path);
+    bool exists(const String& path) { return exists(path.c_str()); }
+    bool remove(const char* path);
+    bool remove(const String& path) { return remove(path.c_str()); }
+    bool rename(const char* from, const char* to);
+    bool rename(const String& from, const String& to) { return rename(from.c_str(), to.c_str()); }
+    bool mkdir(const char* path);
+    bool mkdir(const String& path) { return mkdir(path.c_str()); }
+
+protected:
+    std::string m_root = "/tmp/native-littlefs";
+    std::string full(const char* path) const { return m_root + path; }
+};
+
+} // namespace fs
+
+using fs::File;
+using fs::FS;
+
+#endif
@@ -0,0 +1,18 @@
+#ifndef NATIVE_LITTLEFS_H
+#define NATIVE_LITTLEFS_H
+
+#include "FS.h"
+
+class LittleFSFS : public fs::FS {
+public:
+    bool begin(bool formatOnFail = false, const char* basePath = "/littlefs", uint8_t maxOpenFiles = 10,
+               const char* partitionLabel = "spiffs");
+    bool format();
+    size_t totalBytes() { return 896 * 1024; }
+    size_t usedBytes() { return 0; }
+    void end() {}
+};
+
+extern LittleFSFS LittleFS;
+
+#endif
@@ -0,0 +1,108 @@
+#ifndef NATIVE_NIMBLE_DEVICE_H
+#define NATIVE_NIMBLE_DEVICE_H
+
+// Host icin NimBLE-Arduino shim'i. Gercek radyo yok; benchmark
+// reklamlari NimBLEAdvertisedDevice olarak elle olusturup onResult'a verir.
+
+#include <Arduino.h>
+#include <stdio.h>
+#include <string>
+
+// NimBLE ile ayni bellek duzeni: m_address[0] son oktet (little-endian),
+// uint64_t donusumu 0xAABBCCDDEEFF verir.
+class NimBLEAddress {
+public:
+    NimBLEAddress() {}
+    NimBLEAddress(const uint64_t& address) { memcpy(m_address, &address, 6); }
+
+    // NimBLE ile ayni: kucuk harf, "aa:bb:cc:dd:ee:ff"
+    std::string toString() const {
+        char buf[18];
+        snprintf(buf, sizeof(buf), "%02x:%02x:%02x:%02x:%02x:%02x",
+                 m_address[5], m_address[4], m_address[3],
+                 m_address[2], m_address[1], m_address[0]);
+        return std::string(buf);
+    }
+    const uint8_t* getNative() const { return m_address; }
+    operator uint64_t() const {
+        uint64_t address = 0;
+        memcpy(&address, m_address, 6);
+        return address;
+    }
+
+private:
+    uint8_t m_address[6] = {0};
+};
+
+// Reklam, ham AD yapilari olarak tutulur (Flags + Manufacturer Data),
+// getPayload() gercek NimBLE gibi bu ham byte'lari dondurur.
+class NimBLEAdvertisedDevice {
+public:
+    NimBLEAdvertisedDevice(const NimBLEAddress& address, const std::string& manufacturerData, int rssi = -70)
+        : m_address(address), m_rssi(rssi) { setManufacturerData(manufacturerData); }
+
+    bool haveManufacturerData() const { return m_manufacturerOffset != 0; }
+    std::string getManufacturerData() const {
+        if (!haveManufacturerData()) return std::string();
+        return m_payload.substr(m_manufacturerOffset, (uint8_t)m_payload[m_manufacturerOffset - 2] - 1);
+    }
+    NimBLEAddress getAddress() const { return m_address; }
+    int getRSSI() const { return m_rssi; }
+    uint8_t* getPayload() { return (uint8_t*)m_payload.data(); }
+    size_t getPayloadLength() const { return m_payload.size(); }
+
+    void setManufacturerData(const std::string& data) {
+        m_payload = std::string("\x02\x01\x06", 3);
+        m_payload += (char)(data.size() + 1);
+        m_payload += (char)0xFF;
+        m_manufacturerOffset = m_payload.size();
+        m_payload += data;
+    }
+    void setRSSI(int rssi) { m_rssi = rssi; }
+
+private:
+    NimBLEAddress m_address;
+    std::string m_payload;
+    size_t m_manufacturerOffset = 0;
+    int m_rssi;
+};
+
+class NimBLEAdvertisedDeviceCallbacks {
+public:
+    virtual ~NimBLEAdvertisedDeviceCallbacks() {}
+    virtual void onResult(NimBLEAdvertisedDevice* advertisedDevice) = 0;
+};
+
+class NimBLEScanResults {};
+
+class NimBLEScan {
+public:
+    void setAdvertisedDeviceCallbacks(NimBLEAdvertisedDeviceCallbacks* cb, bool wantDuplicates = false) {
+        m_callbacks = cb;
+        (void)wantDuplicates;
+    }
+    void setActiveScan(bool) {}
+    void setInterval(uint16_t) {}
+    void setWindow(uint16_t) {}
+    void setDuplicateFilter(bool) {}
+    void setMaxResults(uint8_t) {}
+    bool isScanning() { return m_scanning; }
+    bool start(uint32_t, void (*)(NimBLEScanResults), bool = false) { m_scanning = true; return true; }
+    bool stop() { m_scanning = false; return true; }
+    void clearResults() {}
+
+private:
+    NimBLEAdvertisedDeviceCallbacks* m_callbacks = nullptr;
+    bool m_scanning = false;
+};
+
+class NimBLEDevice {
+public:
+    static void init(const std::string&) {}
+    static NimBLEScan* getScan() {
+        static NimBLEScan scan;
+        return &scan;
+    }
+};
+
+#endif
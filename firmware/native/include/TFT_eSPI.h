@@ -0,0 +1,116 @@
+#ifndef NATIVE_TFT_ESPI_H
+#define NATIVE_TFT_ESPI_H
+
+// Host icin TFT_eSPI shim'i: piksel cizmez, panele (SPI) gidecek trafigi sayar.
+//
+// ST7789 modeli: her pencere CASET + RASET + RAMWR (11 byte komut/adres),
+// piksel basina 2 byte (16 bit renk). GLCD font (font 1) arka planli
+// yazilirsa size 1'de karakter basina tek pencere, size > 1'de her font
+// pikseli icin ayri size x size fillRect (kutuphanenin yolu). Sprite'a
+// cizim sayilmaz; pushSprite bir pencere olarak sayilir.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+
+#define TFT_BLACK       0x0000
+#define TFT_NAVY        0x000F
+#define TFT_DARKGREEN   0x03E0
+#define TFT_BLUE        0x001F
+#define TFT_GREEN       0x07E0
+#define TFT_CYAN        0x07FF
+#define TFT_RED         0xF800
+#define TFT_MAGENTA     0xF81F
+#define TFT_YELLOW      0xFFE0
+#define TFT_WHITE       0xFFFF
+#define TFT_ORANGE      0xFDA0
+#define TFT_DARKGREY    0x7BEF
+#define TFT_LIGHTGREY   0xD69A
+
+#define TL_DATUM 0
+#define TC_DATUM 1
+#define TR_DATUM 2
+
+#ifndef TFT_WIDTH
+#define TFT_WIDTH 135
+#endif
+#ifndef TFT_HEIGHT
+#define TFT_HEIGHT 240
+#endif
+
+// Sadece shim: panele giden trafik
+struct TFTBusStats {
+    uint64_t windows = 0;   // setAddrWindow sayisi
+    uint64_t pixels = 0;    // Panele yazilan piksel
+    uint64_t bytes = 0;     // SPI byte (komut + piksel)
+};
+
+class TFT_eSPI {
+public:
+    TFT_eSPI(int16_t w = TFT_WIDTH, int16_t h = TFT_HEIGHT) : _width(w), _height(h), _initW(w), _initH(h) {}
+    virtual ~TFT_eSPI() {}
+
+    void init(uint8_t tc = 0) { (void)tc; }
+    void setRotation(uint8_t r);
+    int16_t width() const { return _width; }
+    int16_t height() const { return _height; }
+
+    void fillScreen(uint32_t color) { fillRect(0, 0, _width, _height, color); }
+    void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+    void drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+    void drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color);
+
+    void setTextColor(uint16_t fg, uint16_t bg, bool bgfill = false) {
+        (void)bgfill;
+        textFg = fg;
+        textBg = bg;
+    }
+    void setTextColor(uint16_t fg) { textFg = textBg = fg; }
+    void setTextSize(uint8_t size) { textSize = size ? size : 1; }
+    void setTextDatum(uint8_t datum) { textDatum = datum; }
+    int16_t textWidth(const char* text, uint8_t font = 1) const;
+    int16_t fontHeight(uint8_t font = 1) const { (void)font; return 8 * textSize; }
+    int16_t drawString(const char* text, int32_t x, int32_t y, uint8_t font = 1);
+
+    const TFTBusStats& busStats() const { return bus; }
+    void resetBusStats() { bus = TFTBusStats(); }
+
+protected:
+    friend class TFT_eSprite;
+
+    // Panel penceresi (kirpilmis); sprite'ta sayilmaz
+    void pushWindow(int32_t x, int32_t y, int32_t w, int32_t h);
+
+    bool isSprite = false;
+    TFT_eSPI* panel = this; // Sprite: sayaclarin tutuldugu panel
+    int16_t _width, _height;
+    int16_t _initW, _initH;
+    uint16_t textFg = TFT_WHITE, textBg = TFT_BLACK;
+    uint8_t textSize = 1;
+    uint8_t textDatum = TL_DATUM;
+    TFTBusStats bus;
+};
+
+class TFT_eSprite : public TFT_eSPI {
+public:
+    explicit TFT_eSprite(TFT_eSPI* tft) : TFT_eSPI(0, 0) {
+        isSprite = true;
+        panel = tft;
+    }
+
+    void* setColorDepth(int8_t bits) {
+        depth = bits;
+        return nullptr;
+    }
+    void* createSprite(int16_t w, int16_t h, uint8_t frames = 1);
+    void deleteSprite();
+    void fillSprite(uint32_t color) { fillRect(0, 0, _width, _height, color); }
+    void pushSprite(int32_t x, int32_t y) { pushSprite(x, y, 0, 0, _width, _height); }
+    bool pushSprite(int32_t tx, int32_t ty, int32_t sx, int32_t sy, int32_t sw, int32_t sh);
+
+private:
+    int8_t depth = 16;
+    std::vector<uint8_t> buffer;
+};
+
+#endif
@@ -0,0 +1,36 @@
+#ifndef NATIVE_MBEDTLS_AES_H
+#define NATIVE_MBEDTLS_AES_H
+
+// Host icin mbedtls/aes.h shim'i. Sadece firmware'in kullandigi
+// sifreleme yonu (ECB encrypt + CTR) yazilimsal olarak gerceklenir.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define MBEDTLS_AES_ENCRYPT 1
+#define MBEDTLS_AES_DECRYPT 0
+#define MBEDTLS_ERR_AES_INVALID_KEY_LENGTH -0x0020
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct mbedtls_aes_context {
+    int nr;             // Tur sayisi (10/12/14)
+    uint32_t rk[60];    // Genisletilmis anahtar (key schedule)
+} mbedtls_aes_context;
+
+void mbedtls_aes_init(mbedtls_aes_context* ctx);
+void mbedtls_aes_free(mbedtls_aes_context* ctx);
+int mbedtls_aes_setkey_enc(mbedtls_aes_context* ctx, const unsigned char* key, unsigned int keybits);
+int mbedtls_aes_crypt_ecb(mbedtls_aes_context* ctx, int mode,
+                          const unsigned char input[16], unsigned char output[16]);
+int mbedtls_aes_crypt_ctr(mbedtls_aes_context* ctx, size_t length, size_t* nc_off,
+                          unsigned char nonce_counter[16], unsigned char stream_block[16],
+                          const unsigned char* input, unsigned char* output);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
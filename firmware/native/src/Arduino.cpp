@@ -0,0 +1,57 @@
+#include <Arduino.h>
+#include <stdio.h>
+#include <chrono>
+#include <thread>
+
+HardwareSerial Serial;
+EspClass ESP;
+
+static const auto bootTime = std::chrono::steady_clock::now();
+
+unsigned long millis() {
+    return (unsigned long)std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - bootTime).count();
+}
+
+unsigned long micros() {
+    return (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - bootTime).count();
+}
+
+void delay(unsigned long ms) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+long random(long howbig) {
+    return howbig <= 0 ? 0 : (long)(rand() % howbig);
+}
+
+long random(long howsmall, long howbig) {
+    return howsmall >= howbig ? howsmall : howsmall + random(howbig - howsmall);
+}
+
+size_t HardwareSerial::printf(const char* fmt, ...) {
+    char buf[256];
+    va_list args;
+    va_start(args, fmt);
+    int n = vsnprintf(buf, sizeof(buf), fmt, args);
+    va_end(args);
+    if (n < 0) return 0;
+    bytesWritten += (size_t)n;
+    if (echo) fputs(buf, stdout);
+    return (size_t)n;
+}
+
+size_t HardwareSerial::print(const char* s) {
+    size_t n = strlen(s);
+    bytesWritten += n;
+    if (echo) fputs(s, stdout);
+    return n;
+}
+
+size_t HardwareSerial::println(const char* s) {
+    size_t n = print(s) + 2;
+    bytesWritten += 2;
+    if (echo) fputs("\n", stdout);
+    return n;
+}
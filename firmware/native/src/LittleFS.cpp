@@ -0,0 +1,59 @@
+#include <LittleFS.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <algorithm>
+
+LittleFSFS LittleFS;
+
+namespace fs {
+
+File File::openNextFile() {
+    if (!m_entries || m_next >= m_entries->size()) return File();
+    std::string path = m_path + "/" + (*m_entries)[m_next++];
+    FILE* fp = fopen((m_root + path).c_str(), "rb");
+    return fp ? File(fp, path) : File();
+}
+
+File FS::open(const char* path, const char* mode) {
+    std::string p = full(path);
+    struct stat st;
+    if (mode[0] == 'r' && stat(p.c_str(), &st) == 0 && S_ISDIR(st.st_mode)) {
+        std::vector<std::string> entries;
+        if (DIR* dir = opendir(p.c_str())) {
+            while (dirent* e = readdir(dir)) {
+                if (e->d_name[0] != '.') entries.push_back(e->d_name);
+            }
+            closedir(dir);
+        }
+        std::sort(entries.begin(), entries.end());
+        return File(path, entries, m_root);
+    }
+
+    const char* m = mode[0] == 'w' ? "wb" : mode[0] == 'a' ? "ab" : "rb";
+    FILE* fp = fopen(p.c_str(), m);
+    return fp ? File(fp, path) : File();
+}
+
+bool FS::exists(const char* path) {
+    struct stat st;
+    return stat(full(path).c_str(), &st) == 0;
+}
+
+bool FS::remove(const char* path) { return ::remove(full(path).c_str()) == 0; }
+
+bool FS::rename(const char* from, const char* to) { return ::rename(full(from).c_str(), full(to).c_str()) == 0; }
+
+bool FS::mkdir(const char* path) { return ::mkdir(full(path).c_str(), 0755) == 0 || exists(path); }
+
+} // namespace fs
+
+bool LittleFSFS::begin(bool, const char*, uint8_t, const char*) {
+    ::mkdir(m_root.c_str(), 0755);
+    return true;
+}
+
+bool LittleFSFS::format() {
+    std::string cmd = "rm -rf '" + m_root + "'";
+    if (system(cmd.c_str()) != 0) return false;
+    return begin();
+}
@@ -0,0 +1,97 @@
+#include <TFT_eSPI.h>
+#include <string.h>
+
+static const int WINDOW_OVERHEAD_BYTES = 11; // CASET(1+4) + RASET(1+4) + RAMWR(1)
+
+void TFT_eSPI::setRotation(uint8_t r) {
+    bool landscape = r & 1;
+    _width = landscape ? _initH : _initW;
+    _height = landscape ? _initW : _initH;
+}
+
+void TFT_eSPI::pushWindow(int32_t x, int32_t y, int32_t w, int32_t h) {
+    if (isSprite) return;
+    // Panel disina tasan kisim kirpilir
+    if (x < 0) { w += x; x = 0; }
+    if (y < 0) { h += y; y = 0; }
+    if (x + w > _width) w = _width - x;
+    if (y + h > _height) h = _height - y;
+    if (w <= 0 || h <= 0) return;
+
+    bus.windows++;
+    bus.pixels += (uint64_t)w * h;
+    bus.bytes += WINDOW_OVERHEAD_BYTES + (uint64_t)w * h * 2;
+}
+
+void TFT_eSPI::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+    (void)color;
+    pushWindow(x, y, w, h);
+}
+
+void TFT_eSPI::drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+    (void)color;
+    pushWindow(x, y, w, 1);
+    pushWindow(x, y + h - 1, w, 1);
+    pushWindow(x, y + 1, 1, h - 2);
+    pushWindow(x + w - 1, y + 1, 1, h - 2);
+}
+
+void TFT_eSPI::drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color) {
+    (void)color;
+    if (y0 == y1) {
+        pushWindow(x0 < x1 ? x0 : x1, y0, (x1 > x0 ? x1 - x0 : x0 - x1) + 1, 1);
+    } else if (x0 == x1) {
+        pushWindow(x0, y0 < y1 ? y0 : y1, 1, (y1 > y0 ? y1 - y0 : y0 - y1) + 1);
+    } else {
+        // Capraz cizgi: piksel basina pencere
+        int32_t dx = x1 > x0 ? x1 - x0 : x0 - x1;
+        int32_t dy = y1 > y0 ? y1 - y0 : y0 - y1;
+        int32_t n = (dx > dy ? dx : dy) + 1;
+        for (int32_t i = 0; i < n; i++) pushWindow(x0 + (x1 - x0) * i / (n - 1), y0 + (y1 - y0) * i / (n - 1), 1, 1);
+    }
+}
+
+int16_t TFT_eSPI::textWidth(const char* text, uint8_t font) const {
+    (void)font;
+    return (int16_t)(strlen(text) * 6 * textSize);
+}
+
+int16_t TFT_eSPI::drawString(const char* text, int32_t x, int32_t y, uint8_t font) {
+    int16_t w = textWidth(text, font);
+    if (textDatum == TR_DATUM) x -= w;
+    else if (textDatum == TC_DATUM) x -= w / 2;
+
+    bool fillBg = textFg != textBg;
+    for (size_t i = 0; text[i] != '\0'; i++) {
+        int32_t cx = x + (int32_t)i * 6 * textSize;
+        if (textSize == 1 && fillBg) {
+            pushWindow(cx, y, 6, 8);
+        } else {
+            // Buyutulmus font: font pikseli basina fillRect (arka plan dahil)
+            for (int p = 0; p < 6 * 8; p++) {
+                pushWindow(cx + (p % 6) * textSize, y + (p / 6) * textSize, textSize, textSize);
+            }
+        }
+    }
+    return w;
+}
+
+void* TFT_eSprite::createSprite(int16_t w, int16_t h, uint8_t frames) {
+    (void)frames;
+    buffer.assign((size_t)w * h * (depth == 16 ? 2 : 1), 0);
+    _width = _initW = w;
+    _height = _initH = h;
+    return buffer.data();
+}
+
+void TFT_eSprite::deleteSprite() {
+    buffer.clear();
+    buffer.shrink_to_fit();
+    _width = _height = 0;
+}
+
+bool TFT_eSprite::pushSprite(int32_t tx, int32_t ty, int32_t sx, int32_t sy, int32_t sw, int32_t sh) {
+    if (buffer.empty() || sx < 0 || sy < 0 || sx + sw > _width || sy + sh > _height) return false;
+    panel->pushWindow(tx, ty, sw, sh);
+    return true;
+}
@@ -0,0 +1,120 @@
+# web/ altindaki arayuz dosyalarini gzip'leyip src/WebAssets.h'e gomer.
+#
+# PlatformIO derlemeden once calistirir (extra_scripts = pre:...); elle de
+# calistirilabilir:  python3 scripts/embed_web.py
+#
+# - Her dosya gzip (seviye 9, mtime=0: ayni girdi -> ayni cikti) ile sikistirilir.
+# - ETag icerigin SHA-256 ozetinin ilk 8 hanesidir.
+# - index.html disindaki dosyalar ozetli adla yayinlanir (/settings.<ozet>.js);
+#   index.html'deki {{settings.js}} yer tutucusu bu adla degistirilir. Ozetli
+#   adlar degismez (immutable) diye uzun sureli onbelleklenir, index ise her
+#   seferinde ETag ile dogrulanir.
+# - Cikti degismediyse dosyaya yazilmaz (gereksiz yeniden derleme olmaz).
+
+import gzip
+import hashlib
+import os
+
+try:
+    Import("env")  # noqa: F821 (PlatformIO / SCons)
+    PROJECT_DIR = env.subst("$PROJECT_DIR")  # noqa: F821
+except NameError:
+    PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+WEB_DIR = os.path.join(PROJECT_DIR, "web")
+OUTPUT = os.path.join(PROJECT_DIR, "src", "WebAssets.h")
+
+# (kaynak, icerik tipi, ozetli ad) - index.html en sonda: diger adlar ona yazilir
+ASSETS = [
+    ("settings.js", "application/javascript", True),
+    ("index.html", "text/html", False),
+]
+
+
+def content_hash(data):
+    return hashlib.sha256(data).hexdigest()[:8]
+
+
+def c_name(name):
+    return "web_" + name.replace(".", "_").replace("-", "_") + "_gz"
+
+
+def c_bytes(data):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("    " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+    return "\n".join(lines)
+
+
+def build():
+    urls = {}
+    entries = []
+    raw_total = 0
+    gz_total = 0
+    for name, content_type, hashed in ASSETS:
+        with open(os.path.join(WEB_DIR, name), "rb") as f:
+            data = f.read()
+        for placeholder, url in urls.items():
+            data = data.replace(("{{%s}}" % placeholder).encode(), url.encode())
+
+        digest = content_hash(data)
+        if hashed:
+            stem, ext = os.path.splitext(name)
+            url = "/%s.%s%s" % (stem, digest, ext)
+        else:
+            url = "/" + name
+        urls[name] = url
+
+        packed = gzip.compress(data, compresslevel=9, mtime=0)
+        raw_total += len(data)
+        gz_total += len(packed)
+        entries.append((name, url, content_type, digest, hashed, packed, len(data)))
+
+    out = []
+    out.append("// Bu dosya scripts/embed_web.py tarafindan web/ klasorunden uretilir, elle duzenlemeyin.")
+    out.append("// %d dosya: %d byte -> gzip %d byte" % (len(entries), raw_total, gz_total))
+    out.append("")
+    out.append("#ifndef WEB_ASSETS_H")
+    out.append("#define WEB_ASSETS_H")
+    out.append("")
+    out.append("#include <Arduino.h>")
+    out.append("")
+    out.append("struct WebAsset {")
+    out.append("    const char* path;         // Yayin adresi")
+    out.append("    const char* contentType;")
+    out.append("    const uint8_t* data;      // gzip")
+    out.append("    size_t length;")
+    out.append("    const char* etag;         // Icerik ozeti (tirnakli)")
+    out.append("    bool immutable;           // Ozetli ad: uzun sureli onbellek")
+    out.append("};")
+    out.append("")
+    for name, url, content_type, digest, hashed, packed, raw_len in entries:
+        out.append("// %s -> %s (%d -> %d byte)" % (name, url, raw_len, len(packed)))
+        out.append("static const uint8_t %s[] PROGMEM = {" % c_name(name))
+        out.append(c_bytes(packed))
+        out.append("};")
+        out.append("")
+    out.append("static const WebAsset WEB_ASSETS[] = {")
+    for name, url, content_type, digest, hashed, packed, raw_len in entries:
+        out.append('    {"%s", "%s", %s, sizeof(%s), "\\"%s\\"", %s},' % (
+            url, content_type, c_name(name), c_name(name), digest, "true" if hashed else "false"))
+    out.append("};")
+    out.append("static const size_t WEB_ASSET_COUNT = sizeof(WEB_ASSETS) / sizeof(WEB_ASSETS[0]);")
+    index_pos = [e[0] for e in entries].index("index.html")
+    out.append("static const WebAsset& WEB_INDEX_ASSET = WEB_ASSETS[%d];" % index_pos)
+    out.append("")
+    out.append("#endif")
+    text = "\n".join(out) + "\n"
+
+    old = None
+    if os.path.exists(OUTPUT):
+        with open(OUTPUT, "r") as f:
+            old = f.read()
+    if old != text:
+        with open(OUTPUT, "w") as f:
+            f.write(text)
+    print("embed_web: %d byte -> gzip %d byte (%s)" % (raw_total, gz_total,
+                                                       ", ".join(e[1] for e in entries)))
+
+
+build()
@@ -0,0 +1,85 @@
+#include "AppLog.h"
+#include <mutex>
+
+// Satirlar "[millis] S mesaj\n" olarak bayt halkasina yazilir.
+// Yazma loop, async_tcp ve NimBLE task'larindan gelebilir; kilit sadece
+// kopyalama sirasinda tutulur, formatlama kilit disinda yapilir.
+
+static char logRing[APP_LOG_BUFFER_SIZE];
+static size_t logStart = 0; // En eski satirin basi
+static size_t logUsed = 0;
+static uint32_t logLines = 0;
+static uint32_t logDropped = 0;
+static std::mutex logMutex;
+
+static const char LEVEL_CHARS[] = {'-', 'E', 'W', 'I', 'D', 'V'};
+
+// En eski satiri at (kilit tutulurken cagrilir)
+static void dropOldestLine() {
+    while (logUsed > 0) {
+        char c = logRing[logStart];
+        logStart = (logStart + 1) % APP_LOG_BUFFER_SIZE;
+        logUsed--;
+        if (c == '\n') break;
+    }
+    logDropped++;
+}
+
+void appLogWrite(uint8_t level, const char* fmt, ...) {
+    char line[160];
+    int prefix = snprintf(line, sizeof(line), "[%lu] %c ", millis(), LEVEL_CHARS[level <= APP_LOG_VERBOSE ? level : 0]);
+
+    va_list args;
+    va_start(args, fmt);
+    int n = vsnprintf(line + prefix, sizeof(line) - prefix, fmt, args);
+    va_end(args);
+    if (n < 0) return;
+
+    size_t len = (size_t)prefix + (size_t)n;
+    if (len > sizeof(line) - 2) len = sizeof(line) - 2; // Kesildi
+    // Mesajin kendi satir sonunu tek '\n' ile degistir
+    while (len > (size_t)prefix && (line[len - 1] == '\n' || line[len - 1] == '\r')) len--;
+    line[len++] = '\n';
+    line[len] = '\0';
+
+    if (level <= APP_LOG_SERIAL_LEVEL) {
+        Serial.print(line);
+    }
+
+    std::lock_guard<std::mutex> lock(logMutex);
+    while (APP_LOG_BUFFER_SIZE - logUsed < len) dropOldestLine();
+
+    size_t pos = (logStart + logUsed) % APP_LOG_BUFFER_SIZE;
+    size_t first = APP_LOG_BUFFER_SIZE - pos;
+    if (first > len) first = len;
+    memcpy(&logRing[pos], line, first);
+    memcpy(logRing, line + first, len - first);
+    logUsed += len;
+    logLines++;
+}
+
+void appLogDump(String& out) {
+    std::lock_guard<std::mutex> lock(logMutex);
+    char chunk[129];
+    size_t done = 0;
+    while (done < logUsed) {
+        size_t n = logUsed - done;
+        if (n > sizeof(chunk) - 1) n = sizeof(chunk) - 1;
+        for (size_t i = 0; i < n; i++) {
+            chunk[i] = logRing[(logStart + done + i) % APP_LOG_BUFFER_SIZE];
+        }
+        chunk[n] = '\0';
+        out += chunk;
+        done += n;
+    }
+}
+
+uint32_t appLogLineCount() {
+    std::lock_guard<std::mutex> lock(logMutex);
+    return logLines;
+}
+
+uint32_t appLogDroppedLines() {
+    std::lock_guard<std::mutex> lock(logMutex);
+    return logDropped;
+}
@@ -0,0 +1,69 @@
+#ifndef APP_LOG_H
+#define APP_LOG_H
+
+#include <Arduino.h>
+
+// Seviyeli log. APP_LOG_LEVEL'in uzerindeki seviyeler derlenmez (arguman
+// ifadeleri dahil). Acik seviyeler RAM'deki halka tampona yazilir ve
+// /api/logs'tan okunur; sadece APP_LOG_SERIAL_LEVEL ve alti Serial'e de gider.
+//
+// NimBLE'nin log_common.h'i LOG_LEVEL_* tanimladigi icin APP_ oneki kullaniliyor.
+
+#define APP_LOG_NONE    0
+#define APP_LOG_ERROR   1
+#define APP_LOG_WARN    2
+#define APP_LOG_INFO    3
+#define APP_LOG_DEBUG   4
+#define APP_LOG_VERBOSE 5
+
+#ifndef APP_LOG_LEVEL
+#define APP_LOG_LEVEL APP_LOG_INFO
+#endif
+
+#ifndef APP_LOG_SERIAL_LEVEL
+#define APP_LOG_SERIAL_LEVEL APP_LOG_WARN
+#endif
+
+// Halka tampon boyutu (byte). Dolunca en eski satirlar silinir.
+#ifndef APP_LOG_BUFFER_SIZE
+#define APP_LOG_BUFFER_SIZE 4096
+#endif
+
+void appLogWrite(uint8_t level, const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+// Tampondaki satirlari (eskiden yeniye) out'a ekler
+void appLogDump(String& out);
+// Simdiye kadar yazilan ve tasma yuzunden silinen satir sayilari
+uint32_t appLogLineCount();
+uint32_t appLogDroppedLines();
+
+#if APP_LOG_LEVEL >= APP_LOG_ERROR
+#define APP_LOGE(fmt, ...) appLogWrite(APP_LOG_ERROR, fmt, ##__VA_ARGS__)
+#else
+#define APP_LOGE(fmt, ...) do {} while (0)
+#endif
+
+#if APP_LOG_LEVEL >= APP_LOG_WARN
+#define APP_LOGW(fmt, ...) appLogWrite(APP_LOG_WARN, fmt, ##__VA_ARGS__)
+#else
+#define APP_LOGW(fmt, ...) do {} while (0)
+#endif
+
+#if APP_LOG_LEVEL >= APP_LOG_INFO
+#define APP_LOGI(fmt, ...) appLogWrite(APP_LOG_INFO, fmt, ##__VA_ARGS__)
+#else
+#define APP_LOGI(fmt, ...) do {} while (0)
+#endif
+
+#if APP_LOG_LEVEL >= APP_LOG_DEBUG
+#define APP_LOGD(fmt, ...) appLogWrite(APP_LOG_DEBUG, fmt, ##__VA_ARGS__)
+#else
+#define APP_LOGD(fmt, ...) do {} while (0)
+#endif
+
+#if APP_LOG_LEVEL >= APP_LOG_VERBOSE
+#define APP_LOGV(fmt, ...) appLogWrite(APP_LOG_VERBOSE, fmt, ##__VA_ARGS__)
+#else
+#define APP_LOGV(fmt, ...) do {} while (0)
+#endif
+
+#endif
@@ -0,0 +1,106 @@
+#include "ChangeDetector.h"
+#include <math.h>
+#include <string.h>
+
+// Eski sabit esikler (0.2V, %1, 50W, alarm) + sarj durumu.
+// Gurultulu analog alanlar iki ardisik kontrolde (TELEMETRY_MIN_INTERVAL) onaylanir.
+const ChangeRule CHANGE_RULES[CHANGE_RULE_COUNT] = {
+    {TF_VOLTAGE,      0.2f,  0.25f, 2},
+    {TF_SOC,          1.0f,  0.3f,  1},
+    {TF_POWER,        50.0f, 0.3f,  2},
+    {TF_ALARM,        0.5f,  0.0f,  1},
+    {TF_DEVICE_STATE, 0.5f,  0.0f,  1},
+};
+
+DeviceChangeState::DeviceChangeState() {
+    for (int r = 0; r < CHANGE_RULE_COUNT; r++) {
+        sent[r] = 0.0f;
+        band[r] = CHANGE_RULES[r].band;
+        streak[r] = 0;
+    }
+}
+
+int findChangeRule(const char* fieldName) {
+    for (int r = 0; r < CHANGE_RULE_COUNT; r++) {
+        if (strcmp(TELEMETRY_FIELDS[CHANGE_RULES[r].field].name, fieldName) == 0) return r;
+    }
+    return -1;
+}
+
+bool ChangeDetector::setBand(uint64_t mac, const char* fieldName, float band) {
+    return setBand(mac, findChangeRule(fieldName), band);
+}
+
+bool ChangeDetector::setBand(uint64_t mac, int rule, float band) {
+    if (rule < 0 || rule >= CHANGE_RULE_COUNT || !(band > 0.0f)) return false; // NaN de reddedilir
+    DeviceChangeState* state = states.insert(mac);
+    if (state == nullptr) return false;
+    state->band[rule] = band;
+    state->configured = true;
+    return true;
+}
+
+void ChangeDetector::clearBands() {
+    states.forEach([](DeviceChangeState& state) {
+        for (int r = 0; r < CHANGE_RULE_COUNT; r++) state.band[r] = CHANGE_RULES[r].band;
+        state.configured = false;
+        if (state.lastSeen == 0) state.lastSeen = 1; // Hic gorulmediyse expire siler
+    });
+}
+
+bool ChangeDetector::check(const VictronData& data, float power, unsigned long now, TelemetryField* changedField) {
+    DeviceChangeState* state = states.insert(data.mac);
+    if (state == nullptr || !state->primed) {
+        // Yeni cihaz (veya tablo dolu): gonder, commit referansi kurar
+        if (changedField) *changedField = CHANGE_RULES[0].field;
+        return true;
+    }
+    state->lastSeen = now;
+
+    float values[TELEMETRY_FIELD_COUNT];
+    telemetryFieldValues(data, power, values);
+
+    bool changed = false;
+    for (int r = 0; r < CHANGE_RULE_COUNT; r++) {
+        const ChangeRule& rule = CHANGE_RULES[r];
+        float diff = fabsf(values[rule.field] - state->sent[r]);
+        float band = state->band[r];
+
+        if (diff >= band) {
+            if (state->streak[r] < 255) state->streak[r]++;
+        } else if (diff < band * (1.0f - rule.hysteresis)) {
+            state->streak[r] = 0;
+        } // Aradaki bolgede sayac korunur
+
+        if (!changed && state->streak[r] >= rule.confirm) {
+            changed = true;
+            if (changedField) *changedField = rule.field;
+        }
+    }
+    return changed;
+}
+
+void ChangeDetector::commit(const VictronData& data, float power, unsigned long now) {
+    DeviceChangeState* state = states.insert(data.mac);
+    if (state == nullptr) return;
+
+    float values[TELEMETRY_FIELD_COUNT];
+    telemetryFieldValues(data, power, values);
+    for (int r = 0; r < CHANGE_RULE_COUNT; r++) {
+        state->sent[r] = values[CHANGE_RULES[r].field];
+        state->streak[r] = 0;
+    }
+    state->primed = true;
+    state->lastSeen = now;
+}
+
+void ChangeDetector::expire(unsigned long now) {
+    states.expire(now, CHANGE_STATE_EXPIRE_MS, [](DeviceChangeState& state) {
+        if (state.configured) {
+            // Bantlar kalir; tekrar gorulunce ilk gonderim referansi yeniler
+            state.primed = false;
+            return false;
+        }
+        return true;
+    });
+}
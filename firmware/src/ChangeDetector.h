@@ -0,0 +1,79 @@
+#ifndef CHANGE_DETECTOR_H
+#define CHANGE_DETECTOR_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "MacTable.h"
+#include "TelemetryCodec.h"
+
+// Heartbeat arasinda "kritik degisim" karari: alan basina olu bant + histerezis.
+//
+// Her izlenen alan (CHANGE_RULES) icin son gonderilen deger referanstir.
+// Fark >= bant olan kontrol sayisi `confirm`'e ulasinca degisim bildirilir;
+// fark bant - histerezis'in altina dusmeden sayac sifirlanmaz. Boylece bant
+// sinirinda titresen olcum ya da tek bir gurultu tepesi tekrar tekrar
+// gonderim tetiklemez. Ayrik alanlarda (alarm, durum) bant 0.5, confirm 1:
+// her degisim aninda gider.
+//
+// Bantlar cihaz ayarlarindan cihaz basina degistirilebilir (devices JSON'unda
+// "deadband": {"voltage": 0.1, "power": 20}); histerezis bandin sabit bir
+// oranidir. Yeni bir alani izlemek icin CHANGE_RULES'a satir eklemek yeter.
+//
+// Sadece loop tarafindan (sendTelemetry) kullanilir.
+
+// Bu sure boyunca gonderilmeyen, ayari olmayan cihaz kaydi silinir
+#define CHANGE_STATE_EXPIRE_MS 600000
+
+struct ChangeRule {
+    TelemetryField field;
+    float band;           // Varsayilan olu bant (alanin biriminde)
+    float hysteresis;     // Bandin orani: sayac |fark| < bant * (1 - histerezis) olunca sifirlanir
+    uint8_t confirm;      // Ust uste kac kontrolde bant disinda kalmali
+};
+
+static const uint8_t CHANGE_RULE_COUNT = 5;
+extern const ChangeRule CHANGE_RULES[CHANGE_RULE_COUNT];
+
+// TELEMETRY_FIELDS adina gore CHANGE_RULES sirasi, izlenmeyen alan: -1
+int findChangeRule(const char* fieldName);
+
+// Cihaz basina tek kompakt kayit (MacTable girdisi)
+struct DeviceChangeState {
+    uint64_t mac = 0;
+    unsigned long lastSeen = 0;          // Son kontrol / gonderim (millis)
+    float sent[CHANGE_RULE_COUNT];       // Son gonderilen degerler
+    float band[CHANGE_RULE_COUNT];       // Cihaza ozel bant (varsayilan CHANGE_RULES)
+    uint8_t streak[CHANGE_RULE_COUNT];   // Bant disinda gecen ardisik kontrol
+    bool primed = false;                 // En az bir kez gonderildi
+    bool configured = false;             // Ayardan bant geldi, expire silmez
+
+    DeviceChangeState();
+};
+
+class ChangeDetector {
+public:
+    // Cihaz ayarindan bant (fieldName: TELEMETRY_FIELDS adi). Bilinmeyen alan / gecersiz deger: false
+    bool setBand(uint64_t mac, const char* fieldName, float band);
+    bool setBand(uint64_t mac, int rule, float band);
+
+    // Tum cihaz bantlari varsayilana doner (ayar yeniden yuklenirken)
+    void clearBands();
+
+    // Sayaclari gunceller; onaylanmis degisim varsa true ve *changedField.
+    // Hic gonderilmemis (yeni) cihaz her zaman degismis sayilir.
+    // Tum cihazlar icin cagrilmali (ilk degisimde durmayin), sayaclar kontrol basina ilerler.
+    bool check(const VictronData& data, float power, unsigned long now, TelemetryField* changedField = nullptr);
+
+    // Cihaz batch'e yazildi: referans = bu degerler, sayaclar sifir
+    void commit(const VictronData& data, float power, unsigned long now);
+
+    // Uzun suredir gorulmeyen (ayarsiz) kayitlari temizler
+    void expire(unsigned long now);
+
+    size_t size() const { return states.size(); }
+
+private:
+    MacTable<DeviceChangeState, VICTRON_DEVICE_TABLE_SIZE> states;
+};
+
+#endif
@@ -3,17 +3,28 @@
 
 #include <Arduino.h>
 
+struct VictronSnapshot;
+struct DeviceKeyTable;
+
 // Global Ayar Değişkenleri
 extern String config_ssid;
 extern String config_pass;
 extern String config_boatId;
 extern String config_supabaseUrl;
 extern String config_secret;
-extern String config_devicesJson; // JSON formatında cihaz listesi
+extern DeviceKeyTable config_devices; // Kayıtlı cihazlar (NVS'te ikili tablo, DeviceKeyTable.h)
+extern uint8_t config_uplinkFormat; // TelemetryFormat (0: JSON, 1: Deflate, 2: İkili)
 
 void loadConfig();
-void saveConfig(String ssid, String pass, String boatId, String devicesJson);
+void saveConfig(String ssid, String pass, String boatId, const DeviceKeyTable& devices, uint8_t uplinkFormat);
+// Cihaz tablosunu tarayıcıya (anahtarlar, kapasite) ve değişim dedektörüne (bantlar) uygular. Sadece loop/setup.
+void applyDeviceTable(const DeviceKeyTable& table);
+// loop'tan: /save ile kaydedilen ayarlar varsa yeniden başlatmadan uygular.
+// WiFi bilgisi değiştiyse true (yeni ağa bağlanmak çağırana kalır).
+bool applyPendingConfig();
 void resetConfig();
 void setupWebServer();
+// SSE istemcisi varsa snapshot'i tazeler ve degisen cihazlari iter (loop'tan)
+void pushLiveData(VictronSnapshot& snapshot);
 
 #endif
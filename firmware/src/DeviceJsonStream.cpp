@@ -0,0 +1,204 @@
+#include "DeviceJsonStream.h"
+#include "VictronRecords.h"
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+static const char* const FIELD_NAMES[DJ_FIELD_COUNT] = {
+    "mac", "type", "model_id", "product", "voltage", "current", "rssi",
+    "pv_power", "load_current", "state", "yield_today",
+    "soc", "consumed_ah", "remaining_mins", "power",
+};
+
+bool parseDeviceJsonFields(const char* list, uint32_t& mask) {
+    uint32_t result = 0;
+    const char* p = list;
+    while (*p) {
+        const char* end = strchr(p, ',');
+        size_t len = end ? (size_t)(end - p) : strlen(p);
+        if (len > 0) {
+            int found = -1;
+            for (int i = 0; i < DJ_FIELD_COUNT; i++) {
+                if (strlen(FIELD_NAMES[i]) == len && strncmp(FIELD_NAMES[i], p, len) == 0) {
+                    found = i;
+                    break;
+                }
+            }
+            if (found < 0) return false;
+            result |= 1UL << found;
+        }
+        if (!end) break;
+        p = end + 1;
+    }
+    if (result == 0) return false;
+    mask = result;
+    return true;
+}
+
+// Sinirli yazici: tasma olursa ok = false, sonraki yazimlar yok sayilir
+struct JsonWriter {
+    char* out;
+    size_t cap;
+    size_t len;
+    bool ok;
+    bool first;
+
+    void raw(const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+    void key(const char* name) { raw(first ? "\"%s\":" : ",\"%s\":", name); first = false; }
+};
+
+void JsonWriter::raw(const char* fmt, ...) {
+    if (!ok) return;
+    va_list args;
+    va_start(args, fmt);
+    int n = vsnprintf(out + len, cap - len, fmt, args);
+    va_end(args);
+    if (n < 0 || (size_t)n >= cap - len) {
+        ok = false;
+        return;
+    }
+    len += (size_t)n;
+}
+
+// Sabit ondalik, sondaki sifirlar atilir (13.450 -> 13.45, 180.0 -> 180)
+static void putNumber(JsonWriter& w, const char* name, float value, int decimals) {
+    w.key(name);
+    if (!isfinite(value)) {
+        w.raw("null");
+        return;
+    }
+    char text[24];
+    int n = snprintf(text, sizeof(text), "%.*f", decimals, (double)value);
+    if (n <= 0 || (size_t)n >= sizeof(text)) {
+        w.raw("null");
+        return;
+    }
+    if (decimals > 0) {
+        while (n > 0 && text[n - 1] == '0') n--;
+        if (n > 0 && text[n - 1] == '.') n--;
+        text[n] = '\0';
+    }
+    if (strcmp(text, "-0") == 0) strcpy(text, "0");
+    w.raw("%s", text);
+}
+
+static void putInt(JsonWriter& w, const char* name, long value) {
+    w.key(name);
+    w.raw("%ld", value);
+}
+
+size_t writeDeviceJson(const VictronData& data, uint32_t fieldMask, char* out, size_t cap) {
+    if (cap == 0) return 0;
+    JsonWriter w = {out, cap, 0, true, true};
+    auto has = [fieldMask](DeviceJsonField f) { return (fieldMask & (1UL << f)) != 0; };
+
+    w.raw("{");
+    if (has(DJ_MAC)) {
+        char mac[18];
+        formatMacAddress(data.mac, mac);
+        w.key(FIELD_NAMES[DJ_MAC]);
+        w.raw("\"%s\"", mac);
+    }
+    if (has(DJ_TYPE)) putInt(w, FIELD_NAMES[DJ_TYPE], (int)data.type);
+    if (has(DJ_MODEL_ID)) putInt(w, FIELD_NAMES[DJ_MODEL_ID], data.modelId);
+    if (has(DJ_PRODUCT)) {
+        // Urun adlari statik ASCII tablodan gelir, kacis gerekmez
+        w.key(FIELD_NAMES[DJ_PRODUCT]);
+        w.raw("\"%s\"", victronProductName(data.modelId));
+    }
+    if (has(DJ_VOLTAGE)) putNumber(w, FIELD_NAMES[DJ_VOLTAGE], data.voltage, 3);
+    if (has(DJ_CURRENT)) putNumber(w, FIELD_NAMES[DJ_CURRENT], data.current, 3);
+    if (has(DJ_RSSI)) putInt(w, FIELD_NAMES[DJ_RSSI], data.rssi);
+
+    if (data.type == SOLAR_CHARGER) {
+        if (has(DJ_PV_POWER)) putNumber(w, FIELD_NAMES[DJ_PV_POWER], data.pvPower, 1);
+        if (has(DJ_LOAD_CURRENT)) putNumber(w, FIELD_NAMES[DJ_LOAD_CURRENT], data.loadCurrent, 3);
+        if (has(DJ_STATE)) putInt(w, FIELD_NAMES[DJ_STATE], data.deviceState);
+        if (has(DJ_YIELD_TODAY)) putNumber(w, FIELD_NAMES[DJ_YIELD_TODAY], data.yieldToday, 3);
+    } else if (data.type == BATTERY_MONITOR) {
+        if (has(DJ_SOC)) putNumber(w, FIELD_NAMES[DJ_SOC], data.soc, 1);
+        if (has(DJ_CONSUMED_AH)) putNumber(w, FIELD_NAMES[DJ_CONSUMED_AH], data.consumedAh, 1);
+        if (has(DJ_REMAINING_MINS)) putInt(w, FIELD_NAMES[DJ_REMAINING_MINS], data.remainingMins);
+        if (has(DJ_POWER)) putNumber(w, FIELD_NAMES[DJ_POWER], data.power, 2);
+    }
+    w.raw("}");
+
+    return w.ok ? w.len : 0;
+}
+
+bool DeviceJsonStream::setMacFilter(const char* list) {
+    macCount = 0;
+    const char* p = list;
+    while (*p) {
+        const char* end = strchr(p, ',');
+        size_t len = end ? (size_t)(end - p) : strlen(p);
+        if (len > 0) {
+            char text[24];
+            if (len >= sizeof(text) || macCount >= DEVICE_JSON_MAX_MACS) return false;
+            memcpy(text, p, len);
+            text[len] = '\0';
+            uint64_t mac;
+            if (!parseMacAddress(String(text), mac)) return false;
+            macs[macCount++] = mac;
+        }
+        if (!end) break;
+        p = end + 1;
+    }
+    return macCount > 0;
+}
+
+bool DeviceJsonStream::wanted(uint64_t mac) const {
+    if (macCount == 0) return true;
+    for (uint8_t i = 0; i < macCount; i++) {
+        if (macs[i] == mac) return true;
+    }
+    return false;
+}
+
+bool DeviceJsonStream::nextDevice(VictronData& out) {
+    while (scanner.getDeviceAfter(lastMac, out)) {
+        lastMac = out.mac;
+        if (wanted(out.mac)) return true;
+    }
+    return false;
+}
+
+size_t DeviceJsonStream::fill(uint8_t* buf, size_t maxLen) {
+    size_t written = 0;
+    while (written < maxLen) {
+        if (pendingPos < pendingLen) {
+            size_t n = pendingLen - pendingPos;
+            if (n > maxLen - written) n = maxLen - written;
+            memcpy(buf + written, pending + pendingPos, n);
+            pendingPos += n;
+            written += n;
+            continue;
+        }
+
+        pendingPos = 0;
+        pendingLen = 0;
+        if (stage == STAGE_OPEN) {
+            pending[pendingLen++] = '[';
+            stage = STAGE_DEVICES;
+        } else if (stage == STAGE_DEVICES) {
+            VictronData data;
+            if (!nextDevice(data)) {
+                stage = STAGE_CLOSE;
+                continue;
+            }
+            size_t offset = first ? 0 : 1;
+            size_t len = writeDeviceJson(data, fieldMask, pending + offset, sizeof(pending) - offset);
+            if (len == 0) continue; // Sigmayan cihaz atlanir (tum alanlar ~250 byte, olmamali)
+            if (!first) pending[0] = ',';
+            pendingLen = offset + len;
+            first = false;
+        } else if (stage == STAGE_CLOSE) {
+            pending[pendingLen++] = ']';
+            stage = STAGE_DONE;
+        } else {
+            break;
+        }
+    }
+    return written;
+}
@@ -0,0 +1,79 @@
+#ifndef DEVICE_JSON_STREAM_H
+#define DEVICE_JSON_STREAM_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "VictronBLE.h"
+
+// /api/data icin parca parca (chunked) JSON uretici.
+//
+// Cihazlar yayinlanmis snapshot'tan MAC sirasiyla tek tek okunur
+// (VictronBLE::getDeviceAfter) ve her cihaz kucuk bir tampona yazilip
+// istemci tamponuna aktarilir. Istek basina bellek sabittir (~0.5 KB),
+// cihaz sayisindan bagimsizdir; JSON dokumani ya da String kurulmaz.
+//
+// ?fields=mac,voltage,... sadece istenen alanlari, ?mac=aa:bb:..,.. sadece
+// istenen cihazlari yazar. Tipe ozel alanlar (pv_power, soc ...) sadece
+// ilgili cihaz tipinde yazilir (onceki /api/data ciktisi ile ayni).
+
+#define DEVICE_JSON_MAX_MACS 16
+#define DEVICE_JSON_OBJECT_MAX 384   // Tek cihaz nesnesi (tum alanlar ~250 byte)
+
+enum DeviceJsonField : uint8_t {
+    DJ_MAC = 0,
+    DJ_TYPE,
+    DJ_MODEL_ID,
+    DJ_PRODUCT,
+    DJ_VOLTAGE,
+    DJ_CURRENT,
+    DJ_RSSI,
+    DJ_PV_POWER,       // SOLAR_CHARGER
+    DJ_LOAD_CURRENT,   // SOLAR_CHARGER
+    DJ_STATE,          // SOLAR_CHARGER
+    DJ_YIELD_TODAY,    // SOLAR_CHARGER
+    DJ_SOC,            // BATTERY_MONITOR
+    DJ_CONSUMED_AH,    // BATTERY_MONITOR
+    DJ_REMAINING_MINS, // BATTERY_MONITOR
+    DJ_POWER,          // BATTERY_MONITOR
+    DJ_FIELD_COUNT
+};
+
+#define DEVICE_JSON_ALL_FIELDS ((1UL << DJ_FIELD_COUNT) - 1)
+
+// "mac,voltage,soc" -> alan maskesi. Bilinmeyen alan: false.
+bool parseDeviceJsonFields(const char* list, uint32_t& mask);
+// Tek cihaz nesnesi ("{...}"). Yazilan uzunluk; sigmazsa 0.
+size_t writeDeviceJson(const VictronData& data, uint32_t fieldMask, char* out, size_t cap);
+
+class DeviceJsonStream {
+public:
+    explicit DeviceJsonStream(const VictronBLE& scanner, uint32_t fieldMask = DEVICE_JSON_ALL_FIELDS)
+        : scanner(scanner), fieldMask(fieldMask) {}
+
+    // "aa:bb:..,11:22:.." -> MAC filtresi. Gecersiz MAC veya fazlasi: false.
+    bool setMacFilter(const char* list);
+
+    // AsyncWebServer chunked callback'i: buf'a en fazla maxLen byte yazar,
+    // 0 donerse yanit bitmistir.
+    size_t fill(uint8_t* buf, size_t maxLen);
+
+private:
+    enum Stage : uint8_t { STAGE_OPEN = 0, STAGE_DEVICES, STAGE_CLOSE, STAGE_DONE };
+
+    bool nextDevice(VictronData& out);
+    bool wanted(uint64_t mac) const;
+
+    const VictronBLE& scanner;
+    uint32_t fieldMask;
+    uint64_t macs[DEVICE_JSON_MAX_MACS];
+    uint8_t macCount = 0;
+
+    Stage stage = STAGE_OPEN;
+    uint64_t lastMac = 0;   // Son yazilan cihaz (MAC sirasi)
+    bool first = true;
+    char pending[DEVICE_JSON_OBJECT_MAX + 1]; // "," + nesne
+    size_t pendingLen = 0;
+    size_t pendingPos = 0;
+};
+
+#endif
@@ -0,0 +1,145 @@
+#include "DeviceKeyTable.h"
+#include <string.h>
+
+namespace {
+
+const uint8_t BLOB_MAGIC[3] = {'V', 'K', 'T'};
+const size_t BLOB_HEADER = 8;   // magic + surum + sayi + kayit boyu
+const size_t BLOB_CRC = 4;
+const size_t RECORD_SIZE = 6 + 16 + 4 + CHANGE_RULE_COUNT * 4;
+
+// CRC-32 (IEEE, 0xEDB88320), TelemetryQueue ile ayni
+uint32_t crc32Update(uint32_t crc, const uint8_t* data, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        crc ^= data[i];
+        for (int k = 0; k < 8; k++) crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
+    }
+    return crc;
+}
+
+void put16(uint8_t* p, uint16_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+void put32(uint8_t* p, uint32_t v) {
+    for (int i = 0; i < 4; i++) p[i] = (uint8_t)(v >> (8 * i));
+}
+
+uint16_t get16(const uint8_t* p) {
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+uint32_t get32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+void putFloat(uint8_t* p, float v) {
+    uint32_t bits;
+    memcpy(&bits, &v, sizeof(bits));
+    put32(p, bits);
+}
+
+float getFloat(const uint8_t* p) {
+    uint32_t bits = get32(p);
+    float v;
+    memcpy(&v, &bits, sizeof(v));
+    return v;
+}
+
+int hexNibble(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+} // namespace
+
+DeviceKeyRecord* DeviceKeyTable::upsert(uint64_t mac) {
+    for (uint16_t i = 0; i < count; i++) {
+        if (records[i].mac == mac) return &records[i];
+    }
+    if (mac == 0 || count >= DEVICE_KEY_TABLE_MAX) return nullptr;
+    records[count] = DeviceKeyRecord();
+    records[count].mac = mac;
+    return &records[count++];
+}
+
+const DeviceKeyRecord* DeviceKeyTable::find(uint64_t mac) const {
+    for (uint16_t i = 0; i < count; i++) {
+        if (records[i].mac == mac) return &records[i];
+    }
+    return nullptr;
+}
+
+size_t deviceKeyBlobSize(uint16_t count) {
+    return BLOB_HEADER + (size_t)count * RECORD_SIZE + BLOB_CRC;
+}
+
+size_t encodeDeviceKeyBlob(const DeviceKeyTable& table, uint8_t* out, size_t cap) {
+    size_t total = deviceKeyBlobSize(table.count);
+    if (total > cap) return 0;
+
+    memcpy(out, BLOB_MAGIC, sizeof(BLOB_MAGIC));
+    out[3] = DEVICE_KEY_BLOB_VERSION;
+    put16(out + 4, table.count);
+    put16(out + 6, (uint16_t)RECORD_SIZE);
+
+    uint8_t* p = out + BLOB_HEADER;
+    for (uint16_t i = 0; i < table.count; i++) {
+        const DeviceKeyRecord& rec = table.records[i];
+        for (int b = 0; b < 6; b++) p[b] = (uint8_t)(rec.mac >> (8 * (5 - b)));
+        memcpy(p + 6, rec.key, 16);
+        putFloat(p + 22, rec.capacityAh);
+        for (int r = 0; r < CHANGE_RULE_COUNT; r++) putFloat(p + 26 + r * 4, rec.deadband[r]);
+        p += RECORD_SIZE;
+    }
+    put32(p, crc32Update(0xFFFFFFFFu, out, total - BLOB_CRC) ^ 0xFFFFFFFFu);
+    return total;
+}
+
+bool decodeDeviceKeyBlob(const uint8_t* data, size_t len, DeviceKeyTable& out) {
+    out.count = 0;
+    if (len < BLOB_HEADER + BLOB_CRC || memcmp(data, BLOB_MAGIC, sizeof(BLOB_MAGIC)) != 0) return false;
+    if (data[3] != DEVICE_KEY_BLOB_VERSION) return false;
+
+    uint16_t count = get16(data + 4);
+    size_t recordSize = get16(data + 6);
+    if (recordSize < RECORD_SIZE || len != BLOB_HEADER + (size_t)count * recordSize + BLOB_CRC) return false;
+    if ((crc32Update(0xFFFFFFFFu, data, len - BLOB_CRC) ^ 0xFFFFFFFFu) != get32(data + len - BLOB_CRC)) return false;
+
+    const uint8_t* p = data + BLOB_HEADER;
+    for (uint16_t i = 0; i < count; i++, p += recordSize) {
+        uint64_t mac = 0;
+        for (int b = 0; b < 6; b++) mac = (mac << 8) | p[b];
+        DeviceKeyRecord* rec = out.upsert(mac);
+        if (rec == nullptr) continue; // Tablo dolu (daha kucuk derleme) ya da MAC 0
+        memcpy(rec->key, p + 6, 16);
+        rec->capacityAh = getFloat(p + 22);
+        for (int r = 0; r < CHANGE_RULE_COUNT; r++) rec->deadband[r] = getFloat(p + 26 + r * 4);
+    }
+    return true;
+}
+
+bool parseDeviceKey(const char* text, uint8_t out[16]) {
+    int digits = 0;
+    for (const char* c = text; *c; c++) {
+        if (*c == ' ' || *c == '\t' || *c == '\r' || *c == '\n' || *c == ':' || *c == '-') continue;
+        int nibble = hexNibble(*c);
+        if (nibble < 0 || digits >= 32) return false;
+        if (digits % 2 == 0) out[digits / 2] = (uint8_t)(nibble << 4);
+        else out[digits / 2] |= (uint8_t)nibble;
+        digits++;
+    }
+    return digits == 32;
+}
+
+void formatDeviceKey(const uint8_t key[16], char* out) {
+    static const char HEX_DIGITS[] = "0123456789abcdef";
+    for (int i = 0; i < 16; i++) {
+        out[i * 2] = HEX_DIGITS[key[i] >> 4];
+        out[i * 2 + 1] = HEX_DIGITS[key[i] & 0x0F];
+    }
+    out[32] = '\0';
+}
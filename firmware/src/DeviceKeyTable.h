@@ -0,0 +1,58 @@
+#ifndef DEVICE_KEY_TABLE_H
+#define DEVICE_KEY_TABLE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "ChangeDetector.h"
+
+// Kayitli cihazlar (MAC, AES anahtari, kapasite, olu bantlar) ve NVS'teki
+// surumlu ikili hali.
+//
+// Blob: "VKT" + surum (1) | kayit sayisi (u16) | kayit boyu (u16) | kayitlar | CRC32
+// Kayit: MAC (6, buyuk uc) | anahtar (16) | kapasite Ah (f32) | bantlar (CHANGE_RULE_COUNT x f32)
+// Tamsayi ve float'lar kucuk uc. Kayit boyu basliktadir: sonraki surumler
+// kaydin sonuna alan ekleyebilir, eski okuyucu fazlasini atlar.
+//
+// Acilista JSON parse edilmez ve hex cozulmez; tablo dogrudan
+// VictronBLE::reloadDevices'a verilir. Web arayuzu JSON gonderir, JSON ->
+// tablo donusumu sadece /save'de yapilir.
+
+#define DEVICE_KEY_BLOB_VERSION 1
+
+// Kapasite cihaz tablosunun doluluk siniri (VictronDeviceTable::MAX_ENTRIES):
+// fazlasi zaten izlenemez. Daha buyuk filo icin -DVICTRON_DEVICE_TABLE_SIZE=128.
+#define DEVICE_KEY_TABLE_MAX (VICTRON_DEVICE_TABLE_SIZE * 3 / 4)
+
+struct DeviceKeyRecord {
+    uint64_t mac = 0;                     // 0xAABBCCDDEEFF
+    uint8_t key[16] = {0};
+    float capacityAh = 0.0f;              // 0 = ayar yok
+    float deadband[CHANGE_RULE_COUNT];    // 0 = varsayilan (CHANGE_RULES)
+
+    DeviceKeyRecord() {
+        for (int r = 0; r < CHANGE_RULE_COUNT; r++) deadband[r] = 0.0f;
+    }
+};
+
+struct DeviceKeyTable {
+    uint16_t count = 0;
+    DeviceKeyRecord records[DEVICE_KEY_TABLE_MAX];
+
+    // Ayni MAC varsa o kayit (ustune yazilir), yoksa yeni kayit. Dolu: nullptr.
+    DeviceKeyRecord* upsert(uint64_t mac);
+    const DeviceKeyRecord* find(uint64_t mac) const;
+};
+
+// 6 + count * kayit + 4
+size_t deviceKeyBlobSize(uint16_t count);
+// Tabloyu blob'a yazar. cap yetmezse 0.
+size_t encodeDeviceKeyBlob(const DeviceKeyTable& table, uint8_t* out, size_t cap);
+// Surum, boy ve CRC kontrolu; bozuk / bilinmeyen blob: false (out bos)
+bool decodeDeviceKeyBlob(const uint8_t* data, size_t len, DeviceKeyTable& out);
+
+// 32 hex hane (bosluk / ayirici yok sayilir) -> 16 byte
+bool parseDeviceKey(const char* text, uint8_t out[16]);
+// 16 byte -> 32 kucuk harf hex (out en az 33 byte)
+void formatDeviceKey(const uint8_t key[16], char* out);
+
+#endif
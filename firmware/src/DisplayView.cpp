@@ -0,0 +1,208 @@
+#include "DisplayView.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+// Widget kutulari (rotation 1: 240x135). Metin kutunun sol ustune (TR_DATUM
+// icin sag ustune) yazilir; kutu her cizimde arka planla silinir.
+struct WidgetLayout {
+    int16_t x, y, w, h;
+    uint8_t textSize;
+    uint8_t datum;
+};
+
+static const WidgetLayout LAYOUT[] = {
+    {134, 5,   104, 8,  1, TR_DATUM}, // W_WIFI (sag kenar = width - 2)
+    {0,   45,  128, 24, 3, TL_DATUM}, // W_VOLTAGE
+    {130, 45,  110, 24, 3, TL_DATUM}, // W_CURRENT
+    {0,   72,  240, 16, 2, TL_DATUM}, // W_SOC
+    {2,   98,  232, 11, 0, TL_DATUM}, // W_SOC_BAR (cerceve 0,96 236x15)
+    {0,   118, 130, 8,  1, TL_DATUM}, // W_PV
+    {130, 118, 110, 8,  1, TL_DATUM}, // W_TTG
+    {10,  165, 230, 8,  1, TL_DATUM}, // W_LAST_SEEN
+    {10,  180, 230, 8,  1, TL_DATUM}, // W_LAST_ERROR
+    {20,  135, 220, 8,  1, TL_DATUM}, // W_AP_IP
+    {20,  165, 220, 8,  1, TL_DATUM}, // W_WIFI_ERROR
+};
+
+const char* getMpptStateName(int state) {
+    switch (state) {
+        case 0: return "Off";
+        case 2: return "Fault";
+        case 3: return "Bulk";
+        case 4: return "Absorption";
+        case 5: return "Float";
+        case 6: return "Storage";
+        case 7: return "Equalize";
+        case 245: return "Wake-up";
+        case 252: return "Ext. Control";
+        default: return "Unknown";
+    }
+}
+
+bool DisplayView::begin() {
+    sprite.setColorDepth(16);
+    spriteReady = sprite.createSprite(DISPLAY_SPRITE_WIDTH, DISPLAY_SPRITE_HEIGHT) != nullptr;
+    screen = SCREEN_NONE;
+    return spriteReady;
+}
+
+void DisplayView::enterScreen(Screen next) {
+    if (next == screen) return;
+    screen = next;
+    counters.fullRedraws++;
+
+    for (int i = 0; i < W_COUNT; i++) {
+        Widget& w = widgets[i];
+        w.x = LAYOUT[i].x;
+        w.y = LAYOUT[i].y;
+        w.w = LAYOUT[i].w;
+        w.h = LAYOUT[i].h;
+        w.textSize = LAYOUT[i].textSize;
+        w.datum = LAYOUT[i].datum;
+        w.text[0] = '\0';
+        w.color = TFT_BLACK;
+        w.fill = (i == W_SOC_BAR) ? 0 : -1;
+        w.drawn = false;
+    }
+
+    // Sabit kisimlar: sadece ekran degisince
+    tft.fillScreen(TFT_BLACK);
+    tft.setTextDatum(TL_DATUM);
+    tft.setTextColor(TFT_CYAN, TFT_BLACK);
+    tft.setTextSize(2);
+    tft.drawString("Victron BLE", 0, 0, 1);
+    tft.drawLine(0, 22, tft.width(), 22, TFT_DARKGREY);
+
+    activeMask = 1UL << W_WIFI;
+    if (next == SCREEN_DASHBOARD) {
+        tft.setTextColor(TFT_LIGHTGREY, TFT_BLACK);
+        tft.setTextSize(1);
+        tft.drawString("AKU VOLTAJI", 0, 30, 1);
+        tft.drawString("AKIM", 130, 30, 1);
+        tft.drawRect(0, 96, tft.width() - 4, 15, TFT_WHITE);
+        activeMask |= (1UL << W_VOLTAGE) | (1UL << W_CURRENT) | (1UL << W_SOC) | (1UL << W_SOC_BAR) |
+                      (1UL << W_PV) | (1UL << W_TTG);
+    } else {
+        tft.setTextColor(TFT_ORANGE, TFT_BLACK);
+        tft.setTextSize(2);
+        tft.drawString("Veri Bekleniyor...", 40, 80, 1);
+        tft.setTextSize(1);
+        if (next == SCREEN_WAITING_AP) {
+            tft.drawString("WiFi: VictronMonitor_Setup", 20, 120, 1);
+            tft.drawString("Lutfen ayarlari yapin.", 20, 150, 1);
+            activeMask |= (1UL << W_AP_IP) | (1UL << W_WIFI_ERROR);
+        } else {
+            tft.drawString("Victron cihazi araniyor...", 40, 120, 1);
+            tft.drawString("Lutfen cihazi yaklastirin.", 40, 135, 1);
+        }
+        activeMask |= (1UL << W_LAST_SEEN) | (1UL << W_LAST_ERROR);
+    }
+}
+
+void DisplayView::setText(WidgetId id, uint16_t color, const char* fmt, ...) {
+    char text[DISPLAY_TEXT_MAX];
+    va_list args;
+    va_start(args, fmt);
+    vsnprintf(text, sizeof(text), fmt, args);
+    va_end(args);
+
+    Widget& w = widgets[id];
+    if (w.color == color && strcmp(w.text, text) == 0) return;
+    memcpy(w.text, text, sizeof(text));
+    w.color = color;
+    w.drawn = false;
+}
+
+void DisplayView::setBar(WidgetId id, int16_t fill, uint16_t color) {
+    Widget& w = widgets[id];
+    if (fill < 0) fill = 0;
+    if (fill > w.w) fill = w.w;
+    if (w.fill == fill && (fill == 0 || w.color == color)) return;
+    w.fill = fill;
+    w.color = color;
+    w.drawn = false;
+}
+
+void DisplayView::drawWidget(Widget& w) {
+    TFT_eSPI* canvas = &tft;
+    int16_t ox = w.x, oy = w.y;
+    if (spriteReady) {
+        canvas = &sprite;
+        ox = 0;
+        oy = 0;
+    }
+
+    canvas->fillRect(ox, oy, w.w, w.h, TFT_BLACK);
+    if (w.fill >= 0) {
+        if (w.fill > 0) canvas->fillRect(ox, oy, w.fill, w.h, w.color);
+    } else if (w.text[0] != '\0') {
+        canvas->setTextColor(w.color, TFT_BLACK);
+        canvas->setTextSize(w.textSize);
+        canvas->setTextDatum(w.datum);
+        canvas->drawString(w.text, w.datum == TR_DATUM ? ox + w.w : ox, oy, 1);
+    }
+    if (spriteReady) sprite.pushSprite(w.x, w.y, 0, 0, w.w, w.h);
+
+    w.drawn = true;
+    counters.widgetDraws++;
+    counters.pixelsPushed += (uint32_t)w.w * w.h;
+}
+
+void DisplayView::flush() {
+    for (int i = 0; i < W_COUNT; i++) {
+        if ((activeMask & (1UL << i)) && !widgets[i].drawn) drawWidget(widgets[i]);
+    }
+    tft.setTextDatum(TL_DATUM);
+}
+
+void DisplayView::render(const DisplayState& s) {
+    counters.frames++;
+
+    bool haveData = s.batteryFound || s.mpptCount > 0;
+    enterScreen(haveData ? SCREEN_DASHBOARD : (s.wifi == DISPLAY_WIFI_AP ? SCREEN_WAITING_AP : SCREEN_WAITING_SCAN));
+
+    // WiFi durumu (sag ust)
+    if (s.wifi == DISPLAY_WIFI_CONNECTED) {
+        if (s.ip[0] == '\0') setText(W_WIFI, TFT_GREEN, "WIFI: BAGLI");
+        else setText(W_WIFI, TFT_GREEN, "IP: %s", s.ip);
+    } else if (s.wifi == DISPLAY_WIFI_AP) {
+        setText(W_WIFI, TFT_MAGENTA, "MOD: SETUP");
+    } else {
+        setText(W_WIFI, TFT_RED, "WIFI: YOK");
+    }
+
+    if (screen == SCREEN_DASHBOARD) {
+        if (s.batteryFound) {
+            setText(W_VOLTAGE, TFT_WHITE, "%.2fV", s.batteryVoltage);
+            setText(W_CURRENT, s.batteryCurrent > 0 ? TFT_GREEN : TFT_RED, "%.1fA", s.batteryCurrent);
+            setText(W_SOC, TFT_YELLOW, "SOC: %.1f%%", s.batterySoc);
+            int16_t fill = (int16_t)((s.batterySoc / 100.0f) * widgets[W_SOC_BAR].w);
+            setBar(W_SOC_BAR, fill, s.batterySoc > 50 ? TFT_GREEN : TFT_RED);
+            if (s.batteryRemaining == 0xFFFF || s.batteryRemaining == -1) {
+                setText(W_TTG, TFT_LIGHTGREY, "SURE: Sonsuz");
+            } else {
+                setText(W_TTG, TFT_LIGHTGREY, "SURE: %ddk", s.batteryRemaining);
+            }
+        } else {
+            setText(W_VOLTAGE, TFT_WHITE, "--.--V");
+            setText(W_CURRENT, TFT_WHITE, "--.-A");
+            setText(W_SOC, TFT_YELLOW, "SOC: --.-%%");
+            setBar(W_SOC_BAR, 0, TFT_BLACK);
+            setText(W_TTG, TFT_LIGHTGREY, "SURE: --");
+        }
+
+        if (s.mpptCount == 0) setText(W_PV, TFT_ORANGE, "");
+        else if (s.mpptState == -1) setText(W_PV, TFT_ORANGE, "PV: %.0fW", s.pvPower);
+        else setText(W_PV, TFT_ORANGE, "PV: %.0fW (%s)", s.pvPower, getMpptStateName(s.mpptState));
+    } else {
+        setText(W_LAST_SEEN, TFT_YELLOW, s.lastSeen[0] ? "Son: %s" : "", s.lastSeen);
+        setText(W_LAST_ERROR, TFT_RED, s.lastError[0] ? "Err: %s" : "", s.lastError);
+        if (screen == SCREEN_WAITING_AP) {
+            setText(W_AP_IP, TFT_ORANGE, "IP: %s", s.apIp);
+            setText(W_WIFI_ERROR, TFT_RED, s.wifiError[0] ? "Hata: %s" : "", s.wifiError);
+        }
+    }
+
+    flush();
+}
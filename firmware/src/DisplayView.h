@@ -0,0 +1,118 @@
+#ifndef DISPLAY_VIEW_H
+#define DISPLAY_VIEW_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <TFT_eSPI.h>
+
+// TFT icin kalici (retained) ekran modeli.
+//
+// updateDisplay her 500 ms'de DisplayState'i doldurur; DisplayView sadece
+// bicimlenmis metni (veya bar doluluğu / rengi) degisen widget'i yeniden
+// cizer. Widget once TFT_eSprite'a (arka plan + metin) cizilir, sonra tek
+// pencere olarak panele gonderilir: silme/yazma arasi titreme olmaz.
+// Sabit etiketler ve cerceveler sadece ekran (dashboard / bekleme) degisince
+// cizilir. Sprite ayrilamazsa ayni kutu dogrudan panele cizilir.
+
+#define DISPLAY_SPRITE_WIDTH 240  // En genis widget
+#define DISPLAY_SPRITE_HEIGHT 24  // En yuksek widget (textSize 3)
+#define DISPLAY_TEXT_MAX 32
+
+enum DisplayWifi : uint8_t {
+    DISPLAY_WIFI_NONE = 0,
+    DISPLAY_WIFI_CONNECTED,
+    DISPLAY_WIFI_AP,
+};
+
+// Ekranda gosterilen her sey (updateDisplay toplar)
+struct DisplayState {
+    uint8_t wifi = DISPLAY_WIFI_NONE;
+    char ip[16] = "";                // Bossa "WIFI: BAGLI"
+
+    bool batteryFound = false;
+    float batteryVoltage = 0.0f;
+    float batteryCurrent = 0.0f;
+    float batterySoc = 0.0f;
+    int batteryRemaining = 0;        // dk, 0xFFFF / -1 = sonsuz
+
+    int mpptCount = 0;
+    float pvPower = 0.0f;
+    int mpptState = -1;              // -1: Yok/Bilinmiyor
+
+    // Bekleme ekrani
+    char lastSeen[40] = "";
+    char lastError[64] = "";
+    char apIp[16] = "";
+    char wifiError[40] = "";
+};
+
+struct DisplayStats {
+    uint32_t frames;          // render() cagrisi
+    uint32_t fullRedraws;     // Ekran degisimi (fillScreen)
+    uint32_t widgetDraws;     // Yeniden cizilen widget
+    uint32_t pixelsPushed;    // Widget pencereleri (fillScreen haric)
+};
+
+const char* getMpptStateName(int state);
+
+class DisplayView {
+public:
+    explicit DisplayView(TFT_eSPI& tft) : tft(tft), sprite(&tft) {}
+
+    // Sprite tamponunu ayirir (16 bit, ~11 KB). Basarisizsa dogrudan cizim.
+    bool begin();
+    void render(const DisplayState& state);
+    // Ekran baska kod tarafindan cizildi: sonraki render tam cizim yapar
+    void invalidate() { screen = SCREEN_NONE; }
+
+    const DisplayStats& stats() const { return counters; }
+
+private:
+    enum Screen : uint8_t {
+        SCREEN_NONE = 0,
+        SCREEN_DASHBOARD,
+        SCREEN_WAITING_AP,
+        SCREEN_WAITING_SCAN,
+    };
+
+    struct Widget {
+        int16_t x, y, w, h;
+        uint8_t textSize;
+        uint8_t datum;          // TL_DATUM / TR_DATUM
+        char text[DISPLAY_TEXT_MAX];
+        uint16_t color;
+        int16_t fill;           // Bar widget: dolu genislik (-1 = metin widget'i)
+        bool drawn;             // Ekrandaki hali text/color/fill ile ayni
+    };
+
+    enum WidgetId : uint8_t {
+        W_WIFI = 0,
+        W_VOLTAGE,
+        W_CURRENT,
+        W_SOC,
+        W_SOC_BAR,
+        W_PV,
+        W_TTG,
+        W_LAST_SEEN,
+        W_LAST_ERROR,
+        W_AP_IP,
+        W_WIFI_ERROR,
+        W_COUNT
+    };
+
+    void enterScreen(Screen next);
+    void setText(WidgetId id, uint16_t color, const char* fmt, ...);
+    void setBar(WidgetId id, int16_t fill, uint16_t color);
+    void flush();
+    void drawWidget(Widget& widget);
+
+    TFT_eSPI& tft;
+    TFT_eSprite sprite;
+    bool spriteReady = false;
+    Screen screen = SCREEN_NONE;
+    Widget widgets[W_COUNT];
+    uint32_t activeMask = 0;    // Bu ekranda gorunen widget'lar
+    DisplayStats counters = {};
+};
+
+#endif
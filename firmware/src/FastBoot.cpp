@@ -0,0 +1,156 @@
+#include "FastBoot.h"
+#include <WiFi.h>
+#include <Preferences.h>
+#include <esp_system.h>
+#include <string.h>
+#include "AppLog.h"
+
+#define FAST_BOOT_NAMESPACE "fast-boot"
+#define FAST_BOOT_LEASE_MAGIC 0x4C454153u // "LEAS"
+
+static const char* const PHASE_NAMES[BOOT_PHASE_COUNT] = {
+    "display", "config", "storage", "ble_ready", "wifi_begin",
+    "wifi_connected", "got_ip", "web_ready", "setup_done", "first_advert",
+};
+
+static volatile uint32_t phaseMs[BOOT_PHASE_COUNT];
+static BootInfo info = {false, false, false, 0};
+static volatile bool leaseHeld = false;   // RTC kirasi sabit IP olarak kullaniliyor
+static uint32_t leaseHeldSince = 0;
+
+// NVS kaydi: SSID ozeti ile birlikte (SSID degisince gecersiz)
+struct StoredWifi {
+    uint32_t ssidHash;
+    uint8_t bssid[6];
+    uint8_t channel;
+};
+
+// RTC bellegi yazilimsal yeniden baslatmada korunur, guc kesilince bozulur
+struct StoredLease {
+    uint32_t magic;
+    uint32_t ssidHash;
+    FastBootLease lease;
+    uint32_t check;
+};
+RTC_NOINIT_ATTR static StoredLease rtcLease;
+
+static StoredWifi rememberedWifi;     // Bu acilista NVS'te olan (tekrar yazmamak icin)
+static bool rememberedValid = false;
+
+static uint32_t ssidHash(const String& ssid) {
+    uint32_t h = 2166136261u;
+    for (unsigned int i = 0; i < ssid.length(); i++) {
+        h ^= (uint8_t)ssid[i];
+        h *= 16777619u;
+    }
+    return h;
+}
+
+static uint32_t leaseCheck(const StoredLease& s) {
+    return s.magic ^ s.ssidHash ^ s.lease.ip ^ (s.lease.gateway * 3) ^ (s.lease.mask * 5) ^ (s.lease.dns * 7);
+}
+
+void bootMark(BootPhase phase) {
+    if (phase >= BOOT_PHASE_COUNT || phaseMs[phase] != 0) return;
+    uint32_t now = millis();
+    phaseMs[phase] = now ? now : 1;
+}
+
+uint32_t bootPhaseMs(BootPhase phase) {
+    return phase < BOOT_PHASE_COUNT ? phaseMs[phase] : 0;
+}
+
+const char* bootPhaseName(BootPhase phase) {
+    return phase < BOOT_PHASE_COUNT ? PHASE_NAMES[phase] : "?";
+}
+
+BootInfo bootInfo() {
+    BootInfo out = info;
+    out.resetReason = (int)esp_reset_reason();
+    return out;
+}
+
+void bootNoteFastPath(bool attempted, bool connected, bool leaseReused) {
+    info.fastAttempted = attempted;
+    info.fastConnected = connected;
+    info.leaseReused = leaseReused;
+    leaseHeldSince = millis();
+    leaseHeld = leaseReused;
+}
+
+bool fastBootLoadWifi(const String& ssid, FastBootWifi& out) {
+    Preferences prefs;
+    if (!prefs.begin(FAST_BOOT_NAMESPACE, true)) return false;
+    StoredWifi stored;
+    size_t len = prefs.getBytes("wifi", &stored, sizeof(stored));
+    prefs.end();
+    if (len != sizeof(stored) || stored.ssidHash != ssidHash(ssid) || stored.channel == 0) return false;
+
+    rememberedWifi = stored;
+    rememberedValid = true;
+    memcpy(out.bssid, stored.bssid, sizeof(out.bssid));
+    out.channel = stored.channel;
+    return true;
+}
+
+bool fastBootLoadLease(const String& ssid, FastBootLease& out) {
+    esp_reset_reason_t reason = esp_reset_reason();
+    bool warm = reason == ESP_RST_SW || reason == ESP_RST_PANIC || reason == ESP_RST_INT_WDT ||
+                reason == ESP_RST_TASK_WDT || reason == ESP_RST_WDT;
+    if (!warm || rtcLease.magic != FAST_BOOT_LEASE_MAGIC || rtcLease.check != leaseCheck(rtcLease) ||
+        rtcLease.ssidHash != ssidHash(ssid) || rtcLease.lease.ip == 0) {
+        return false;
+    }
+    out = rtcLease.lease;
+    return true;
+}
+
+void fastBootRemember(const String& ssid) {
+    StoredWifi current;
+    memset(&current, 0, sizeof(current)); // Dolgu byte'lari da karsilastirilir
+    current.ssidHash = ssidHash(ssid);
+    const uint8_t* bssid = WiFi.BSSID();
+    if (bssid == nullptr) return;
+    memcpy(current.bssid, bssid, sizeof(current.bssid));
+    current.channel = (uint8_t)WiFi.channel();
+
+    // Kira her baglantida RTC'ye (flash'a yazilmaz)
+    rtcLease.magic = FAST_BOOT_LEASE_MAGIC;
+    rtcLease.ssidHash = current.ssidHash;
+    rtcLease.lease.ip = (uint32_t)WiFi.localIP();
+    rtcLease.lease.gateway = (uint32_t)WiFi.gatewayIP();
+    rtcLease.lease.mask = (uint32_t)WiFi.subnetMask();
+    rtcLease.lease.dns = (uint32_t)WiFi.dnsIP();
+    rtcLease.check = leaseCheck(rtcLease);
+
+    // Erisim noktasi sadece degisince NVS'e (flash yipranmasi)
+    if (rememberedValid && memcmp(&rememberedWifi, &current, sizeof(current)) == 0) return;
+    Preferences prefs;
+    if (!prefs.begin(FAST_BOOT_NAMESPACE, false)) return;
+    prefs.putBytes("wifi", &current, sizeof(current));
+    prefs.end();
+    rememberedWifi = current;
+    rememberedValid = true;
+    APP_LOGI("Hizli acilis: erisim noktasi kaydedildi (kanal %u)", current.channel);
+}
+
+void fastBootForget() {
+    rtcLease.magic = 0;
+    rememberedValid = false;
+    Preferences prefs;
+    if (!prefs.begin(FAST_BOOT_NAMESPACE, false)) return;
+    prefs.remove("wifi");
+    prefs.end();
+}
+
+void fastBootUseDhcp() {
+    if (leaseHeld) APP_LOGI("Hizli acilis: onceki IP birakiliyor, DHCP baslatiliyor");
+    leaseHeld = false;
+    WiFi.config(INADDR_NONE, INADDR_NONE, INADDR_NONE);
+}
+
+void fastBootLeaseTick(bool uplinkAttempted) {
+    if (!leaseHeld) return;
+    if (!uplinkAttempted && millis() - leaseHeldSince < FAST_BOOT_LEASE_HOLD_MS) return;
+    fastBootUseDhcp();
+}
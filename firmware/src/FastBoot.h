@@ -0,0 +1,82 @@
+#ifndef FAST_BOOT_H
+#define FAST_BOOT_H
+
+#include <Arduino.h>
+
+// Hizli acilis: son basarili WiFi baglantisi ve acilis asamalarinin zamanlari.
+//
+// Erisim noktasi (BSSID + kanal) NVS'e yazilir; bir sonraki acilista tam
+// tarama yapilmadan dogrudan bu kanala baglanilir. BSSID'e sabitlenmez (ayni
+// SSID'li baska erisim noktasina gecilebilsin), sadece erisim noktasi
+// degistiginde NVS'e yazmak icin karsilastirilir. DHCP kirasi (IP,
+// gateway, maske, DNS) RTC bellegine yazilir ve sadece yazilimsal yeniden
+// baslatmada (ayar kaydi, OTA, panik) kullanilir: kira bu guc dongusunde
+// alindigi icin hala gecerlidir, ilk adres icin DHCP beklenmez. Sabit IP
+// ilk uplink denemesine (basarili ya da ag hatasi) ya da en fazla
+// FAST_BOOT_LEASE_HOLD_MS'ye kadar tutulur, sonra uplink task'i DHCP'yi
+// baslatir (fastBootLeaseTick): kira yonlendiricide yenilenir, sabit IP
+// calisma boyunca kalmaz. Guc kesilince RTC silinir ve normal DHCP yapilir. Hizli baglanti FAST_BOOT_ASSOC_TIMEOUT_MS icinde
+// olmazsa onbellek silinir ve tarama + normal baglantiya donulur.
+//
+// BLE taramasi WiFi'den once baslar, baglanti beklenirken reklamlar islenir.
+// Asama zamanlari (millis) /api/boot'ta gosterilir.
+
+#define FAST_BOOT_ASSOC_TIMEOUT_MS 4000
+#define FAST_BOOT_LEASE_HOLD_MS 60000   // Uplink denemesi olmasa da bu sure sonra DHCP
+
+enum BootPhase : uint8_t {
+    BOOT_PHASE_DISPLAY = 0,     // Ekran hazir
+    BOOT_PHASE_CONFIG,          // NVS ayarlari okundu
+    BOOT_PHASE_STORAGE,         // LittleFS + uplink task'i
+    BOOT_PHASE_BLE_READY,       // Cihazlar yuklendi, BLE taramasi basliyor
+    BOOT_PHASE_WIFI_BEGIN,      // Son WiFi.begin
+    BOOT_PHASE_WIFI_CONNECTED,  // Baglanti (setup icinde goruldu)
+    BOOT_PHASE_GOT_IP,          // IP alindi (WiFi olayi)
+    BOOT_PHASE_WEB_READY,       // Web sunucusu dinliyor
+    BOOT_PHASE_SETUP_DONE,
+    BOOT_PHASE_FIRST_ADVERT,    // Ilk cozulen Victron reklami
+    BOOT_PHASE_COUNT
+};
+
+struct FastBootWifi {
+    uint8_t bssid[6];
+    uint8_t channel;
+};
+
+struct FastBootLease {
+    uint32_t ip;
+    uint32_t gateway;
+    uint32_t mask;
+    uint32_t dns;
+};
+
+// Asamanin ilk gorulme ani kaydedilir (sonraki cagrilar yok sayilir). Her task'tan.
+void bootMark(BootPhase phase);
+uint32_t bootPhaseMs(BootPhase phase);   // 0 = henuz yok
+const char* bootPhaseName(BootPhase phase);
+
+// Bu acilista hizli yol denendi / basarili oldu / RTC kirasi kullanildi
+struct BootInfo {
+    bool fastAttempted;
+    bool fastConnected;
+    bool leaseReused;
+    int resetReason;                     // esp_reset_reason()
+};
+BootInfo bootInfo();
+void bootNoteFastPath(bool attempted, bool connected, bool leaseReused);
+
+// ssid icin kayitli erisim noktasi (NVS)
+bool fastBootLoadWifi(const String& ssid, FastBootWifi& out);
+// Yazilimsal yeniden baslatmada onceki kira (RTC)
+bool fastBootLoadLease(const String& ssid, FastBootLease& out);
+// Bagliyken loop'tan: erisim noktasi degistiyse NVS'e, kira RTC'ye yazilir
+void fastBootRemember(const String& ssid);
+// Hizli baglanti basarisiz: NVS + RTC kaydi silinir
+void fastBootForget();
+// Sabit IP'yi birakip DHCP istemcisini baslatir (WiFi.config(INADDR_NONE...))
+void fastBootUseDhcp();
+// RTC kirasi hala sabit IP olarak kullaniliyorsa: uplinkAttempted ya da
+// FAST_BOOT_LEASE_HOLD_MS dolduysa DHCP'ye gecer. Uplink task'indan (istek yokken).
+void fastBootLeaseTick(bool uplinkAttempted);
+
+#endif
@@ -0,0 +1,150 @@
+#ifndef FLEET_AGGREGATE_H
+#define FLEET_AGGREGATE_H
+
+#include <stdint.h>
+#include <math.h>
+
+// Canli cihazlarin toplamlari (filo ozeti).
+//
+// VictronBLE her cozulen kayitta cihazin eski katkisini cikarip yenisini
+// ekler, eskiyen (expire) cihazin katkisini cikarir: O(1), cihaz listesi
+// hic taranmaz. Toplamlar sabit noktali tamsayidir (mA, 0.1 W, mV, 0.1 %),
+// milyonlarca ekle/cikar sonrasinda da kayma olmaz. FleetTotals snapshot ile
+// birlikte yayinlanir; ekran, telemetri ve web ayni ozeti okur.
+//
+// Aku bankasi: BATTERY_MONITOR (SmartShunt / BMV) ve LYNX_BMS kayitlari.
+// SOC ve kalan sure bankalarin kapasitesiyle (cihaz ayari "capacity_ah",
+// yoksa 100 Ah) agirliklandirilir; akim ve guc toplanir, voltaj ortalamadir.
+
+#define FLEET_TYPE_SLOTS 0x22         // Readout type 0x00..0x20 + UNKNOWN
+#define FLEET_CHARGE_STATE_SLOTS 11   // 0..7, 245, 252, diger
+#define FLEET_DEFAULT_CAPACITY_AH 100.0f
+
+struct FleetTotals {
+    uint16_t liveDevices = 0;
+    uint8_t typeCounts[FLEET_TYPE_SLOTS] = {0};
+
+    // Solar (MPPT)
+    uint16_t mpptCount = 0;
+    float pvPower = 0.0f;          // W
+    int mpptState = -1;            // En cok MPPT'nin bulundugu durum, -1: MPPT yok
+
+    // Aku bankalari
+    uint16_t batteryBanks = 0;
+    float batteryVoltage = 0.0f;   // Ortalama (V)
+    float batteryCurrent = 0.0f;   // Toplam (A)
+    float batteryPower = 0.0f;     // Toplam (W)
+    float batterySoc = 0.0f;       // Kapasite agirlikli (%)
+    int batteryRemaining = -1;     // Kapasite agirlikli (dk), -1: sonsuz / bilinmiyor
+};
+
+// Tek cihazin toplamlara katkisi (VictronBLE.cpp'de VictronData + kapasite ayarindan)
+struct FleetContribution {
+    uint8_t typeSlot;
+    bool mppt;
+    bool bank;
+    uint8_t chargeStateSlot;
+    int32_t pvPowerDw;       // 0.1 W
+    int32_t voltageMv;
+    int32_t currentMa;
+    int32_t powerDw;         // 0.1 W
+    int32_t weightDah;       // 0.1 Ah
+    int64_t socWeighted;     // 0.1 % * 0.1 Ah
+    int64_t remainingWeighted; // dk * 0.1 Ah (sadece sonlu sure)
+    bool remainingFinite;
+};
+
+inline uint8_t fleetTypeSlot(int type) {
+    return (type >= 0 && type < FLEET_TYPE_SLOTS - 1) ? (uint8_t)type : (uint8_t)(FLEET_TYPE_SLOTS - 1);
+}
+
+inline uint8_t fleetChargeStateSlot(int state) {
+    if (state >= 0 && state <= 7) return (uint8_t)state;
+    if (state == 245) return 8;
+    if (state == 252) return 9;
+    return 10;
+}
+
+inline int fleetChargeStateFromSlot(uint8_t slot) {
+    if (slot <= 7) return slot;
+    if (slot == 8) return 245;
+    if (slot == 9) return 252;
+    return -2; // Bilinmeyen durum kodu (ekranda "Unknown")
+}
+
+inline int32_t fleetFixed(float value, float unit) {
+    return (int32_t)lroundf(value / unit);
+}
+
+class FleetAggregate {
+public:
+    void add(const FleetContribution& c) { apply(c, 1); }
+    void remove(const FleetContribution& c) { apply(c, -1); }
+    void clear() { *this = FleetAggregate(); }
+
+    FleetTotals totals() const {
+        FleetTotals t;
+        t.liveDevices = (uint16_t)liveDevices;
+        for (int i = 0; i < FLEET_TYPE_SLOTS; i++) t.typeCounts[i] = (uint8_t)typeCounts[i];
+
+        t.mpptCount = (uint16_t)mpptCount;
+        t.pvPower = pvPowerDw * 0.1f;
+        if (mpptCount > 0) {
+            // Esitlikte yuksek slot (Bulk < Absorption < Float ...) secilir
+            int best = 0;
+            for (int s = 1; s < FLEET_CHARGE_STATE_SLOTS; s++) {
+                if (chargeStates[s] >= chargeStates[best]) best = s;
+            }
+            t.mpptState = fleetChargeStateFromSlot((uint8_t)best);
+        }
+
+        t.batteryBanks = (uint16_t)banks;
+        if (banks > 0) {
+            t.batteryVoltage = (float)(voltageMv / banks) * 0.001f;
+            t.batteryCurrent = currentMa * 0.001f;
+            t.batteryPower = powerDw * 0.1f;
+            if (weightDah > 0) t.batterySoc = (float)(socWeighted / weightDah) * 0.1f;
+            if (finiteWeightDah > 0) t.batteryRemaining = (int)(remainingWeighted / finiteWeightDah);
+        }
+        return t;
+    }
+
+private:
+    void apply(const FleetContribution& c, int sign) {
+        liveDevices += sign;
+        typeCounts[c.typeSlot] += sign;
+        if (c.mppt) {
+            mpptCount += sign;
+            pvPowerDw += sign * c.pvPowerDw;
+            chargeStates[c.chargeStateSlot] += sign;
+        }
+        if (c.bank) {
+            banks += sign;
+            voltageMv += sign * c.voltageMv;
+            currentMa += sign * c.currentMa;
+            powerDw += sign * c.powerDw;
+            weightDah += sign * c.weightDah;
+            socWeighted += sign * c.socWeighted;
+            if (c.remainingFinite) {
+                finiteWeightDah += sign * c.weightDah;
+                remainingWeighted += sign * c.remainingWeighted;
+            }
+        }
+    }
+
+    int32_t liveDevices = 0;
+    int16_t typeCounts[FLEET_TYPE_SLOTS] = {0};
+    int32_t mpptCount = 0;
+    int64_t pvPowerDw = 0;
+    int16_t chargeStates[FLEET_CHARGE_STATE_SLOTS] = {0};
+    int32_t banks = 0;
+    int64_t voltageMv = 0;
+    int64_t currentMa = 0;
+    int64_t powerDw = 0;
+    int64_t weightDah = 0;
+    int64_t socWeighted = 0;
+    int64_t finiteWeightDah = 0;
+    int64_t remainingWeighted = 0;
+};
+
+#endif
@@ -0,0 +1,120 @@
+#include "LiveFeed.h"
+#include "DeviceJsonStream.h"
+#include <stdio.h>
+#include <string.h>
+
+// "],"removed":[" + MAC listesi + "]}" icin ayrilan yer
+static const size_t REMOVED_RESERVE = 16 + LIVE_FEED_MAX_REMOVED * 21 + 3;
+
+static uint32_t fnv1a(uint32_t h, const void* data, size_t len) {
+    const uint8_t* p = (const uint8_t*)data;
+    for (size_t i = 0; i < len; i++) {
+        h ^= p[i];
+        h *= 16777619u;
+    }
+    return h;
+}
+
+// Panelde gorunen alanlarin ozeti; cihaz sadece bunlardan biri degisince
+// yeniden serilestirilir. RSSI her reklamda oynadigi icin disarida: diger
+// alanlar degisince guncel degeriyle gider.
+static uint32_t deviceHash(const VictronData& d) {
+    uint32_t h = 2166136261u;
+    int type = (int)d.type;
+    h = fnv1a(h, &type, sizeof(type));
+    h = fnv1a(h, &d.modelId, sizeof(d.modelId));
+    h = fnv1a(h, &d.voltage, sizeof(d.voltage));
+    h = fnv1a(h, &d.current, sizeof(d.current));
+    if (d.type == SOLAR_CHARGER) {
+        h = fnv1a(h, &d.pvPower, sizeof(d.pvPower));
+        h = fnv1a(h, &d.loadCurrent, sizeof(d.loadCurrent));
+        h = fnv1a(h, &d.deviceState, sizeof(d.deviceState));
+        h = fnv1a(h, &d.yieldToday, sizeof(d.yieldToday));
+    } else if (d.type == BATTERY_MONITOR) {
+        h = fnv1a(h, &d.soc, sizeof(d.soc));
+        h = fnv1a(h, &d.consumedAh, sizeof(d.consumedAh));
+        h = fnv1a(h, &d.remainingMins, sizeof(d.remainingMins));
+        h = fnv1a(h, &d.power, sizeof(d.power));
+    }
+    return h;
+}
+
+size_t LiveFeed::poll(const VictronSnapshot& snapshot, unsigned long now, char* out, size_t cap) {
+    bool full = fullRequested.load(std::memory_order_relaxed) || now - lastFullSync >= LIVE_FEED_FULL_SYNC_MS;
+    if (!full && snapshot.version == lastVersion && !backlog) return 0;
+    // Hiz siniri: aradaki degisimler bir sonraki mesajda birlesir
+    if (counters.messages > 0 && now - lastMessage < minInterval) return 0;
+    if (cap < REMOVED_RESERVE + 64) return 0;
+
+    if (full) {
+        fullRequested.store(false, std::memory_order_relaxed);
+        sent.clear();
+    }
+
+    size_t budget = cap - REMOVED_RESERVE;
+    size_t len = (size_t)snprintf(out, cap, "{\"full\":%s,\"devices\":[", full ? "true" : "false");
+    bool more = false;
+    uint32_t devices = 0;
+    epoch++;
+
+    for (size_t i = 0; i < snapshot.count; i++) {
+        const VictronData& data = snapshot.devices[i];
+        uint32_t hash = deviceHash(data);
+        Entry* e = sent.find(data.mac);
+        if (e != nullptr) {
+            e->epoch = epoch;
+            if (e->hash == hash) continue;
+        }
+
+        char obj[DEVICE_JSON_OBJECT_MAX];
+        size_t n = writeDeviceJson(data, DEVICE_JSON_ALL_FIELDS, obj, sizeof(obj));
+        if (n == 0) continue;
+        size_t need = n + (devices > 0 ? 1 : 0);
+        if (len + need >= budget) {
+            more = true; // Sonraki mesaja kalir (ozet guncellenmedi)
+            continue;
+        }
+        if (e == nullptr) {
+            e = sent.insert(data.mac);
+            if (e == nullptr) continue;
+            e->epoch = epoch;
+        }
+        if (devices > 0) out[len++] = ',';
+        memcpy(out + len, obj, n);
+        len += n;
+        e->hash = hash;
+        devices++;
+    }
+
+    // Snapshot'tan dusen (expire olan) cihazlar
+    uint64_t removed[LIVE_FEED_MAX_REMOVED];
+    size_t removedCount = 0;
+    sent.forEach([&](const Entry& e) {
+        if (e.epoch == epoch) return;
+        if (removedCount < LIVE_FEED_MAX_REMOVED) removed[removedCount++] = e.mac;
+        else more = true;
+    });
+
+    len += (size_t)snprintf(out + len, cap - len, "],\"removed\":[");
+    for (size_t i = 0; i < removedCount; i++) {
+        char mac[18];
+        formatMacAddress(removed[i], mac);
+        len += (size_t)snprintf(out + len, cap - len, "%s\"%s\"", i > 0 ? "," : "", mac);
+        sent.remove(removed[i]);
+    }
+    len += (size_t)snprintf(out + len, cap - len, "]}");
+
+    backlog = more;
+    lastVersion = snapshot.version;
+    if (!full && devices == 0 && removedCount == 0) return 0;
+
+    lastMessage = now;
+    if (full) {
+        lastFullSync = now;
+        counters.fullSyncs++;
+    }
+    counters.messages++;
+    counters.devicesSent += devices;
+    counters.bytes += (uint32_t)len;
+    return len;
+}
@@ -0,0 +1,71 @@
+#ifndef LIVE_FEED_H
+#define LIVE_FEED_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+#include "MacTable.h"
+#include "VictronBLE.h"
+
+// Web paneli icin canli itme (SSE, /api/events) mesajlari.
+//
+// Her cihaz icin en son itilen degerlerin ozeti (FNV-1a, RSSI haric)
+// tutulur; mesaja sadece degeri degisen cihazlar ve snapshot'tan dusen
+// MAC'ler girer. Iki mesaj arasinda en az minInterval gecer: aradaki
+// degisimler tek mesajda birlesir (sadece son hal gider). Mesaj sabit
+// tampona sigmayan cihazlar bir sonraki mesaja kalir. Mesaj bir kez uretilir,
+// bagli tum istemcilere ayni metin gider.
+//
+// Mesaj: {"full":false,"devices":[{...}],"removed":["aa:bb:.."]}
+// full=true iken istemci listesini bastan kurar (yeni istemci baglaninca ve
+// LIVE_FEED_FULL_SYNC_MS'de bir, kacirilan mesajlari onarmak icin).
+//
+// poll() sadece loop tarafindan, requestFullSync() herhangi bir task'tan.
+
+#ifndef LIVE_PUSH_INTERVAL_MS
+#define LIVE_PUSH_INTERVAL_MS 500   // En yuksek itme hizi (build flag ile degistirilebilir)
+#endif
+#define LIVE_FEED_FULL_SYNC_MS 30000
+#define LIVE_FEED_MESSAGE_MAX 2048
+#define LIVE_FEED_MAX_REMOVED 16     // Mesaj basina
+
+struct LiveFeedStats {
+    uint32_t messages;       // Uretilen mesaj
+    uint32_t fullSyncs;
+    uint32_t devicesSent;    // Mesajlara yazilan cihaz nesnesi
+    uint32_t bytes;
+};
+
+class LiveFeed {
+public:
+    explicit LiveFeed(uint32_t minIntervalMs = LIVE_PUSH_INTERVAL_MS) : minInterval(minIntervalMs) {}
+
+    void setMinInterval(uint32_t ms) { minInterval = ms; }
+    void requestFullSync() { fullRequested.store(true, std::memory_order_relaxed); }
+
+    // Zamani geldiyse ve gonderilecek bir sey varsa mesaji out'a yazar
+    // (sifir sonlu), uzunlugunu dondurur; yoksa 0.
+    size_t poll(const VictronSnapshot& snapshot, unsigned long now, char* out, size_t cap);
+
+    const LiveFeedStats& stats() const { return counters; }
+
+private:
+    struct Entry {
+        uint64_t mac = 0;
+        unsigned long lastSeen = 0;   // MacTable geregi, kullanilmaz (expire yok)
+        uint32_t hash = 0;            // Son itilen degerlerin ozeti
+        uint32_t epoch = 0;           // Son poll'da snapshot'ta vardi
+    };
+
+    MacTable<Entry, VICTRON_DEVICE_TABLE_SIZE> sent;
+    uint32_t minInterval;
+    std::atomic<bool> fullRequested{true};
+    unsigned long lastMessage = 0;
+    unsigned long lastFullSync = 0;
+    uint32_t lastVersion = 0;
+    uint32_t epoch = 0;
+    bool backlog = false;             // Onceki mesaja sigmayan degisim var
+    LiveFeedStats counters = {};
+};
+
+#endif
@@ -0,0 +1,127 @@
+#ifndef MAC_TABLE_H
+#define MAC_TABLE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// 48-bit MAC (uint64_t) anahtarli, sabit kapasiteli open-addressing tablo.
+// Heap kullanmaz; kayitlar slot dizisinde inline durur. Linear probing +
+// backward-shift silme (tombstone yok).
+//
+// Entry gereksinimleri:
+//   uint64_t mac;            // 0 = bos slot
+//   unsigned long lastSeen;  // 0 = canli kayit yok (expire dokunmaz)
+//   kopyalanabilir olmali (silmede slotlar kaydirilir)
+template <typename Entry, size_t Capacity>
+class MacTable {
+    static_assert(Capacity >= 8 && (Capacity & (Capacity - 1)) == 0, "Capacity 2'nin kuvveti olmali");
+
+public:
+    // Probe zincirleri kisa kalsin diye doluluk %75 ile sinirli
+    static const size_t MAX_ENTRIES = Capacity * 3 / 4;
+
+    Entry* find(uint64_t mac) {
+        if (mac == 0) return nullptr;
+        for (size_t i = slotFor(mac);; i = (i + 1) & MASK) {
+            if (slots[i].mac == mac) return &slots[i];
+            if (slots[i].mac == 0) return nullptr;
+        }
+    }
+
+    const Entry* find(uint64_t mac) const {
+        return const_cast<MacTable*>(this)->find(mac);
+    }
+
+    // Bul veya ekle. Tablo doluysa nullptr.
+    Entry* insert(uint64_t mac) {
+        if (mac == 0) return nullptr;
+        size_t i = slotFor(mac);
+        for (;; i = (i + 1) & MASK) {
+            if (slots[i].mac == mac) return &slots[i];
+            if (slots[i].mac == 0) break;
+        }
+        if (count >= MAX_ENTRIES) return nullptr;
+        slots[i] = Entry();
+        slots[i].mac = mac;
+        count++;
+        return &slots[i];
+    }
+
+    bool remove(uint64_t mac) {
+        Entry* e = find(mac);
+        if (e == nullptr) return false;
+
+        // Backward-shift: bosalan slotun arkasindaki zinciri geri cek
+        size_t hole = (size_t)(e - slots);
+        for (size_t i = (hole + 1) & MASK; slots[i].mac != 0; i = (i + 1) & MASK) {
+            size_t home = slotFor(slots[i].mac);
+            // home, (hole, i] araliginda degilse kayit deligin yerine gecebilir
+            if (((i - home) & MASK) >= ((i - hole) & MASK)) {
+                slots[hole] = slots[i];
+                hole = i;
+            }
+        }
+        slots[hole] = Entry();
+        count--;
+        return true;
+    }
+
+    // lastSeen'i maxAgeMs'den eski kayitlar icin onStale(entry) cagrilir.
+    // onStale true donerse kayit tablodan silinir, false donerse kayit
+    // tabloda kalir ama lastSeen = 0 yapilir (canli veri yok).
+    // Donus: islenen eski kayit sayisi.
+    template <typename Fn>
+    size_t expire(unsigned long now, unsigned long maxAgeMs, Fn onStale) {
+        size_t expired = 0;
+        size_t i = 0;
+        while (i < Capacity) {
+            Entry& e = slots[i];
+            if (e.mac != 0 && e.lastSeen != 0 && now - e.lastSeen > maxAgeMs) {
+                expired++;
+                if (onStale(e)) {
+                    // Silme bu slota yeni bir kayit kaydirabilir, ayni slotu tekrar kontrol et
+                    remove(e.mac);
+                    continue;
+                }
+                e.lastSeen = 0;
+            }
+            i++;
+        }
+        return expired;
+    }
+
+    template <typename Fn>
+    void forEach(Fn fn) {
+        for (size_t i = 0; i < Capacity; i++) {
+            if (slots[i].mac != 0) fn(slots[i]);
+        }
+    }
+
+    template <typename Fn>
+    void forEach(Fn fn) const {
+        for (size_t i = 0; i < Capacity; i++) {
+            if (slots[i].mac != 0) fn(slots[i]);
+        }
+    }
+
+    void clear() {
+        for (size_t i = 0; i < Capacity; i++) slots[i] = Entry();
+        count = 0;
+    }
+
+    size_t size() const { return count; }
+    static constexpr size_t capacity() { return Capacity; }
+
+private:
+    static const size_t MASK = Capacity - 1;
+
+    // Fibonacci hashing: ardisik MAC'ler de iyi dagilir
+    static size_t slotFor(uint64_t mac) {
+        return (size_t)((mac * 0x9E3779B97F4A7C15ULL) >> 40) & MASK;
+    }
+
+    Entry slots[Capacity];
+    size_t count = 0;
+};
+
+#endif
@@ -0,0 +1,243 @@
+#include "Metrics.h"
+#include <Arduino.h>
+#include <atomic>
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+// --- Loop suresi: loop yazar, web handler okur ---
+static std::atomic<uint32_t> loopIterations{0};
+static std::atomic<uint32_t> loopMaxUs{0};      // Onceki tam pencere
+static uint32_t loopWindowMaxUs = 0;             // Suren pencere (sadece loop)
+static unsigned long loopWindowStart = 0;
+
+void metricsLoopTick(uint32_t durationUs) {
+    loopIterations.fetch_add(1, std::memory_order_relaxed);
+    if (durationUs > loopWindowMaxUs) loopWindowMaxUs = durationUs;
+    unsigned long now = millis();
+    if (now - loopWindowStart >= METRICS_LOOP_WINDOW_MS) {
+        loopMaxUs.store(loopWindowMaxUs, std::memory_order_relaxed);
+        loopWindowMaxUs = 0;
+        loopWindowStart = now;
+    }
+}
+
+void metricsLoopStats(uint32_t& iterations, uint32_t& maxUs) {
+    iterations = loopIterations.load(std::memory_order_relaxed);
+    maxUs = loopMaxUs.load(std::memory_order_relaxed);
+}
+
+namespace {
+
+struct Family {
+    const char* name;
+    const char* type;
+    const char* help;
+};
+
+struct GatewayFamily {
+    Family family;
+    double GatewayMetrics::*value;
+};
+
+const GatewayFamily GATEWAY_FAMILIES[] = {
+    {{"gateway_uptime_seconds", "gauge", "Seconds since boot"}, &GatewayMetrics::uptimeSec},
+    {{"gateway_heap_free_bytes", "gauge", "Free heap"}, &GatewayMetrics::heapFree},
+    {{"gateway_heap_min_free_bytes", "gauge", "Lowest free heap since boot"}, &GatewayMetrics::heapMinFree},
+    {{"gateway_heap_max_alloc_bytes", "gauge", "Largest allocatable heap block"}, &GatewayMetrics::heapMaxAlloc},
+    {{"gateway_loop_iterations_total", "counter", "Main loop iterations"}, &GatewayMetrics::loopIterations},
+    {{"gateway_loop_max_seconds", "gauge", "Longest main loop iteration in the last 10 s"}, &GatewayMetrics::loopMaxSec},
+    {{"gateway_wifi_rssi_dbm", "gauge", "WiFi station RSSI"}, &GatewayMetrics::wifiRssi},
+    {{"gateway_ble_queue_depth", "gauge", "BLE advert queue depth"}, &GatewayMetrics::bleQueueDepth},
+    {{"gateway_ble_queue_capacity", "gauge", "BLE advert queue capacity"}, &GatewayMetrics::bleQueueCapacity},
+    {{"gateway_ble_queue_high_water", "gauge", "BLE advert queue high water mark"}, &GatewayMetrics::bleQueueHighWater},
+    {{"gateway_ble_queue_drops_total", "counter", "BLE adverts dropped on a full queue"}, &GatewayMetrics::bleQueueDrops},
+    {{"gateway_ble_decodes_total", "counter", "Decrypted and decoded frames, all devices"}, &GatewayMetrics::bleDecodes},
+    {{"gateway_ble_duplicates_total", "counter", "Repeated frames skipped, all devices"}, &GatewayMetrics::bleDuplicates},
+    {{"gateway_ble_scan_duty_ratio", "gauge", "BLE scan window / interval"}, &GatewayMetrics::bleScanDuty},
+    {{"gateway_ble_scan_coverage_ratio", "gauge", "Decoded / (decoded + lost) frames in the last scan window"}, &GatewayMetrics::bleScanCoverage},
+    {{"gateway_ble_scan_restarts_total", "counter", "BLE scan restarts"}, &GatewayMetrics::bleScanRestarts},
+    {{"gateway_uplink_queue_depth", "gauge", "Uplink batch queue depth"}, &GatewayMetrics::uplinkQueueDepth},
+    {{"gateway_uplink_queue_drops_total", "counter", "Uplink batches dropped on a full queue"}, &GatewayMetrics::uplinkQueueDrops},
+    {{"gateway_uplink_delivered_total", "counter", "Uplink batches delivered live"}, &GatewayMetrics::uplinkDelivered},
+    {{"gateway_uplink_spilled_total", "counter", "Uplink batches spilled to flash"}, &GatewayMetrics::uplinkSpilled},
+    {{"gateway_uplink_requests_total", "counter", "Uplink HTTP requests"}, &GatewayMetrics::uplinkRequests},
+    {{"gateway_uplink_failures_total", "counter", "Failed uplink HTTP requests"}, &GatewayMetrics::uplinkFailures},
+    {{"gateway_flash_pending_records", "gauge", "Telemetry records waiting in flash"}, &GatewayMetrics::flashPending},
+    {{"gateway_sse_clients", "gauge", "Connected live feed clients"}, &GatewayMetrics::sseClients},
+};
+const uint8_t GATEWAY_FAMILY_COUNT = sizeof(GATEWAY_FAMILIES) / sizeof(GATEWAY_FAMILIES[0]);
+
+enum DeviceFamily : uint8_t {
+    DF_RSSI = 0,
+    DF_RSSI_EWMA,
+    DF_ADVERTS,
+    DF_DUPLICATES,
+    DF_DECODES,
+    DF_LOST,
+    DF_KEY_CHECK_FAILS,
+    DF_DECODE_ERRORS,
+    DF_LAST_GOOD_AGE,
+    DF_INTERVAL,
+    DF_COUNT
+};
+
+const Family DEVICE_FAMILIES[DF_COUNT] = {
+    {"victron_rssi_dbm", "gauge", "RSSI of the last advert"},
+    {"victron_rssi_ewma_dbm", "gauge", "RSSI moving average (alpha 1/8)"},
+    {"victron_adverts_total", "counter", "Adverts received, repeats included"},
+    {"victron_duplicate_adverts_total", "counter", "Repeated frames skipped without decrypting"},
+    {"victron_decodes_total", "counter", "Frames decrypted and decoded"},
+    {"victron_frames_lost_total", "counter", "Frames missed, from IV counter gaps"},
+    {"victron_key_check_failures_total", "counter", "Adverts whose key check byte did not match the configured key"},
+    {"victron_decode_errors_total", "counter", "Decrypted frames with an unknown record type"},
+    {"victron_last_good_age_seconds", "gauge", "Seconds since the last valid record"},
+    {"victron_advert_interval_seconds", "histogram", "Time between adverts"},
+};
+
+// Sinirli yazici: tasma olursa ok = false, sonraki yazimlar yok sayilir
+struct LineWriter {
+    char* out;
+    size_t cap;
+    size_t len;
+    bool ok;
+
+    void raw(const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+    void header(const Family& f) { raw("# HELP %s %s\n# TYPE %s %s\n", f.name, f.help, f.name, f.type); }
+};
+
+void LineWriter::raw(const char* fmt, ...) {
+    if (!ok) return;
+    va_list args;
+    va_start(args, fmt);
+    int n = vsnprintf(out + len, cap - len, fmt, args);
+    va_end(args);
+    if (n < 0 || (size_t)n >= cap - len) {
+        ok = false;
+        return;
+    }
+    len += (size_t)n;
+}
+
+} // namespace
+
+GatewayMetrics::GatewayMetrics() {
+    for (uint8_t i = 0; i < GATEWAY_FAMILY_COUNT; i++) this->*GATEWAY_FAMILIES[i].value = NAN;
+}
+
+bool MetricsStream::renderGateway() {
+    while (family < GATEWAY_FAMILY_COUNT) {
+        const GatewayFamily& g = GATEWAY_FAMILIES[family++];
+        double value = gateway.*g.value;
+        if (isnan(value)) continue; // Olculmedi (ornegin WiFi bagli degil)
+        LineWriter w = {pending, sizeof(pending), 0, true};
+        w.header(g.family);
+        w.raw("%s %.10g\n", g.family.name, value);
+        if (!w.ok) continue;
+        pendingLen = w.len;
+        return true;
+    }
+    return false;
+}
+
+bool MetricsStream::renderDevice() {
+    while (family < DF_COUNT) {
+        VictronRxStats item;
+        if (!scanner.getRxStatsAfter(lastMac, item)) {
+            family++;
+            lastMac = 0;
+            continue;
+        }
+        const Family& f = DEVICE_FAMILIES[family];
+        const DeviceRxStats& rx = item.rx;
+        char mac[18];
+        formatMacAddress(item.mac, mac);
+
+        LineWriter w = {pending, sizeof(pending), 0, true};
+        if (lastMac == 0) w.header(f);
+        lastMac = item.mac;
+
+        switch ((DeviceFamily)family) {
+        case DF_RSSI:
+            if (rx.lastAdvertAt) w.raw("%s{mac=\"%s\"} %d\n", f.name, mac, rx.rssiLast);
+            break;
+        case DF_RSSI_EWMA:
+            if (rx.lastAdvertAt) w.raw("%s{mac=\"%s\"} %.1f\n", f.name, mac, (double)rx.rssiEwma);
+            break;
+        case DF_ADVERTS:
+            w.raw("%s{mac=\"%s\"} %lu\n", f.name, mac, (unsigned long)rx.adverts);
+            break;
+        case DF_DUPLICATES:
+            w.raw("%s{mac=\"%s\"} %lu\n", f.name, mac, (unsigned long)rx.duplicates);
+            break;
+        case DF_DECODES:
+            w.raw("%s{mac=\"%s\"} %lu\n", f.name, mac, (unsigned long)rx.decodes);
+            break;
+        case DF_LOST:
+            w.raw("%s{mac=\"%s\"} %lu\n", f.name, mac, (unsigned long)rx.lost);
+            break;
+        case DF_KEY_CHECK_FAILS:
+            w.raw("%s{mac=\"%s\"} %lu\n", f.name, mac, (unsigned long)rx.keyCheckFails);
+            break;
+        case DF_DECODE_ERRORS:
+            w.raw("%s{mac=\"%s\"} %lu\n", f.name, mac, (unsigned long)rx.decodeErrors);
+            break;
+        case DF_LAST_GOOD_AGE:
+            // Gecerli kayit hic yoksa ornek yazilmaz (yas tanimsiz). Akis
+            // surerken yeniden yayinlanan kayit now'dan yeni olabilir: 0.
+            if (rx.lastGoodAt) {
+                unsigned long age = (long)(now - rx.lastGoodAt) > 0 ? now - rx.lastGoodAt : 0;
+                w.raw("%s{mac=\"%s\"} %.3f\n", f.name, mac, (double)age / 1000.0);
+            }
+            break;
+        case DF_INTERVAL: {
+            uint32_t cumulative = 0;
+            for (int b = 0; b < VICTRON_RX_INTERVAL_BUCKETS - 1; b++) {
+                cumulative += rx.intervalBuckets[b];
+                w.raw("%s_bucket{mac=\"%s\",le=\"%g\"} %lu\n", f.name, mac,
+                      VICTRON_RX_INTERVAL_BOUNDS_MS[b] / 1000.0, (unsigned long)cumulative);
+            }
+            w.raw("%s_bucket{mac=\"%s\",le=\"+Inf\"} %lu\n", f.name, mac, (unsigned long)rx.intervalCount);
+            w.raw("%s_sum{mac=\"%s\"} %.3f\n", f.name, mac, (double)rx.intervalSumMs / 1000.0);
+            w.raw("%s_count{mac=\"%s\"} %lu\n", f.name, mac, (unsigned long)rx.intervalCount);
+            break;
+        }
+        default:
+            break;
+        }
+        if (!w.ok) continue; // Sigmayan satir atlanir (METRICS_LINE_MAX yeterli, olmamali)
+        pendingLen = w.len;
+        return true;
+    }
+    return false;
+}
+
+size_t MetricsStream::fill(uint8_t* buf, size_t maxLen) {
+    size_t written = 0;
+    while (written < maxLen) {
+        if (pendingPos < pendingLen) {
+            size_t n = pendingLen - pendingPos;
+            if (n > maxLen - written) n = maxLen - written;
+            memcpy(buf + written, pending + pendingPos, n);
+            pendingPos += n;
+            written += n;
+            continue;
+        }
+
+        pendingPos = 0;
+        pendingLen = 0;
+        if (stage == STAGE_GATEWAY) {
+            if (!renderGateway()) {
+                stage = STAGE_DEVICES;
+                family = 0;
+                lastMac = 0;
+            }
+        } else if (stage == STAGE_DEVICES) {
+            if (!renderDevice()) stage = STAGE_DONE;
+        } else {
+            break;
+        }
+    }
+    return written;
+}
@@ -0,0 +1,85 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "VictronBLE.h"
+
+// /api/metrics icin Prometheus metin formati (0.0.4) ureticisi.
+//
+// Gecit metrikleri (heap, calisma suresi, loop, kuyruklar) istek aninda
+// GatewayMetrics'e toplanir; cihaz metrikleri yayinlanmis alim
+// istatistiklerinden (VictronBLE::getRxStatsAfter) MAC sirasiyla okunur.
+// Prometheus ayni ailenin orneklerini bir arada ister: her aile icin
+// cihazlar bastan gezilir, kopya tutulmaz. Istek basina bellek sabittir
+// (~1 KB), cikti chunked yazilir (DeviceJsonStream ile ayni yapi).
+//
+// Saf metin uretimi: donanima dokunmaz, host benchmark'inda da calisir.
+
+#define METRICS_LINE_MAX 1024   // Tek aile basligi ya da tek cihazin histogrami (~750 byte)
+#define METRICS_LOOP_WINDOW_MS 10000
+
+// Gecit geneli degerler. NAN = yok, ornek yazilmaz.
+struct GatewayMetrics {
+    double uptimeSec;
+    double heapFree;
+    double heapMinFree;
+    double heapMaxAlloc;
+    double loopIterations;
+    double loopMaxSec;          // Son METRICS_LOOP_WINDOW_MS icindeki en uzun loop
+    double wifiRssi;
+    double bleQueueDepth;
+    double bleQueueCapacity;
+    double bleQueueHighWater;
+    double bleQueueDrops;
+    double bleDecodes;
+    double bleDuplicates;
+    double bleScanDuty;         // window / interval
+    double bleScanCoverage;     // Son pencere
+    double bleScanRestarts;
+    double uplinkQueueDepth;
+    double uplinkQueueDrops;
+    double uplinkDelivered;
+    double uplinkSpilled;
+    double uplinkRequests;
+    double uplinkFailures;
+    double flashPending;
+    double sseClients;
+
+    GatewayMetrics();
+};
+
+// Loop suresi (mikrosaniye); loop sonunda bir kez, sadece loop'tan
+void metricsLoopTick(uint32_t durationUs);
+// Toplam loop sayisi ve son pencerenin en uzun loop'u. Herhangi bir task'tan.
+void metricsLoopStats(uint32_t& iterations, uint32_t& maxUs);
+
+class MetricsStream {
+public:
+    // now: yas metrikleri icin millis
+    MetricsStream(const VictronBLE& scanner, const GatewayMetrics& gateway, unsigned long now)
+        : scanner(scanner), gateway(gateway), now(now) {}
+
+    // AsyncWebServer chunked callback'i: buf'a en fazla maxLen byte yazar,
+    // 0 donerse yanit bitmistir.
+    size_t fill(uint8_t* buf, size_t maxLen);
+
+private:
+    enum Stage : uint8_t { STAGE_GATEWAY = 0, STAGE_DEVICES, STAGE_DONE };
+
+    bool renderGateway();
+    bool renderDevice();
+
+    const VictronBLE& scanner;
+    GatewayMetrics gateway;
+    unsigned long now;
+
+    Stage stage = STAGE_GATEWAY;
+    uint8_t family = 0;
+    uint64_t lastMac = 0;     // Ailede son yazilan cihaz; 0 = aile basligi yazilmadi
+    char pending[METRICS_LINE_MAX];
+    size_t pendingLen = 0;
+    size_t pendingPos = 0;
+};
+
+#endif
@@ -0,0 +1,39 @@
+#include "ScanPolicy.h"
+
+// Gorev orani %25 / %50 / %75 / %95. Interval kisaldikca kanal degisimi
+// siklasir; Victron reklamlari 3 kanala dagildigi icin pencere >= 40 ms.
+const ScanDuty SCAN_DUTY_TABLE[SCAN_DUTY_LEVELS] = {
+    {160, 40},
+    {100, 50},
+    {100, 75},
+    {100, 95},
+};
+
+bool ScanPolicy::onWindow(const ScanWindow& window) {
+    uint8_t next = current;
+    bool lowered = false;
+
+    if (window.frames + window.lost >= SCAN_POLICY_MIN_FRAMES) {
+        uint16_t coverage = window.coverage();
+        if (coverage < SCAN_COVERAGE_LOW) {
+            goodWindows = 0;
+            if (justLowered && downAfter < SCAN_DOWN_WINDOWS_MAX) downAfter *= 2; // Dusurmek yaramadi
+            if (current + 1 < SCAN_DUTY_LEVELS) next = current + 1;
+        } else if (coverage >= SCAN_COVERAGE_HIGH) {
+            if (++goodWindows >= downAfter && current > 0) {
+                next = current - 1;
+                goodWindows = 0;
+                lowered = true;
+            }
+        } else {
+            goodWindows = 0;
+        }
+    }
+    justLowered = lowered;
+
+    if (window.wifiTx >= SCAN_WIFI_BUSY_EVENTS && next > SCAN_WIFI_BUSY_MAX_LEVEL) next = SCAN_WIFI_BUSY_MAX_LEVEL;
+
+    bool changed = next != current;
+    current = next;
+    return changed;
+}
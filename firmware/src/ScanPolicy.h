@@ -0,0 +1,78 @@
+#ifndef SCAN_POLICY_H
+#define SCAN_POLICY_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Surekli BLE taramasinin gorev orani (window / interval) secimi.
+//
+// Tarama bitmeden surer (5 sn'lik pencereler ve aradaki bosluklar yok),
+// sonuc listesi tutulmaz. Istatistik SCAN_STATS_WINDOW_MS'lik pencerelerde
+// toplanir: Victron her yeni sifreli cercevede IV sayacini bir artirir, iki
+// cozulen cerceve arasindaki IV boslugu kacirilan cerceve sayisidir. Kapsama
+// = cozulen / (cozulen + kacirilan).
+//
+// Pencere sonunda (onWindow):
+//  - kapsama SCAN_COVERAGE_LOW altindaysa gorev orani bir seviye artar,
+//  - ardisik pencerelerde SCAN_COVERAGE_HIGH ustundeyse bir seviye duser
+//    (radyo zamani WiFi'ye kalir). Dusurulen seviye hemen kayip verirse bir
+//    sonraki dusurme icin beklenen pencere sayisi ikiye katlanir (salinim olmaz),
+//  - WiFi gonderimi yogunsa (uplink, SSE, web) seviye SCAN_WIFI_BUSY_MAX_LEVEL
+//    ile sinirlanir: BLE ve WiFi ayni radyoyu paylasir.
+// Yeterli ornek yoksa (cihaz duyulmuyor) seviye degismez.
+//
+// Saf hesap: donanima dokunmaz, host benchmark'inda da calisir.
+
+#define SCAN_STATS_WINDOW_MS 30000
+#define SCAN_STATS_HISTORY 8           // /api/ble-stats'ta gosterilen son pencereler
+#define SCAN_MAX_IV_GAP 64             // Daha buyuk bosluk: cihaz yeniden basladi / menzil disi, sayilmaz
+#define SCAN_POLICY_MIN_FRAMES 20      // Karar icin pencerede en az (cozulen + kacirilan)
+#define SCAN_COVERAGE_LOW 950          // Binde
+#define SCAN_COVERAGE_HIGH 990
+#define SCAN_DOWN_WINDOWS 3            // Dusurmeden once ust uste iyi pencere
+#define SCAN_DOWN_WINDOWS_MAX 32
+#define SCAN_WIFI_BUSY_EVENTS 20       // Pencere basina WiFi gonderimi: yogun
+#define SCAN_WIFI_BUSY_MAX_LEVEL 1
+
+struct ScanDuty {
+    uint16_t intervalMs;
+    uint16_t windowMs;
+};
+
+static const uint8_t SCAN_DUTY_LEVELS = 4;
+extern const ScanDuty SCAN_DUTY_TABLE[SCAN_DUTY_LEVELS];
+#define SCAN_DEFAULT_LEVEL 1           // 100/50 ms: eski sabit ayar
+
+struct ScanWindow {
+    unsigned long startedAt = 0;   // millis
+    uint32_t durationMs = 0;
+    uint32_t adverts = 0;          // Victron reklamlari (tekrarlar dahil)
+    uint32_t frames = 0;           // Cozulen yeni cerceveler
+    uint32_t lost = 0;             // IV bosluklarindan kacirilan cerceveler
+    uint32_t drops = 0;            // Reklam kuyrugu tasmasi
+    uint32_t wifiTx = 0;           // WiFi gonderim olaylari
+    uint8_t level = SCAN_DEFAULT_LEVEL;
+
+    // Binde kapsama, ornek yoksa 1000
+    uint16_t coverage() const {
+        uint32_t total = frames + lost;
+        return total ? (uint16_t)((uint64_t)frames * 1000 / total) : 1000;
+    }
+};
+
+class ScanPolicy {
+public:
+    uint8_t level() const { return current; }
+    const ScanDuty& duty() const { return SCAN_DUTY_TABLE[current]; }
+
+    // Biten pencereye gore seviye. Degistiyse true (tarama yeni ayarla baslatilir).
+    bool onWindow(const ScanWindow& window);
+
+private:
+    uint8_t current = SCAN_DEFAULT_LEVEL;
+    uint8_t goodWindows = 0;
+    uint8_t downAfter = SCAN_DOWN_WINDOWS;
+    bool justLowered = false;
+};
+
+#endif
@@ -0,0 +1,72 @@
+#ifndef SPSC_RING_H
+#define SPSC_RING_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+
+// Sabit kapasiteli, kilitsiz tek-uretici / tek-tuketici halka.
+// Uretici (orn. NimBLE callback) sadece reserve/commit, tuketici (loop)
+// sadece front/pop cagirir. Slotlar yerinde yazilip okunur, kopya yok.
+template <typename T, size_t Capacity>
+class SpscRing {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity 2'nin kuvveti olmali");
+
+public:
+    // --- Uretici tarafi ---
+
+    // Bos slot dondurur; halka doluysa nullptr (ve drop sayaci artar).
+    T* reserve() {
+        uint32_t head = head_.load(std::memory_order_relaxed);
+        uint32_t tail = tail_.load(std::memory_order_acquire);
+        if (head - tail >= Capacity) {
+            drops_.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        return &slots_[head & MASK];
+    }
+
+    // reserve() ile alinan slotu tuketiciye yayinla
+    void commit() {
+        uint32_t head = head_.load(std::memory_order_relaxed) + 1;
+        head_.store(head, std::memory_order_release);
+
+        uint32_t depth = head - tail_.load(std::memory_order_relaxed);
+        if (depth > highWater_.load(std::memory_order_relaxed)) {
+            highWater_.store(depth, std::memory_order_relaxed);
+        }
+    }
+
+    // --- Tuketici tarafi ---
+
+    // Siradaki eleman; halka bossa nullptr. pop() cagrilana kadar gecerli.
+    const T* front() const {
+        uint32_t tail = tail_.load(std::memory_order_relaxed);
+        if (head_.load(std::memory_order_acquire) == tail) return nullptr;
+        return &slots_[tail & MASK];
+    }
+
+    void pop() {
+        tail_.store(tail_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    // --- Istatistik (her iki taraftan okunabilir) ---
+
+    size_t size() const {
+        return (size_t)(head_.load(std::memory_order_acquire) - tail_.load(std::memory_order_acquire));
+    }
+    uint32_t drops() const { return drops_.load(std::memory_order_relaxed); }
+    uint32_t highWater() const { return highWater_.load(std::memory_order_relaxed); }
+    static constexpr size_t capacity() { return Capacity; }
+
+private:
+    static const uint32_t MASK = Capacity - 1;
+
+    T slots_[Capacity];
+    std::atomic<uint32_t> head_{0};      // Uretici yazar
+    std::atomic<uint32_t> tail_{0};      // Tuketici yazar
+    std::atomic<uint32_t> drops_{0};     // Halka doluyken gelen reklamlar
+    std::atomic<uint32_t> highWater_{0}; // Gorulen en yuksek doluluk
+};
+
+#endif
@@ -0,0 +1,328 @@
+#include "TelemetryCodec.h"
+#include <math.h>
+#include <string.h>
+
+const TelemetryFieldInfo TELEMETRY_FIELDS[TELEMETRY_FIELD_COUNT] = {
+    {"voltage",        0.01f,  false, 0.0f},
+    {"current",        0.001f, false, 0.0f},
+    {"power",          0.1f,   false, 0.0f},
+    {"temperature",    0.1f,   false, -999.0f},
+    {"alarm",          1.0f,   true,  0.0f},
+    {"soc",            0.1f,   false, 0.0f},
+    {"pv_power",       1.0f,   false, 0.0f},
+    {"pv_voltage",     0.01f,  false, 0.0f},
+    {"pv_current",     0.1f,   false, 0.0f},
+    {"load_current",   0.1f,   false, 0.0f},
+    {"device_state",   1.0f,   true,  0.0f},
+    {"yield_today",    0.01f,  false, 0.0f},
+    {"efficiency",     0.1f,   false, 0.0f},
+    {"consumed_ah",    0.1f,   false, 0.0f},
+    {"remaining_mins", 1.0f,   true,  0.0f},
+    {"aux_voltage",    0.01f,  false, 0.0f},
+    {"load_state",     1.0f,   true,  0.0f},
+};
+
+// Ham ornek: akim ve voltaj dinamigi buluta gitsin; guc ve PV gucu icin aralik istatistigi yeterli
+const TelemetrySampleMetricInfo TELEMETRY_SAMPLE_METRICS[SAMPLE_METRIC_COUNT] = {
+    {"voltage",  TF_VOLTAGE,  TELEMETRY_SAMPLE_STATS | TELEMETRY_SAMPLE_RAW},
+    {"current",  TF_CURRENT,  TELEMETRY_SAMPLE_STATS | TELEMETRY_SAMPLE_RAW},
+    {"power",    TF_POWER,    TELEMETRY_SAMPLE_STATS},
+    {"pv_power", TF_PV_POWER, TELEMETRY_SAMPLE_STATS},
+};
+
+void telemetryFieldValues(const VictronData& data, float power, float out[TELEMETRY_FIELD_COUNT]) {
+    out[TF_VOLTAGE] = data.voltage;
+    out[TF_CURRENT] = data.current;
+    out[TF_POWER] = power;
+    out[TF_TEMPERATURE] = data.temperature;
+    out[TF_ALARM] = (float)data.alarm;
+    out[TF_SOC] = data.soc;
+    out[TF_PV_POWER] = data.pvPower;
+    out[TF_PV_VOLTAGE] = data.pvVoltage;
+    out[TF_PV_CURRENT] = data.pvCurrent;
+    out[TF_LOAD_CURRENT] = data.loadCurrent;
+    out[TF_DEVICE_STATE] = (float)data.deviceState;
+    out[TF_YIELD_TODAY] = data.yieldToday;
+    out[TF_EFFICIENCY] = data.efficiency;
+    out[TF_CONSUMED_AH] = data.consumedAh;
+    out[TF_REMAINING_MINS] = (float)data.remainingMins;
+    out[TF_AUX_VOLTAGE] = data.auxVoltage;
+    out[TF_LOAD_STATE] = (float)data.loadState;
+}
+
+// --- Ikili format ---
+
+bool TelemetryEncoder::putByte(uint8_t value) {
+    if (pos >= cap) {
+        failed = true;
+        return false;
+    }
+    buf[pos++] = value;
+    return true;
+}
+
+bool TelemetryEncoder::putVarint(uint32_t value) {
+    while (value >= 0x80) {
+        if (!putByte((uint8_t)(value | 0x80))) return false;
+        value >>= 7;
+    }
+    return putByte((uint8_t)value);
+}
+
+bool TelemetryEncoder::putFixed(float value, float scale) {
+    int32_t v = (int32_t)lroundf(value / scale);
+    return putVarint(((uint32_t)v << 1) ^ (uint32_t)(v >> 31)); // zigzag
+}
+
+bool TelemetryEncoder::begin(const char* boatName, uint8_t envelopeFlags) {
+    pos = 0;
+    records = 0;
+    flags = envelopeFlags & TELEMETRY_FLAG_SAMPLES; // Yas sadece telemetrySetAge ile
+    failed = false;
+
+    size_t nameLen = strlen(boatName);
+    if (nameLen > 255) nameLen = 255;
+
+    putByte(TELEMETRY_MAGIC_0);
+    putByte(TELEMETRY_MAGIC_1);
+    putByte(TELEMETRY_FORMAT_VERSION);
+    putByte(flags);
+    putByte((uint8_t)nameLen);
+    for (size_t i = 0; i < nameLen; i++) putByte((uint8_t)boatName[i]);
+    countPos = pos;
+    putByte(0); // Kayit sayisi, finish() yazar
+    return !failed;
+}
+
+bool TelemetryEncoder::add(const VictronData& data, float power, const DeviceSamples* samples, uint32_t now) {
+    if (failed || records == 255) return false;
+
+    float values[TELEMETRY_FIELD_COUNT];
+    telemetryFieldValues(data, power, values);
+
+    int32_t fixed[TELEMETRY_FIELD_COUNT];
+    uint32_t bitmap = 0;
+    for (int f = 0; f < TELEMETRY_FIELD_COUNT; f++) {
+        if (values[f] == TELEMETRY_FIELDS[f].defaultValue) continue;
+        fixed[f] = (int32_t)lroundf(values[f] / TELEMETRY_FIELDS[f].scale);
+        bitmap |= 1UL << f;
+    }
+
+    // Kayit yarim kalirsa geri al
+    size_t start = pos;
+    for (int shift = 40; shift >= 0; shift -= 8) putByte((uint8_t)(data.mac >> shift));
+    putByte((uint8_t)data.type);
+    putVarint(bitmap);
+    for (int f = 0; f < TELEMETRY_FIELD_COUNT; f++) {
+        if (!(bitmap & (1UL << f))) continue;
+        int32_t v = fixed[f];
+        putVarint(((uint32_t)v << 1) ^ (uint32_t)(v >> 31)); // zigzag
+    }
+    if (flags & TELEMETRY_FLAG_SAMPLES) putSamples(samples, now);
+
+    if (failed) {
+        pos = start;
+        failed = false;
+        return false;
+    }
+    records++;
+    return true;
+}
+
+void TelemetryEncoder::putSamples(const DeviceSamples* samples, uint32_t now) {
+    uint8_t statsMask = 0, rawMask = 0;
+    if (samples != nullptr) {
+        for (int m = 0; m < SAMPLE_METRIC_COUNT; m++) {
+            uint8_t policy = TELEMETRY_SAMPLE_METRICS[m].policy;
+            if ((policy & TELEMETRY_SAMPLE_STATS) && samples->stats[m].count > 0) statsMask |= 1 << m;
+            if ((policy & TELEMETRY_SAMPLE_RAW) && !samples->ring.empty()) rawMask |= 1 << m;
+        }
+    }
+
+    putByte(statsMask);
+    for (int m = 0; m < SAMPLE_METRIC_COUNT; m++) {
+        if (!(statsMask & (1 << m))) continue;
+        const MetricAggregate& agg = samples->stats[m];
+        float scale = TELEMETRY_FIELDS[TELEMETRY_SAMPLE_METRICS[m].field].scale;
+        putVarint(agg.count);
+        putFixed(agg.min, scale);
+        putFixed(agg.max, scale);
+        putFixed(agg.mean(), scale);
+    }
+
+    putByte(rawMask);
+    if (rawMask == 0) return;
+    size_t n = samples->ring.size() > 255 ? 255 : samples->ring.size();
+    putByte((uint8_t)n);
+    for (size_t i = samples->ring.size() - n; i < samples->ring.size(); i++) {
+        const TelemetrySample& sample = samples->ring[i];
+        putVarint((now - sample.timestamp) / 100);
+        for (int m = 0; m < SAMPLE_METRIC_COUNT; m++) {
+            if (rawMask & (1 << m)) putFixed(sample.values[m], TELEMETRY_FIELDS[TELEMETRY_SAMPLE_METRICS[m].field].scale);
+        }
+    }
+}
+
+size_t TelemetryEncoder::finish() {
+    if (failed || countPos >= cap) return 0;
+    buf[countPos] = records;
+    return pos;
+}
+
+size_t telemetrySetAge(const uint8_t* batch, size_t len, uint32_t ageSeconds, uint8_t* out, size_t outCapacity) {
+    if (len < 5 || batch[0] != TELEMETRY_MAGIC_0 || batch[1] != TELEMETRY_MAGIC_1) return 0;
+    if (batch[3] & TELEMETRY_FLAG_AGE) return 0;
+
+    uint8_t age[5];
+    size_t ageLen = 0;
+    while (ageSeconds >= 0x80) {
+        age[ageLen++] = (uint8_t)(ageSeconds | 0x80);
+        ageSeconds >>= 7;
+    }
+    age[ageLen++] = (uint8_t)ageSeconds;
+
+    if (len + ageLen > outCapacity) return 0;
+    memcpy(out, batch, 3);
+    out[3] = batch[3] | TELEMETRY_FLAG_AGE;
+    memcpy(out + 4, age, ageLen);
+    memcpy(out + 4 + ageLen, batch + 4, len - 4);
+    return len + ageLen;
+}
+
+// --- Deflate (zlib, sabit Huffman) ---
+
+namespace {
+
+struct BitWriter {
+    uint8_t* out;
+    size_t cap;
+    size_t pos = 0;
+    uint32_t bits = 0;
+    int count = 0;
+    bool overflow = false;
+
+    // LSB-first (deflate bit sirasi)
+    void put(uint32_t value, int n) {
+        bits |= value << count;
+        count += n;
+        while (count >= 8) {
+            if (pos < cap) out[pos++] = (uint8_t)bits;
+            else overflow = true;
+            bits >>= 8;
+            count -= 8;
+        }
+    }
+
+    // Huffman kodlari MSB-first yazilir
+    void putCode(uint32_t code, int n) {
+        uint32_t reversed = 0;
+        for (int i = 0; i < n; i++) reversed |= ((code >> i) & 1) << (n - 1 - i);
+        put(reversed, n);
+    }
+
+    void flush() {
+        if (count > 0) put(0, 8 - count);
+    }
+};
+
+const uint16_t LENGTH_BASE[29] = {3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+                                  35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+const uint8_t LENGTH_EXTRA[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+                                  3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+const uint16_t DIST_BASE[30] = {1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+                                257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145,
+                                8193, 12289, 16385, 24577};
+const uint8_t DIST_EXTRA[30] = {0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+                                7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+
+// Sabit Huffman literal/length kodu (RFC 1951 3.2.6)
+void putSymbol(BitWriter& w, int sym) {
+    if (sym < 144) w.putCode(0x30 + sym, 8);
+    else if (sym < 256) w.putCode(0x190 + sym - 144, 9);
+    else if (sym < 280) w.putCode(sym - 256, 7);
+    else w.putCode(0xC0 + sym - 280, 8);
+}
+
+void putMatch(BitWriter& w, int length, int distance) {
+    int li = 28;
+    while (LENGTH_BASE[li] > length) li--;
+    putSymbol(w, 257 + li);
+    if (LENGTH_EXTRA[li]) w.put(length - LENGTH_BASE[li], LENGTH_EXTRA[li]);
+
+    int di = 29;
+    while (DIST_BASE[di] > distance) di--;
+    w.putCode(di, 5);
+    if (DIST_EXTRA[di]) w.put(distance - DIST_BASE[di], DIST_EXTRA[di]);
+}
+
+const int HASH_BITS = 12;
+const int MIN_MATCH = 3;
+const int MAX_MATCH = 258;
+const size_t MAX_DISTANCE = 32768;
+const size_t MAX_INPUT = 0xFFFF; // Hash tablosu 16-bit pozisyon tutar
+
+inline uint32_t hash3(const uint8_t* p) {
+    return ((p[0] << 16 | p[1] << 8 | p[2]) * 2654435761u) >> (32 - HASH_BITS);
+}
+
+} // namespace
+
+size_t telemetryDeflate(const uint8_t* in, size_t len, uint8_t* out, size_t outCapacity) {
+    if (len > MAX_INPUT) return 0;
+
+    // Pozisyon + 1 (0 = bos). Sadece uplink task'i cagirir; stack yerine static.
+    static uint16_t head[1 << HASH_BITS];
+    memset(head, 0, sizeof(head));
+
+    BitWriter w{out, outCapacity};
+    w.put(0x78, 8); // CMF: deflate, 32K pencere
+    w.put(0x01, 8); // FLG: en hizli seviye, (0x7801 % 31 == 0)
+    w.put(1, 1);    // BFINAL
+    w.put(1, 2);    // BTYPE = 01 sabit Huffman
+
+    size_t i = 0;
+    while (i < len) {
+        int bestLen = 0;
+        size_t bestDist = 0;
+        if (i + MIN_MATCH <= len) {
+            uint32_t h = hash3(&in[i]);
+            size_t candidate = head[h];
+            head[h] = (uint16_t)(i + 1);
+            if (candidate != 0 && i - (candidate - 1) <= MAX_DISTANCE) {
+                size_t c = candidate - 1;
+                size_t limit = len - i < (size_t)MAX_MATCH ? len - i : (size_t)MAX_MATCH;
+                size_t n = 0;
+                while (n < limit && in[c + n] == in[i + n]) n++;
+                if (n >= (size_t)MIN_MATCH) {
+                    bestLen = (int)n;
+                    bestDist = i - c;
+                }
+            }
+        }
+
+        if (bestLen > 0) {
+            putMatch(w, bestLen, (int)bestDist);
+            // Eslesmenin icindeki pozisyonlari da tabloya ekle
+            for (size_t k = i + 1; k < i + bestLen && k + MIN_MATCH <= len; k++) {
+                head[hash3(&in[k])] = (uint16_t)(k + 1);
+            }
+            i += bestLen;
+        } else {
+            putSymbol(w, in[i]);
+            i++;
+        }
+    }
+    putSymbol(w, 256); // Blok sonu
+    w.flush();
+
+    // Adler-32 (big-endian)
+    uint32_t a = 1, b = 0;
+    for (size_t k = 0; k < len; k++) {
+        a = (a + in[k]) % 65521;
+        b = (b + a) % 65521;
+    }
+    uint32_t adler = (b << 16) | a;
+    for (int shift = 24; shift >= 0; shift -= 8) w.put((adler >> shift) & 0xFF, 8);
+
+    return w.overflow ? 0 : w.pos;
+}
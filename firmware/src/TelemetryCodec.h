@@ -0,0 +1,138 @@
+#ifndef TELEMETRY_CODEC_H
+#define TELEMETRY_CODEC_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "VictronBLE.h"
+
+// Uplink icin kompakt telemetri kodlamalari (ingest_telemetry JSON'una alternatif).
+//
+// 1) Ikili format (application/x-victron-telemetry), surum 1:
+//
+//    Zarf:  'V' 'T' | surum u8 | bayrak u8 | [yas sn varint] | tekne adi uzunlugu u8
+//           | tekne adi | kayit sayisi u8 | kayitlar...
+//    Bayrak 0x01 (TELEMETRY_FLAG_AGE): olcum gonderimden bu kadar saniye once
+//    alindi (flash kuyrugundan gecikmeli gonderim). Govdede birden fazla zarf
+//    arka arkaya gelebilir.
+//    Kayit: MAC 6 byte (0xAABBCCDDEEFF sirasi) | device_type u8 | alan bitmap'i (varint)
+//           | bitmap'teki her alan icin sirayla deger (varint, isaretliler zigzag)
+//
+//    Degerler TELEMETRY_FIELDS tablosundaki olcekle sabit noktali tamsayidir
+//    (orn. voltaj 0.01V, akim 0.001A: Victron BLE cozunurlugu). Varsayilan
+//    degerdeki alanlar (0, sicaklik -999) bitmap'e girmez; charge_state
+//    gonderilmez, cozucu device_state'ten uretir. Tekne adi (boat_name) her
+//    satir yerine zarfta bir kez gider.
+//
+//    Bayrak 0x02 (TELEMETRY_FLAG_SAMPLES): her kaydin arkasinda aralik blogu
+//    (bkz. TelemetrySamples.h, metrik olcegi TELEMETRY_FIELDS'tan):
+//      istatistik maskesi u8 | maskedeki her metrik: adet varint, min, max, ortalama
+//      | ham ornek maskesi u8 | [maske != 0 ise] ornek sayisi u8 | ornek basina:
+//        yas varint (zarf aninda once, 100 ms birimi) | maskedeki metrik degerleri
+//
+// 2) Deflate: mevcut JSON govdesi zlib (RFC 1950) akisi olarak sikistirilir
+//    (Content-Encoding: deflate). Sabit Huffman + tum girdi uzerinde LZ77;
+//    pencere tamponu gerekmez, sadece 8 KB hash tablosu kullanir.
+//
+// Referans cozucu: TelemetryDecoder.h (ikili -> ingest_telemetry satirlari).
+// Sunucu cozucusu: supabase/functions/ingest-compact/decode.ts; alan tablosu
+// veya zarf degisirse ikisi birlikte guncellenir.
+
+#define TELEMETRY_MAGIC_0 'V'
+#define TELEMETRY_MAGIC_1 'T'
+#define TELEMETRY_FORMAT_VERSION 1
+#define TELEMETRY_FLAG_AGE 0x01
+#define TELEMETRY_FLAG_SAMPLES 0x02
+
+// Uplink govde formati (NVS "uplinkFmt")
+enum TelemetryFormat : uint8_t {
+    TELEMETRY_FORMAT_JSON = 0,
+    TELEMETRY_FORMAT_DEFLATE = 1,
+    TELEMETRY_FORMAT_BINARY = 2,
+};
+
+// Alan sirasi = bitmap bit sirasi. Yeni alan sadece sona eklenir.
+enum TelemetryField : uint8_t {
+    TF_VOLTAGE = 0,
+    TF_CURRENT,
+    TF_POWER,
+    TF_TEMPERATURE,
+    TF_ALARM,
+    TF_SOC,
+    TF_PV_POWER,
+    TF_PV_VOLTAGE,
+    TF_PV_CURRENT,
+    TF_LOAD_CURRENT,
+    TF_DEVICE_STATE,
+    TF_YIELD_TODAY,
+    TF_EFFICIENCY,
+    TF_CONSUMED_AH,
+    TF_REMAINING_MINS,
+    TF_AUX_VOLTAGE,
+    TF_LOAD_STATE,
+    TELEMETRY_FIELD_COUNT
+};
+
+struct TelemetryFieldInfo {
+    const char* name;    // ingest_telemetry kolon adi
+    float scale;         // Sabit nokta birimi (1 = tamsayi)
+    bool isInt;          // JSON'da tamsayi olarak yazilir
+    float defaultValue;  // Bu degerdeyse gonderilmez
+};
+
+extern const TelemetryFieldInfo TELEMETRY_FIELDS[TELEMETRY_FIELD_COUNT];
+
+// VictronData -> TelemetryField sirasinda degerler (power: V*I'ye dusulmus guc)
+void telemetryFieldValues(const VictronData& data, float power, float out[TELEMETRY_FIELD_COUNT]);
+
+// Ornek metrigi basina gonderim politikasi
+#define TELEMETRY_SAMPLE_STATS 0x01 // min / max / ortalama / adet
+#define TELEMETRY_SAMPLE_RAW   0x02 // Zaman damgali ham ornekler
+
+struct TelemetrySampleMetricInfo {
+    const char* name;     // interval_stats anahtari
+    TelemetryField field; // Olcek
+    uint8_t policy;       // TELEMETRY_SAMPLE_STATS | TELEMETRY_SAMPLE_RAW
+};
+
+extern const TelemetrySampleMetricInfo TELEMETRY_SAMPLE_METRICS[SAMPLE_METRIC_COUNT];
+
+// Sabit tampona ikili batch yazar (heap yok).
+//   TelemetryEncoder enc(buf, sizeof(buf));
+//   enc.begin(boatName); enc.add(data, power)...; size_t n = enc.finish();
+class TelemetryEncoder {
+public:
+    TelemetryEncoder(uint8_t* buffer, size_t capacity) : buf(buffer), cap(capacity) {}
+
+    // flags: TELEMETRY_FLAG_SAMPLES ise her kayda aralik blogu eklenir
+    bool begin(const char* boatName, uint8_t flags = 0);
+    // Tampon doluysa veya 255 kayda ulasildiysa false (kayit eklenmez).
+    // samples: aralik ornekleri (yoksa bos blok), now: ornek yaslari icin millis()
+    bool add(const VictronData& data, float power, const DeviceSamples* samples = nullptr, uint32_t now = 0);
+    // Kayit sayisini yazar; toplam boyut (hata varsa 0)
+    size_t finish();
+
+    uint8_t count() const { return records; }
+
+private:
+    bool putByte(uint8_t value);
+    bool putVarint(uint32_t value);
+    bool putFixed(float value, float scale);
+    void putSamples(const DeviceSamples* samples, uint32_t now);
+
+    uint8_t* buf;
+    size_t cap;
+    size_t pos = 0;
+    size_t countPos = 0;
+    uint8_t records = 0;
+    uint8_t flags = 0;
+    bool failed = false;
+};
+
+// Yas bayragi olmayan bir zarfi yas bilgisiyle out'a kopyalar. Donus: yazilan byte, hata/sigmazsa 0.
+size_t telemetrySetAge(const uint8_t* batch, size_t len, uint32_t ageSeconds, uint8_t* out, size_t outCapacity);
+
+// in'i zlib akisi olarak out'a sikistirir. Donus: yazilan byte, sigmazsa 0.
+// out icin len + len / 8 + 16 her zaman yeterli.
+size_t telemetryDeflate(const uint8_t* in, size_t len, uint8_t* out, size_t outCapacity);
+
+#endif
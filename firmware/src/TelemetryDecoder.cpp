@@ -0,0 +1,295 @@
+#include "TelemetryDecoder.h"
+#include "VictronRecords.h"
+#include <stdio.h>
+
+namespace {
+
+struct Reader {
+    const uint8_t* data;
+    size_t len;
+    size_t pos = 0;
+    bool ok = true;
+
+    uint8_t byte() {
+        if (pos >= len) {
+            ok = false;
+            return 0;
+        }
+        return data[pos++];
+    }
+
+    double fixed(float scale) {
+        uint32_t zz = varint();
+        int32_t v = (int32_t)(zz >> 1) ^ -(int32_t)(zz & 1);
+        return v * (double)scale;
+    }
+
+    uint32_t varint() {
+        uint32_t value = 0;
+        for (int shift = 0; shift < 35; shift += 7) {
+            uint8_t b = byte();
+            value |= (uint32_t)(b & 0x7F) << shift;
+            if (!(b & 0x80)) return value;
+        }
+        ok = false;
+        return 0;
+    }
+};
+
+// Durum kodu olmayan kayit tipleri: firmware bunlarda charge_state'i bos gonderir
+bool hasDeviceState(int type) {
+    switch (type) {
+        case BATTERY_MONITOR:
+        case SMART_BATTERY_SENSE:
+        case SMART_LITHIUM:
+        case LYNX_BMS:
+        case DC_ENERGY_METER:
+        case UNKNOWN:
+            return false;
+        default:
+            return true;
+    }
+}
+
+int decimalsFor(float scale) {
+    if (scale >= 1.0f) return 0;
+    if (scale >= 0.1f) return 1;
+    if (scale >= 0.01f) return 2;
+    return 3;
+}
+
+void appendEscaped(std::string& out, const std::string& text) {
+    out += '"';
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            out += '\\';
+            out += c;
+        } else if ((uint8_t)c < 0x20) {
+            char esc[8];
+            snprintf(esc, sizeof(esc), "\\u%04x", (unsigned)(uint8_t)c);
+            out += esc;
+        } else {
+            out += c;
+        }
+    }
+    out += '"';
+}
+
+float metricScale(int metric) {
+    return TELEMETRY_FIELDS[TELEMETRY_SAMPLE_METRICS[metric].field].scale;
+}
+
+void readSamples(Reader& r, TelemetryRow& row) {
+    uint8_t statsMask = r.byte();
+    if (statsMask >> SAMPLE_METRIC_COUNT) r.ok = false; // Bu surumde olmayan metrik
+    for (int m = 0; m < SAMPLE_METRIC_COUNT && r.ok; m++) {
+        if (!(statsMask & (1 << m))) continue;
+        TelemetryAggregate& agg = row.stats[m];
+        agg.present = true;
+        agg.count = r.varint();
+        agg.min = r.fixed(metricScale(m));
+        agg.max = r.fixed(metricScale(m));
+        agg.mean = r.fixed(metricScale(m));
+    }
+
+    row.rawMask = r.byte();
+    if (row.rawMask >> SAMPLE_METRIC_COUNT) r.ok = false;
+    if (row.rawMask == 0 || !r.ok) return;
+    uint8_t n = r.byte();
+    for (uint8_t i = 0; i < n && r.ok; i++) {
+        TelemetryRawSample sample = {};
+        sample.ageMs = r.varint() * 100;
+        for (int m = 0; m < SAMPLE_METRIC_COUNT; m++) {
+            if (row.rawMask & (1 << m)) sample.values[m] = r.fixed(metricScale(m));
+        }
+        row.samples.push_back(sample);
+    }
+}
+
+void appendNumber(std::string& out, double value, float scale) {
+    char number[32];
+    snprintf(number, sizeof(number), "%.*f", decimalsFor(scale), value);
+    out += number;
+}
+
+// "interval_stats":{"voltage":{"n":..,"min":..,"max":..,"avg":..},...,"samples":{"age_ms":[..],"voltage":[..]}}
+void appendIntervalStats(std::string& out, const TelemetryRow& row) {
+    const TelemetryAggregate& volts = row.stats[SM_VOLTAGE];
+    if (volts.present) {
+        out += ",\"min_battery_voltage\":";
+        appendNumber(out, volts.min, metricScale(SM_VOLTAGE));
+        out += ",\"max_battery_voltage\":";
+        appendNumber(out, volts.max, metricScale(SM_VOLTAGE));
+    }
+    if (row.stats[SM_PV_POWER].present) {
+        out += ",\"max_pv_power\":";
+        appendNumber(out, row.stats[SM_PV_POWER].max, metricScale(SM_PV_POWER));
+    }
+
+    out += ",\"interval_stats\":{";
+    bool first = true;
+    char number[16];
+    for (int m = 0; m < SAMPLE_METRIC_COUNT; m++) {
+        const TelemetryAggregate& agg = row.stats[m];
+        if (!agg.present) continue;
+        if (!first) out += ',';
+        first = false;
+        snprintf(number, sizeof(number), "%u", (unsigned)agg.count);
+        out += '"';
+        out += TELEMETRY_SAMPLE_METRICS[m].name;
+        out += "\":{\"n\":";
+        out += number;
+        out += ",\"min\":";
+        appendNumber(out, agg.min, metricScale(m));
+        out += ",\"max\":";
+        appendNumber(out, agg.max, metricScale(m));
+        out += ",\"avg\":";
+        appendNumber(out, agg.mean, metricScale(m));
+        out += '}';
+    }
+
+    if (!row.samples.empty()) {
+        if (!first) out += ',';
+        out += "\"samples\":{\"age_ms\":[";
+        for (size_t i = 0; i < row.samples.size(); i++) {
+            if (i) out += ',';
+            snprintf(number, sizeof(number), "%u", (unsigned)row.samples[i].ageMs);
+            out += number;
+        }
+        out += ']';
+        for (int m = 0; m < SAMPLE_METRIC_COUNT; m++) {
+            if (!(row.rawMask & (1 << m))) continue;
+            out += ",\"";
+            out += TELEMETRY_SAMPLE_METRICS[m].name;
+            out += "\":[";
+            for (size_t i = 0; i < row.samples.size(); i++) {
+                if (i) out += ',';
+                appendNumber(out, row.samples[i].values[m], metricScale(m));
+            }
+            out += ']';
+        }
+        out += '}';
+    }
+    out += '}';
+}
+
+bool hasIntervalStats(const TelemetryRow& row) {
+    if (row.rawMask != 0) return true;
+    for (int m = 0; m < SAMPLE_METRIC_COUNT; m++) {
+        if (row.stats[m].present) return true;
+    }
+    return false;
+}
+
+} // namespace
+
+size_t telemetryDecode(const uint8_t* data, size_t len, TelemetryBatch& out) {
+    Reader r{data, len};
+    out.boatName.clear();
+    out.ageSeconds = -1;
+    out.rows.clear();
+
+    if (r.byte() != TELEMETRY_MAGIC_0 || r.byte() != TELEMETRY_MAGIC_1) return 0;
+    if (r.byte() != TELEMETRY_FORMAT_VERSION) return 0;
+    uint8_t flags = r.byte();
+    if (flags & ~(TELEMETRY_FLAG_AGE | TELEMETRY_FLAG_SAMPLES)) return 0; // Bilinmeyen bayrak
+    if (flags & TELEMETRY_FLAG_AGE) out.ageSeconds = (long)r.varint();
+
+    uint8_t nameLen = r.byte();
+    for (uint8_t i = 0; i < nameLen && r.ok; i++) out.boatName += (char)r.byte();
+
+    uint8_t count = r.byte();
+    for (uint8_t n = 0; n < count && r.ok; n++) {
+        TelemetryRow row;
+        uint64_t mac = 0;
+        for (int i = 0; i < 6; i++) mac = (mac << 8) | r.byte();
+        char macText[18];
+        snprintf(macText, sizeof(macText), "%02x:%02x:%02x:%02x:%02x:%02x",
+                 (unsigned)((mac >> 40) & 0xFF), (unsigned)((mac >> 32) & 0xFF),
+                 (unsigned)((mac >> 24) & 0xFF), (unsigned)((mac >> 16) & 0xFF),
+                 (unsigned)((mac >> 8) & 0xFF), (unsigned)(mac & 0xFF));
+        row.macAddress = macText;
+        row.deviceType = r.byte();
+
+        uint32_t bitmap = r.varint();
+        if (bitmap >> TELEMETRY_FIELD_COUNT) return 0; // Bu surumde olmayan alan
+        for (int f = 0; f < TELEMETRY_FIELD_COUNT; f++) {
+            if (bitmap & (1UL << f)) {
+                uint32_t zz = r.varint();
+                int32_t fixed = (int32_t)(zz >> 1) ^ -(int32_t)(zz & 1);
+                row.values[f] = fixed * (double)TELEMETRY_FIELDS[f].scale;
+            } else {
+                row.values[f] = TELEMETRY_FIELDS[f].defaultValue;
+            }
+        }
+
+        if (hasDeviceState(row.deviceType)) {
+            row.chargeState = victronStateName((int)row.values[TF_DEVICE_STATE]);
+        }
+        if (flags & TELEMETRY_FLAG_SAMPLES) readSamples(r, row);
+        out.rows.push_back(row);
+    }
+
+    return r.ok ? r.pos : 0;
+}
+
+bool telemetryDecodeAll(const uint8_t* data, size_t len, std::vector<TelemetryBatch>& out) {
+    out.clear();
+    size_t pos = 0;
+    while (pos < len) {
+        TelemetryBatch batch;
+        size_t used = telemetryDecode(data + pos, len - pos, batch);
+        if (used == 0) return false;
+        out.push_back(batch);
+        pos += used;
+    }
+    return !out.empty();
+}
+
+static void appendRows(const TelemetryBatch& batch, std::string& out, bool& first) {
+    char number[32];
+
+    for (size_t i = 0; i < batch.rows.size(); i++) {
+        const TelemetryRow& row = batch.rows[i];
+        if (!first) out += ',';
+        first = false;
+        out += "{\"mac_address\":";
+        appendEscaped(out, row.macAddress);
+        out += ",\"boat_name\":";
+        appendEscaped(out, batch.boatName);
+
+        for (int f = 0; f < TELEMETRY_FIELD_COUNT; f++) {
+            const TelemetryFieldInfo& info = TELEMETRY_FIELDS[f];
+            if (info.isInt) snprintf(number, sizeof(number), "%d", (int)row.values[f]);
+            else snprintf(number, sizeof(number), "%.*f", decimalsFor(info.scale), row.values[f]);
+            out += ",\"";
+            out += info.name;
+            out += "\":";
+            out += number;
+            // Firmware JSON'unda device_type alarm'dan sonra gelir
+            if (f == TF_ALARM) {
+                snprintf(number, sizeof(number), "%d", row.deviceType);
+                out += ",\"device_type\":";
+                out += number;
+            }
+        }
+
+        out += ",\"charge_state\":";
+        appendEscaped(out, row.chargeState);
+        if (hasIntervalStats(row)) appendIntervalStats(out, row);
+        if (batch.ageSeconds >= 0) {
+            snprintf(number, sizeof(number), "%ld", batch.ageSeconds);
+            out += ",\"age_s\":";
+            out += number;
+        }
+        out += '}';
+    }
+}
+
+std::string telemetryToJson(const std::vector<TelemetryBatch>& batches) {
+    std::string out = "{\"payload\":[";
+    bool first = true;
+    for (const TelemetryBatch& batch : batches) appendRows(batch, out, first);
+    out += "]}";
+    return out;
+}
@@ -0,0 +1,59 @@
+#ifndef TELEMETRY_DECODER_H
+#define TELEMETRY_DECODER_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string>
+#include <vector>
+#include "TelemetryCodec.h"
+
+// Ikili telemetri formatinin referans cozucusu (sunucu tarafi / host).
+// Cikti, firmware'in JSON yolunda gonderdigi ingest_telemetry satirlariyla
+// ayni alanlari ve varsayilanlari tasir. Firmware'de sadece flash kuyrugundaki
+// kayitlari JSON olarak yeniden gondermek icin kullanilir.
+
+// Aralik istatistigi (TELEMETRY_FLAG_SAMPLES)
+struct TelemetryAggregate {
+    bool present = false;
+    uint32_t count = 0;
+    double min = 0.0;
+    double max = 0.0;
+    double mean = 0.0;
+};
+
+struct TelemetryRawSample {
+    uint32_t ageMs;            // Zarf aninda once
+    double values[SAMPLE_METRIC_COUNT];
+};
+
+struct TelemetryRow {
+    std::string macAddress;    // "aa:bb:cc:dd:ee:ff"
+    int deviceType = 0;
+    double values[TELEMETRY_FIELD_COUNT];
+    std::string chargeState;   // device_state'ten uretilir (victronStateName)
+
+    TelemetryAggregate stats[SAMPLE_METRIC_COUNT];
+    uint8_t rawMask = 0;       // samples[].values'ta gecerli metrikler
+    std::vector<TelemetryRawSample> samples;
+};
+
+struct TelemetryBatch {
+    std::string boatName;
+    long ageSeconds = -1;      // -1 = canli (sunucu zamani kullanilir)
+    std::vector<TelemetryRow> rows;
+};
+
+// Govdedeki tek zarfi cozer. Donus: tuketilen byte; bozuk/eksik veri veya
+// bilinmeyen surumde 0. Govde birden fazla zarf icerebilir, donene kadar ilerle.
+size_t telemetryDecode(const uint8_t* data, size_t len, TelemetryBatch& out);
+
+// Tum govde (arka arkaya zarflar). Herhangi bir zarf bozuksa false.
+bool telemetryDecodeAll(const uint8_t* data, size_t len, std::vector<TelemetryBatch>& out);
+
+// ingest_telemetry govdesi: {"payload":[{"mac_address":..,"boat_name":..,...}]}
+// Gecikmeli zarflarin satirlarina "age_s" eklenir. Aralik blogu olan
+// satirlarda min_battery_voltage / max_battery_voltage / max_pv_power
+// kolonlari ve "interval_stats" nesnesi (istatistikler + ham ornekler) gelir.
+std::string telemetryToJson(const std::vector<TelemetryBatch>& batches);
+
+#endif
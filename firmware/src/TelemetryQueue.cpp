@@ -0,0 +1,310 @@
+#include "TelemetryQueue.h"
+#include <LittleFS.h>
+#include "AppLog.h"
+
+namespace {
+
+const uint8_t FRAME_MAGIC_0 = 0xA5;
+const uint8_t FRAME_MAGIC_1 = 0x5A;
+const size_t FRAME_HEADER = 8;  // magic + uzunluk + crc
+const size_t FRAME_META = 10;   // epoch + uptime + boot id
+const size_t FRAME_OVERHEAD = FRAME_HEADER + FRAME_META;
+
+const char* CURSOR_PATH = TELEMETRY_QUEUE_DIR "/cursor";
+const char* CURSOR_TMP_PATH = TELEMETRY_QUEUE_DIR "/cursor.tmp";
+
+// CRC-32 (IEEE, 0xEDB88320). Tablosuz: kayit basina birkac yuz byte.
+uint32_t crc32Update(uint32_t crc, const uint8_t* data, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        crc ^= data[i];
+        for (int k = 0; k < 8; k++) crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
+    }
+    return crc;
+}
+
+void put16(uint8_t* p, uint16_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+void put32(uint8_t* p, uint32_t v) {
+    for (int i = 0; i < 4; i++) p[i] = (uint8_t)(v >> (8 * i));
+}
+
+uint16_t get16(const uint8_t* p) { return (uint16_t)(p[0] | (p[1] << 8)); }
+
+uint32_t get32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+enum FrameStatus { FRAME_OK, FRAME_END, FRAME_BAD };
+
+// offset'teki cerceveyi okur ve dogrular. Payload buffer'a yazilir.
+FrameStatus readFrame(File& f, uint32_t offset, uint8_t* buffer, TelemetryQueueRecord& rec) {
+    uint8_t head[FRAME_OVERHEAD];
+    if (!f.seek(offset)) return FRAME_END;
+    size_t got = f.read(head, sizeof(head));
+    if (got == 0) return FRAME_END;
+    if (got < sizeof(head)) return FRAME_BAD; // Yarim yazilmis kuyruk
+    if (head[0] != FRAME_MAGIC_0 || head[1] != FRAME_MAGIC_1) return FRAME_BAD;
+
+    uint16_t len = get16(head + 2);
+    if (len == 0 || len > TELEMETRY_QUEUE_MAX_PAYLOAD) return FRAME_BAD;
+    if (f.read(buffer, len) != len) return FRAME_BAD;
+
+    uint32_t crc = crc32Update(0xFFFFFFFFu, head + FRAME_HEADER, FRAME_META);
+    crc = crc32Update(crc, buffer, len) ^ 0xFFFFFFFFu;
+    if (crc != get32(head + 4)) return FRAME_BAD;
+
+    rec.epoch = get32(head + 8);
+    rec.uptimeSec = get32(head + 12);
+    rec.bootId = get16(head + 16);
+    rec.data = buffer;
+    rec.len = len;
+    return FRAME_OK;
+}
+
+} // namespace
+
+String TelemetryQueue::segmentPath(uint32_t seq) const {
+    char path[24];
+    snprintf(path, sizeof(path), TELEMETRY_QUEUE_DIR "/%08lx", (unsigned long)seq);
+    return String(path);
+}
+
+bool TelemetryQueue::loadCursor() {
+    File f = LittleFS.open(CURSOR_PATH, "r");
+    if (!f) return false;
+    uint8_t buf[16];
+    size_t got = f.read(buf, sizeof(buf));
+    f.close();
+    if (got != sizeof(buf) || memcmp(buf, "TQC1", 4) != 0) return false;
+    if ((crc32Update(0xFFFFFFFFu, buf, 12) ^ 0xFFFFFFFFu) != get32(buf + 12)) return false;
+    cursor.seq = get32(buf + 4);
+    cursor.offset = get32(buf + 8);
+    return true;
+}
+
+bool TelemetryQueue::saveCursor() {
+    uint8_t buf[16];
+    memcpy(buf, "TQC1", 4);
+    put32(buf + 4, cursor.seq);
+    put32(buf + 8, cursor.offset);
+    put32(buf + 12, crc32Update(0xFFFFFFFFu, buf, 12) ^ 0xFFFFFFFFu);
+
+    // Yaz-sonra-rename: elektrik kesilirse eski cursor gecerli kalir
+    File f = LittleFS.open(CURSOR_TMP_PATH, "w");
+    if (!f) return false;
+    bool ok = f.write(buf, sizeof(buf)) == sizeof(buf);
+    f.close();
+    return ok && LittleFS.rename(CURSOR_TMP_PATH, CURSOR_PATH);
+}
+
+uint32_t TelemetryQueue::countRecords(uint32_t seq, uint32_t fromOffset) {
+    File f = LittleFS.open(segmentPath(seq), "r");
+    if (!f) return 0;
+
+    // Sadece basliklar: CRC peek sirasinda kontrol edilir
+    size_t size = f.size();
+    uint32_t offset = fromOffset;
+    uint32_t count = 0;
+    uint8_t head[FRAME_HEADER];
+    while (offset + FRAME_OVERHEAD <= size) {
+        if (!f.seek(offset) || f.read(head, sizeof(head)) != sizeof(head)) break;
+        if (head[0] != FRAME_MAGIC_0 || head[1] != FRAME_MAGIC_1) break;
+        uint16_t len = get16(head + 2);
+        if (len == 0 || len > TELEMETRY_QUEUE_MAX_PAYLOAD || offset + FRAME_OVERHEAD + len > size) break;
+        count++;
+        offset += FRAME_OVERHEAD + len;
+    }
+    f.close();
+    return count;
+}
+
+void TelemetryQueue::recountPending() {
+    pending = 0;
+    for (uint32_t seq = cursor.seq; seq <= writeSeq; seq++) {
+        pending += countRecords(seq, seq == cursor.seq ? cursor.offset : 0);
+    }
+}
+
+bool TelemetryQueue::begin(uint16_t id) {
+    bootId = id;
+    LittleFS.mkdir(TELEMETRY_QUEUE_DIR);
+
+    bool found = false;
+    uint32_t minSeq = 0, maxSeq = 0;
+    File dir = LittleFS.open(TELEMETRY_QUEUE_DIR);
+    if (dir && dir.isDirectory()) {
+        for (File f = dir.openNextFile(); f; f = dir.openNextFile()) {
+            // Core surumune gore name() tam yol veya sadece dosya adi olabilir
+            const char* name = f.name();
+            const char* slash = strrchr(name, '/');
+            if (slash) name = slash + 1;
+            f.close();
+
+            if (strlen(name) != 8 || strspn(name, "0123456789abcdef") != 8) continue;
+            uint32_t seq = strtoul(name, nullptr, 16);
+            if (!found || seq < minSeq) minSeq = seq;
+            if (!found || seq > maxSeq) maxSeq = seq;
+            found = true;
+        }
+    }
+
+    bool haveCursor = loadCursor();
+    if (!found) {
+        writeSeq = haveCursor ? cursor.seq + 1 : 0;
+        firstSeq = writeSeq;
+        cursor = {writeSeq, 0};
+    } else {
+        writeSeq = maxSeq + 1; // Her acilis yeni segment
+        if (!haveCursor || cursor.seq < minSeq) cursor = {minSeq, 0};
+        if (cursor.seq > maxSeq) cursor = {writeSeq, 0};
+        // commit sirasinda kesilmis olabilir: tuketilmis segmentleri temizle
+        for (uint32_t seq = minSeq; seq < cursor.seq; seq++) LittleFS.remove(segmentPath(seq));
+        firstSeq = cursor.seq;
+    }
+    writeSize = 0;
+    peekCount = 0;
+    peekSawCorrupt = false;
+    recountPending();
+    ready = true;
+
+    APP_LOGI("Telemetri kuyrugu: %lu bekleyen kayit (segment %lu..%lu)",
+             (unsigned long)pending, (unsigned long)firstSeq, (unsigned long)writeSeq);
+    return true;
+}
+
+void TelemetryQueue::evictOldest() {
+    uint32_t seq = firstSeq;
+    uint32_t dropped = 0;
+    if (cursor.seq <= seq) dropped = countRecords(seq, cursor.seq == seq ? cursor.offset : 0);
+    LittleFS.remove(segmentPath(seq));
+    firstSeq++;
+
+    if (cursor.seq < firstSeq) {
+        cursor = {firstSeq, 0};
+        saveCursor();
+    }
+    evicted += dropped;
+    pending -= dropped < pending ? dropped : pending;
+    APP_LOGW("Telemetri kuyrugu dolu: en eski segment silindi (%lu kayit)", (unsigned long)dropped);
+}
+
+bool TelemetryQueue::push(const uint8_t* data, size_t len, uint32_t epoch, uint32_t uptimeSec) {
+    if (!ready || len == 0 || len > TELEMETRY_QUEUE_MAX_PAYLOAD) return false;
+
+    size_t frameLen = FRAME_OVERHEAD + len;
+    if (writeSize > 0 && writeSize + frameLen > TELEMETRY_QUEUE_SEGMENT_SIZE) {
+        writeSeq++;
+        writeSize = 0;
+    }
+    if (writeSize == 0) {
+        while (writeSeq - firstSeq + 1 > TELEMETRY_QUEUE_MAX_SEGMENTS) evictOldest();
+    }
+
+    uint8_t head[FRAME_OVERHEAD];
+    head[0] = FRAME_MAGIC_0;
+    head[1] = FRAME_MAGIC_1;
+    put16(head + 2, (uint16_t)len);
+    put32(head + 8, epoch);
+    put32(head + 12, uptimeSec);
+    put16(head + 16, bootId);
+    uint32_t crc = crc32Update(0xFFFFFFFFu, head + FRAME_HEADER, FRAME_META);
+    put32(head + 4, crc32Update(crc, data, len) ^ 0xFFFFFFFFu);
+
+    File f = LittleFS.open(segmentPath(writeSeq), "a");
+    if (!f) return false;
+    size_t written = f.write(head, sizeof(head));
+    written += f.write(data, len);
+    f.close();
+
+    if (written != frameLen) {
+        // Yarim cerceve okurken atlanir; sonraki kayitlar yeni segmente
+        writeSize = TELEMETRY_QUEUE_SEGMENT_SIZE;
+        return false;
+    }
+    writeSize += frameLen;
+    pending++;
+    return true;
+}
+
+size_t TelemetryQueue::peek(const std::function<void(const TelemetryQueueRecord&)>& visit, size_t maxRecords,
+                            size_t maxBytes) {
+    peekCount = 0;
+    peekSawCorrupt = false;
+    if (!ready) return 0;
+
+    Position pos = cursor;
+    size_t bytes = 0;
+    bool budgetReached = false;
+
+    while (!budgetReached && peekCount < maxRecords && pos.seq <= writeSeq) {
+        File f = LittleFS.open(segmentPath(pos.seq), "r");
+        if (!f) {
+            if (pos.seq == writeSeq) break; // Henuz yazilmadi
+            pos = {pos.seq + 1, 0};
+            continue;
+        }
+
+        bool nextSegment = false;
+        while (peekCount < maxRecords) {
+            TelemetryQueueRecord rec;
+            FrameStatus status = readFrame(f, pos.offset, readBuffer, rec);
+            if (status == FRAME_END) {
+                nextSegment = pos.seq < writeSeq;
+                break;
+            }
+            if (status == FRAME_BAD) {
+                APP_LOGW("Telemetri kuyrugu: segment %lu offset %lu bozuk, geri kalani atlaniyor",
+                         (unsigned long)pos.seq, (unsigned long)pos.offset);
+                corrupt++;
+                peekSawCorrupt = true;
+                if (pos.seq == writeSeq) writeSize = TELEMETRY_QUEUE_SEGMENT_SIZE;
+                nextSegment = true;
+                break;
+            }
+            if (peekCount > 0 && bytes + rec.len > maxBytes) {
+                budgetReached = true;
+                break;
+            }
+            visit(rec);
+            bytes += rec.len;
+            peekCount++;
+            pos.offset += FRAME_OVERHEAD + rec.len;
+        }
+        f.close();
+
+        if (!nextSegment) break;
+        pos = {pos.seq + 1, 0};
+    }
+
+    peekEnd = pos;
+    return peekCount;
+}
+
+bool TelemetryQueue::commit() {
+    if (!ready || (peekCount == 0 && !peekSawCorrupt)) return true;
+
+    // peek ile commit arasinda tahliye olduysa peekEnd gecmiste kalmis olabilir
+    if (peekEnd.seq < firstSeq) peekEnd = {firstSeq, 0};
+    for (uint32_t seq = firstSeq; seq < peekEnd.seq; seq++) LittleFS.remove(segmentPath(seq));
+    if (peekEnd.seq > firstSeq) firstSeq = peekEnd.seq;
+    cursor = peekEnd;
+
+    pending -= peekCount < pending ? peekCount : pending;
+    if (peekSawCorrupt) recountPending();
+
+    // Yazilan segment tamamen tuketildiyse sil ve yenisine gec
+    if (cursor.seq == writeSeq && writeSize > 0 && cursor.offset >= writeSize) {
+        LittleFS.remove(segmentPath(writeSeq));
+        writeSeq++;
+        writeSize = 0;
+        firstSeq = writeSeq;
+        cursor = {writeSeq, 0};
+    }
+
+    peekCount = 0;
+    peekSawCorrupt = false;
+    return saveCursor();
+}
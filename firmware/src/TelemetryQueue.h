@@ -0,0 +1,85 @@
+#ifndef TELEMETRY_QUEUE_H
+#define TELEMETRY_QUEUE_H
+
+#include <Arduino.h>
+#include <functional>
+
+// WiFi/sunucu kesintilerinde telemetri batch'lerini flash'ta (LittleFS) tutan
+// ekleme-tabanli kuyruk. Kayitlar ikili TelemetryEncoder zarflaridir.
+//
+// Dosyalar: /tq/<segment no, 8 hex>  (en fazla TELEMETRY_QUEUE_SEGMENT_SIZE byte)
+//           /tq/cursor               (okuma konumu; .tmp'ye yazilip rename edilir)
+//
+// Kayit cercevesi:
+//   A5 5A | uzunluk u16 (payload) | crc32 u32 (meta + payload) |
+//   epoch u32 | uptime sn u32 | boot id u16 | payload
+//
+// Cokme guvenligi: her acilis yeni segmentte yazmaya baslar (yarim kalmis
+// kuyruk dosyasinin arkasina ekleme yapilmaz). Okurken CRC'si tutmayan veya
+// yarim cerceve, segmentin geri kalaniyla birlikte atlanir. Cursor sadece
+// sunucu kabul ettikten sonra (commit) ilerler; kayit kaybolmaz, en kotu
+// durumda tekrar gonderilir.
+//
+// Sinir: TELEMETRY_QUEUE_MAX_SEGMENTS dolunca en eski segment silinir
+// (icindeki kayitlar evictedRecords()'a eklenir).
+
+#define TELEMETRY_QUEUE_DIR "/tq"
+#define TELEMETRY_QUEUE_SEGMENT_SIZE 8192
+#define TELEMETRY_QUEUE_MAX_SEGMENTS 32      // 256 KB
+#define TELEMETRY_QUEUE_MAX_PAYLOAD 2048     // TELEMETRY_BINARY_MAX ile ayni
+
+struct TelemetryQueueRecord {
+    uint32_t epoch;       // Olcum ani (Unix sn, saat yoksa 0)
+    uint32_t uptimeSec;   // Olcum anindaki millis() / 1000
+    uint16_t bootId;      // Olcumu yapan acilis
+    const uint8_t* data;  // Sadece callback suresince gecerli
+    size_t len;
+};
+
+class TelemetryQueue {
+public:
+    // Dizini tarar, cursor'u yukler, bekleyen kayitlari sayar.
+    bool begin(uint16_t bootId);
+
+    bool push(const uint8_t* data, size_t len, uint32_t epoch, uint32_t uptimeSec);
+
+    // Cursor'dan itibaren en fazla maxRecords kayit / maxBytes payload okur
+    // (ilk kayit her zaman verilir). Cursor'u ilerletmez; commit() ilerletir.
+    size_t peek(const std::function<void(const TelemetryQueueRecord&)>& visit, size_t maxRecords, size_t maxBytes);
+    // Son peek'te verilen kayitlari tuketilmis say
+    bool commit();
+
+    uint32_t pendingRecords() const { return pending; }
+    uint32_t evictedRecords() const { return evicted; }
+    uint32_t corruptSegments() const { return corrupt; }
+    uint16_t getBootId() const { return bootId; }
+
+private:
+    struct Position {
+        uint32_t seq;
+        uint32_t offset;
+    };
+
+    String segmentPath(uint32_t seq) const;
+    bool saveCursor();
+    bool loadCursor();
+    uint32_t countRecords(uint32_t seq, uint32_t fromOffset);
+    void recountPending();
+    void evictOldest();
+
+    bool ready = false;
+    uint16_t bootId = 0;
+    uint32_t firstSeq = 0;     // En eski segment (dosyasi olmayabilir)
+    uint32_t writeSeq = 0;     // Yazilan segment
+    uint32_t writeSize = 0;
+    Position cursor = {0, 0};
+    Position peekEnd = {0, 0};
+    size_t peekCount = 0;
+    bool peekSawCorrupt = false;
+    uint32_t pending = 0;
+    uint32_t evicted = 0;
+    uint32_t corrupt = 0;
+    uint8_t readBuffer[TELEMETRY_QUEUE_MAX_PAYLOAD];
+};
+
+#endif
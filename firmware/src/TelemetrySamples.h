@@ -0,0 +1,120 @@
+#ifndef TELEMETRY_SAMPLES_H
+#define TELEMETRY_SAMPLES_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Cihaz basina yuksek hizli ornek tamponu.
+//
+// Reklamlar saniyede birkac kez gelir, uplink ise TELEMETRY_INTERVAL'da bir
+// (veya kritik degisimde) gider. Iki gonderim arasindaki her cozulen reklam
+// aralik istatistigine (min/max/ortalama/son) girer; ayrica en fazla
+// TELEMETRY_SAMPLE_PERIOD_MS'de bir zaman damgali ham ornek halkaya yazilir.
+// Hangi metrigin istatistik, hangisinin ham ornek olarak gonderilecegi
+// TelemetryCodec.cpp'deki TELEMETRY_SAMPLE_METRICS tablosundadir.
+//
+// Sadece loop tarafindan (VictronBLE::update / sendTelemetry) kullanilir.
+
+#ifndef TELEMETRY_SAMPLE_RING
+#define TELEMETRY_SAMPLE_RING 12        // Cihaz basina ham ornek
+#endif
+#ifndef TELEMETRY_SAMPLE_PERIOD_MS
+#define TELEMETRY_SAMPLE_PERIOD_MS 5000 // 60 sn'lik aralik ~12 ornek
+#endif
+
+enum SampleMetric : uint8_t {
+    SM_VOLTAGE = 0,
+    SM_CURRENT,
+    SM_POWER,
+    SM_PV_POWER,
+    SAMPLE_METRIC_COUNT
+};
+
+struct MetricAggregate {
+    float min = 0.0f;
+    float max = 0.0f;
+    float last = 0.0f;
+    float sum = 0.0f;
+    uint16_t count = 0;
+
+    void add(float value) {
+        if (count == 0 || value < min) min = value;
+        if (count == 0 || value > max) max = value;
+        last = value;
+        sum += value;
+        if (count < UINT16_MAX) count++;
+    }
+
+    float mean() const { return count ? sum / count : 0.0f; }
+};
+
+struct TelemetrySample {
+    uint32_t timestamp; // millis()
+    float values[SAMPLE_METRIC_COUNT];
+};
+
+// Sabit kapasiteli halka; doluyken en eskinin uzerine yazar.
+template <typename T, size_t Capacity>
+class SampleRing {
+public:
+    void push(const T& item) {
+        items[(start + count) % Capacity] = item;
+        if (count < Capacity) {
+            count++;
+        } else {
+            start = (start + 1) % Capacity;
+            overwritten++;
+        }
+    }
+
+    // 0 = en eski
+    const T& operator[](size_t i) const { return items[(start + i) % Capacity]; }
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    const T* newest() const { return count ? &(*this)[count - 1] : nullptr; }
+    uint32_t overwrittenCount() const { return overwritten; }
+
+    void clear() {
+        start = 0;
+        count = 0;
+        overwritten = 0;
+    }
+
+    static constexpr size_t capacity() { return Capacity; }
+
+private:
+    T items[Capacity];
+    size_t start = 0;
+    size_t count = 0;
+    uint32_t overwritten = 0;
+};
+
+// Son gonderimden bu yana (aralik) istatistikler + ham ornekler
+struct DeviceSamples {
+    MetricAggregate stats[SAMPLE_METRIC_COUNT];
+    SampleRing<TelemetrySample, TELEMETRY_SAMPLE_RING> ring;
+    uint32_t intervalStart = 0;
+
+    void add(uint32_t timestamp, const float values[SAMPLE_METRIC_COUNT]) {
+        if (stats[0].count == 0 && ring.empty()) intervalStart = timestamp;
+        for (int m = 0; m < SAMPLE_METRIC_COUNT; m++) stats[m].add(values[m]);
+
+        const TelemetrySample* last = ring.newest();
+        if (last == nullptr || timestamp - last->timestamp >= TELEMETRY_SAMPLE_PERIOD_MS) {
+            TelemetrySample sample;
+            sample.timestamp = timestamp;
+            for (int m = 0; m < SAMPLE_METRIC_COUNT; m++) sample.values[m] = values[m];
+            ring.push(sample);
+        }
+    }
+
+    void reset() {
+        for (int m = 0; m < SAMPLE_METRIC_COUNT; m++) stats[m] = MetricAggregate();
+        ring.clear();
+        intervalStart = 0;
+    }
+
+    bool empty() const { return stats[0].count == 0; }
+};
+
+#endif
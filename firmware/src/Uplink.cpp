@@ -0,0 +1,312 @@
+#include "Uplink.h"
+#include <WiFi.h>
+#include <time.h>
+#include <vector>
+#include "ConfigManager.h"
+#include "FastBoot.h"
+#include "AppLog.h"
+#include "TelemetryCodec.h"
+#include "TelemetryDecoder.h"
+#include "UplinkClient.h"
+
+extern TelemetryQueue telemetryQueue;
+extern UplinkClient uplinkClient;
+
+#define TELEMETRY_COMPACT_PATH "/functions/v1/ingest-compact"
+
+namespace {
+
+const unsigned long QUEUE_BACKOFF_MIN = 5000;    // Kuyruk boşaltma: ilk tekrar 5 sn
+const unsigned long QUEUE_BACKOFF_MAX = 900000;  // En fazla 15 dk
+const size_t QUEUE_DRAIN_MAX_RECORDS = 16;       // Tek POST'ta en fazla kayıt
+const size_t QUEUE_DRAIN_MAX_BYTES = 4096;       // Tek POST'ta en fazla ikili payload
+const uint32_t IDLE_POLL_MS = 1000;              // Batch yokken flash kuyruğu kontrolü
+const uint32_t LIVE_AGE_THRESHOLD_S = 2;         // Kuyrukta bu kadar bekleyen canlı batch'e yaş eklenir
+
+struct UplinkBatch {
+    uint32_t epoch;
+    uint32_t uptimeSec;
+    uint32_t queuedAt;   // millis()
+    uint16_t len;
+    uint8_t data[UPLINK_BATCH_MAX];
+};
+
+QueueHandle_t batchQueue = nullptr;
+unsigned long queueBackoff = QUEUE_BACKOFF_MIN;
+unsigned long queueNextAttempt = 0;
+volatile bool connectedEvent = false;
+
+// Sayaçlar sadece uplink task'inde (drops: loop) yazılır, diğerleri okur
+volatile uint32_t highWater = 0;
+volatile uint32_t drops = 0;
+volatile uint32_t delivered = 0;
+volatile uint32_t spilled = 0;
+volatile uint32_t replayed = 0;
+volatile uint32_t rejected = 0;
+volatile uint32_t lastLatencyMs = 0;
+volatile uint32_t maxLatencyMs = 0;
+uint64_t totalLatencyMs = 0;
+
+// Ölçümün yaşı (sn); bilinmiyorsa -1
+long ageOf(uint32_t epoch, uint32_t uptimeSec, uint16_t bootId) {
+    uint32_t nowEpoch = telemetryEpoch();
+    uint32_t nowUptime = millis() / 1000;
+    if (epoch != 0 && nowEpoch >= epoch) return (long)(nowEpoch - epoch);
+    if (bootId == telemetryQueue.getBootId() && nowUptime >= uptimeSec) return (long)(nowUptime - uptimeSec);
+    return -1; // Önceki açılıştan ve saat yoktu: yaş bilinmiyor
+}
+
+bool uplinkConfigured() {
+    return WiFi.status() == WL_CONNECTED && config_supabaseUrl != "" && config_secret != "";
+}
+
+// Sunucu cevabi: 2xx gonderildi; 408 / 429 disindaki 4xx kalici red (ayni
+// govde tekrar gonderilse de reddedilir), ag hatasi / 5xx / 408 / 429 tekrar.
+enum PostResult : uint8_t { POST_OK = 0, POST_RETRY, POST_REJECTED };
+
+PostResult classifyResponse(int code) {
+    if (code >= 200 && code < 300) return POST_OK;
+    if (code >= 400 && code < 500 && code != 408 && code != 429) return POST_REJECTED;
+    return POST_RETRY;
+}
+
+// Govdeyi ingest uc noktasina POST eder.
+// Baglanti UplinkClient'ta acik tutulur (keep-alive, DNS onbellegi).
+PostResult postTelemetry(const uint8_t* body, size_t len, const char* contentType, bool deflated) {
+    // Örnek: https://xxx.supabase.co/rest/v1/rpc/ingest_telemetry
+    // Kompakt formatlar sunucuda (supabase/functions/ingest-compact, çözücüsü
+    // TelemetryDecoder ile aynı) açılıp aynı RPC'ye iletilir.
+    uplinkClient.configure(config_supabaseUrl, config_secret);
+    const char* path = (config_uplinkFormat == TELEMETRY_FORMAT_JSON) ? "/rest/v1/rpc/ingest_telemetry" : TELEMETRY_COMPACT_PATH;
+
+    int httpResponseCode = uplinkClient.post(path, body, len, contentType, deflated);
+    PostResult result = classifyResponse(httpResponseCode);
+    const UplinkStats& st = uplinkClient.stats();
+    if (result == POST_OK) {
+        APP_LOGI("Telemetri Gonderildi: %d (%lu ms, %lu baglanti / %lu istek)", httpResponseCode,
+                 (unsigned long)st.lastRequestMs, (unsigned long)st.connects, (unsigned long)st.requests);
+    } else {
+        APP_LOGE("Telemetri Hatasi: %d (WiFi IP: %s)", httpResponseCode, WiFi.localIP().toString().c_str());
+    }
+    return result;
+}
+
+// JSON govdesi; uplink formati deflate ise sikistirilarak (basarisizsa duz) gider
+PostResult postTelemetryJson(const char* json, size_t len) {
+    uint8_t* compressed = nullptr;
+    size_t compressedLen = 0;
+    if (config_uplinkFormat == TELEMETRY_FORMAT_DEFLATE) {
+        size_t capacity = len + len / 8 + 16;
+        compressed = (uint8_t*)malloc(capacity);
+        if (compressed != nullptr) {
+            compressedLen = telemetryDeflate((const uint8_t*)json, len, compressed, capacity);
+        }
+    }
+
+    PostResult result;
+    if (compressedLen > 0) {
+        APP_LOGD("Deflate: %u -> %u byte", (unsigned)len, (unsigned)compressedLen);
+        result = postTelemetry(compressed, compressedLen, "application/json", true);
+    } else {
+        result = postTelemetry((const uint8_t*)json, len, "application/json", false);
+    }
+    free(compressed);
+    return result;
+}
+
+// Canli batch: ikili formatta oldugu gibi, digerlerinde JSON satirlarina acilarak
+PostResult deliver(const UplinkBatch& batch) {
+    if (!uplinkConfigured()) return POST_RETRY;
+
+    long age = ageOf(batch.epoch, batch.uptimeSec, telemetryQueue.getBootId());
+    bool late = age >= (long)LIVE_AGE_THRESHOLD_S;
+
+    if (config_uplinkFormat == TELEMETRY_FORMAT_BINARY) {
+        APP_LOGD("Gonderilen ikili telemetri: %u byte", (unsigned)batch.len);
+        static uint8_t aged[UPLINK_BATCH_MAX + 5];
+        size_t agedLen = late ? telemetrySetAge(batch.data, batch.len, (uint32_t)age, aged, sizeof(aged)) : 0;
+        if (agedLen > 0) return postTelemetry(aged, agedLen, "application/x-victron-telemetry", false);
+        return postTelemetry(batch.data, batch.len, "application/x-victron-telemetry", false);
+    }
+
+    std::vector<TelemetryBatch> rows(1);
+    if (telemetryDecode(batch.data, batch.len, rows[0]) != batch.len) {
+        APP_LOGE("Telemetri batch'i cozulemedi (%u byte)", (unsigned)batch.len);
+        return POST_REJECTED; // Tekrar denemenin anlami yok
+    }
+    if (late) rows[0].ageSeconds = age;
+    std::string json = telemetryToJson(rows);
+    APP_LOGD("Gonderilen JSON (%u byte): %s", (unsigned)json.size(), json.c_str());
+    return postTelemetryJson(json.c_str(), json.size());
+}
+
+void handleBatch(const UplinkBatch& batch) {
+    PostResult result = deliver(batch);
+    if (result == POST_OK) {
+        uint32_t latency = millis() - batch.queuedAt;
+        lastLatencyMs = latency;
+        if (latency > maxLatencyMs) maxLatencyMs = latency;
+        totalLatencyMs += latency;
+        delivered++;
+        return;
+    }
+    if (result == POST_REJECTED) {
+        rejected++; // Flash'a yazilsa da her denemede reddedilirdi
+        APP_LOGE("Telemetri batch'i reddedildi, atildi");
+        return;
+    }
+
+    // Gönderilemedi (çevrimdışı / sunucu hatası): flash kuyruğuna al
+    if (telemetryQueue.push(batch.data, batch.len, batch.epoch, batch.uptimeSec)) {
+        spilled++;
+        APP_LOGI("Telemetri kuyruga alindi (%lu bekleyen)", (unsigned long)telemetryQueue.pendingRecords());
+    } else {
+        APP_LOGE("Telemetri gonderilemedi ve kuyruga yazilamadi");
+    }
+}
+
+// Flash kuyruğundaki gecikmiş telemetriyi toplu gönderir. Başarısız denemeden
+// sonra bekleme süresi ikiye katlanır (5 sn .. 15 dk), başarıda sıfırlanır.
+// Kalıcı red (4xx) kayıtları tüketir: tek kötü kayıt kuyruğu kilitlemez.
+void drainTelemetryQueue() {
+    if (telemetryQueue.pendingRecords() == 0 || !uplinkConfigured()) return;
+
+    unsigned long now = millis();
+    if ((long)(now - queueNextAttempt) < 0) return;
+
+    size_t records;
+    PostResult result = POST_RETRY;
+    if (config_uplinkFormat == TELEMETRY_FORMAT_BINARY) {
+        // Zarflar arka arkaya; her birine yaş bayrağı eklenir
+        static uint8_t body[QUEUE_DRAIN_MAX_BYTES + QUEUE_DRAIN_MAX_RECORDS * 5];
+        size_t bodyLen = 0;
+        records = telemetryQueue.peek([&](const TelemetryQueueRecord& rec) {
+            long age = ageOf(rec.epoch, rec.uptimeSec, rec.bootId);
+            size_t n = 0;
+            if (age >= 0) n = telemetrySetAge(rec.data, rec.len, (uint32_t)age, body + bodyLen, sizeof(body) - bodyLen);
+            if (n == 0 && rec.len <= sizeof(body) - bodyLen) {
+                memcpy(body + bodyLen, rec.data, rec.len);
+                n = rec.len;
+            }
+            bodyLen += n;
+        }, QUEUE_DRAIN_MAX_RECORDS, QUEUE_DRAIN_MAX_BYTES);
+        if (records > 0) result = postTelemetry(body, bodyLen, "application/x-victron-telemetry", false);
+    } else {
+        // JSON: kayıtlar referans çözücüyle satırlara açılır, "age_s" eklenir
+        std::vector<TelemetryBatch> batches;
+        records = telemetryQueue.peek([&](const TelemetryQueueRecord& rec) {
+            TelemetryBatch batch;
+            if (telemetryDecode(rec.data, rec.len, batch) != rec.len) {
+                APP_LOGW("Kuyruktaki telemetri kaydi cozulemedi, atlaniyor");
+                return;
+            }
+            batch.ageSeconds = ageOf(rec.epoch, rec.uptimeSec, rec.bootId);
+            batches.push_back(batch);
+        }, QUEUE_DRAIN_MAX_RECORDS, QUEUE_DRAIN_MAX_BYTES);
+        if (!batches.empty()) {
+            std::string json = telemetryToJson(batches);
+            result = postTelemetryJson(json.c_str(), json.size());
+        } else if (records > 0) {
+            result = POST_REJECTED; // Hepsi bozuktu: tüketildi say
+        }
+    }
+
+    // records == 0: bozuk segmentleri geç
+    if (result != POST_RETRY || records == 0) telemetryQueue.commit();
+    if (result == POST_OK) {
+        replayed += records;
+        APP_LOGI("Kuyruktan %u kayit gonderildi (%lu kaldi)", (unsigned)records, (unsigned long)telemetryQueue.pendingRecords());
+        queueBackoff = QUEUE_BACKOFF_MIN;
+        queueNextAttempt = now;
+    } else if (result == POST_REJECTED) {
+        rejected += records;
+        APP_LOGE("Kuyruktaki %u kayit reddedildi, atildi (%lu kaldi)", (unsigned)records,
+                 (unsigned long)telemetryQueue.pendingRecords());
+        queueBackoff = QUEUE_BACKOFF_MIN;
+        queueNextAttempt = now;
+    } else {
+        queueNextAttempt = now + queueBackoff;
+        APP_LOGW("Kuyruk gonderimi basarisiz, %lu sn sonra tekrar", queueBackoff / 1000);
+        queueBackoff = (queueBackoff * 2 > QUEUE_BACKOFF_MAX) ? QUEUE_BACKOFF_MAX : queueBackoff * 2;
+    }
+}
+
+void uplinkTask(void*) {
+    static UplinkBatch batch;
+    for (;;) {
+        if (xQueueReceive(batchQueue, &batch, pdMS_TO_TICKS(IDLE_POLL_MS)) == pdTRUE) {
+            handleBatch(batch);
+        }
+        if (connectedEvent) {
+            connectedEvent = false;
+            queueBackoff = QUEUE_BACKOFF_MIN; // Bağlantı geri geldi: kuyruğu hemen boşalt
+            queueNextAttempt = millis();
+        }
+        // Canlı batch bekliyorsa önce o gider
+        if (uxQueueMessagesWaiting(batchQueue) == 0) drainTelemetryQueue();
+        // Hızlı açılışın sabit IP'si ilk istekten (ya da süre dolunca) sonra DHCP'ye devredilir
+        const UplinkStats& st = uplinkClient.stats();
+        fastBootLeaseTick(st.requests + st.failures > 0);
+    }
+}
+
+} // namespace
+
+uint32_t telemetryEpoch() {
+    time_t t = time(nullptr);
+    return t > 1600000000 ? (uint32_t)t : 0;
+}
+
+bool uplinkBegin() {
+    if (batchQueue != nullptr) return true;
+    batchQueue = xQueueCreate(UPLINK_QUEUE_DEPTH, sizeof(UplinkBatch));
+    if (batchQueue == nullptr) return false;
+    BaseType_t ok = xTaskCreatePinnedToCore(uplinkTask, "uplink", UPLINK_TASK_STACK, nullptr,
+                                            UPLINK_TASK_PRIORITY, nullptr, UPLINK_TASK_CORE);
+    return ok == pdPASS;
+}
+
+bool uplinkSubmit(const uint8_t* data, size_t len, uint32_t epoch, uint32_t uptimeSec) {
+    if (batchQueue == nullptr || len == 0 || len > UPLINK_BATCH_MAX) return false;
+
+    // Sadece loop() çağırır: kopyalar için static tampon (2 KB stack'e sığmaz)
+    static UplinkBatch item;
+    static UplinkBatch dropped;
+    item.epoch = epoch;
+    item.uptimeSec = uptimeSec;
+    item.queuedAt = millis();
+    item.len = (uint16_t)len;
+    memcpy(item.data, data, len);
+
+    if (xQueueSend(batchQueue, &item, 0) != pdTRUE) {
+        // Uplink ağda takılı: en eski batch'i at, yenisini koy
+        if (xQueueReceive(batchQueue, &dropped, 0) == pdTRUE) drops++;
+        if (xQueueSend(batchQueue, &item, 0) != pdTRUE) return false;
+        APP_LOGW("Uplink kuyrugu dolu, en eski batch atildi");
+    }
+
+    uint32_t depth = uxQueueMessagesWaiting(batchQueue);
+    if (depth > highWater) highWater = depth;
+    return true;
+}
+
+void uplinkNotifyConnected() {
+    connectedEvent = true;
+}
+
+UplinkTaskStats uplinkStats() {
+    UplinkTaskStats s;
+    s.queueDepth = batchQueue ? uxQueueMessagesWaiting(batchQueue) : 0;
+    s.queueCapacity = UPLINK_QUEUE_DEPTH;
+    s.queueHighWater = highWater;
+    s.queueDrops = drops;
+    s.delivered = delivered;
+    s.spilled = spilled;
+    s.replayed = replayed;
+    s.rejected = rejected;
+    s.lastLatencyMs = lastLatencyMs;
+    s.maxLatencyMs = maxLatencyMs;
+    uint32_t count = delivered;
+    s.avgLatencyMs = count ? (uint32_t)(totalLatencyMs / count) : 0;
+    return s;
+}
@@ -0,0 +1,55 @@
+#ifndef UPLINK_H
+#define UPLINK_H
+
+#include <Arduino.h>
+#include "TelemetryQueue.h"
+
+// Telemetri gonderimi icin ayri FreeRTOS task'i.
+//
+// loop() sadece ikili batch'i (TelemetryEncoder) uretip uplinkSubmit() ile
+// sinirli kuyruga birakir; ag beklemesi yoktur. Uplink task'i batch'i
+// secili formatta (JSON / deflate / ikili) gonderir, gonderemezse flash
+// kuyruguna (TelemetryQueue) yazar ve WiFi varken flash kuyrugunu bosaltir.
+// TelemetryQueue ve UplinkClient'a sadece bu task dokunur.
+//
+// Zaman asimlari: DNS ~4 sn (WiFi.hostByName), TLS el sikismasi ve HTTP
+// cevabi UPLINK_TIMEOUT_MS (UplinkClient.h). Batch basina en fazla iki deneme.
+
+#define UPLINK_BATCH_MAX TELEMETRY_QUEUE_MAX_PAYLOAD // Ikili batch (cihaz basina ~30 byte)
+#define UPLINK_QUEUE_DEPTH 6                         // RAM'de bekleyen batch
+#define UPLINK_TASK_STACK 12288                      // mbedtls el sikismasi icin
+#define UPLINK_TASK_PRIORITY 1
+#define UPLINK_TASK_CORE 0                           // loop() core 1'de
+// Secilebilen en yuksek format. Deflate / ikili TELEMETRY_COMPACT_PATH'e
+// gider (supabase/functions/ingest-compact); gecersiz deger JSON'a duser.
+#define UPLINK_FORMAT_MAX TELEMETRY_FORMAT_BINARY
+
+struct UplinkTaskStats {
+    uint32_t queueDepth;
+    uint32_t queueCapacity;
+    uint32_t queueHighWater;
+    uint32_t queueDrops;       // Kuyruk doluyken atilan en eski batch
+    uint32_t delivered;        // Canli gonderilen batch
+    uint32_t spilled;          // Gonderilemeyip flash'a yazilan batch
+    uint32_t replayed;         // Flash'tan gonderilen kayit
+    uint32_t rejected;         // Sunucunun kalici reddettigi (4xx), atilan batch
+    uint32_t lastLatencyMs;    // uplinkSubmit -> sunucu onayi
+    uint32_t maxLatencyMs;
+    uint32_t avgLatencyMs;
+};
+
+// Task'i ve kuyrugu olusturur (TelemetryQueue::begin'den sonra).
+bool uplinkBegin();
+
+// loop()'tan cagrilir, beklemez. Kuyruk doluysa en eski batch atilir.
+bool uplinkSubmit(const uint8_t* batch, size_t len, uint32_t epoch, uint32_t uptimeSec);
+
+// WiFi IP aldiginda: flash kuyrugu geri cekilme beklemeden bosaltilir.
+void uplinkNotifyConnected();
+
+UplinkTaskStats uplinkStats();
+
+// Gecerli saat yoksa (NTP henuz senkron degil) 0
+uint32_t telemetryEpoch();
+
+#endif
@@ -0,0 +1,136 @@
+#include "UplinkClient.h"
+#include "AppLog.h"
+
+void UplinkClient::configure(const String& url, const String& key) {
+    if (configured && url == baseUrl && key == apiKey) return;
+
+    stop();
+    baseUrl = url;
+    apiKey = key;
+    bearer = String("Bearer ") + key;
+    haveIp = false;
+
+    // sema://host[:port][/onek]
+    String rest = url;
+    https = !rest.startsWith("http://");
+    int scheme = rest.indexOf("://");
+    if (scheme >= 0) rest = rest.substring(scheme + 3);
+
+    int slash = rest.indexOf('/');
+    String authority = slash >= 0 ? rest.substring(0, slash) : rest;
+    prefix = slash >= 0 ? rest.substring(slash) : String("");
+    if (prefix.endsWith("/")) prefix = prefix.substring(0, prefix.length() - 1);
+
+    int colon = authority.indexOf(':');
+    if (colon >= 0) {
+        host = authority.substring(0, colon);
+        port = (uint16_t)authority.substring(colon + 1).toInt();
+    } else {
+        host = authority;
+        port = https ? 443 : 80;
+    }
+
+    secureClient.setInsecure();
+    secureClient.setHandshakeTimeout(UPLINK_TIMEOUT_MS / 1000);
+    http.setReuse(true);
+    http.setTimeout(UPLINK_TIMEOUT_MS);
+    configured = host.length() > 0;
+}
+
+bool UplinkClient::isConnected() {
+    return configured && client().connected();
+}
+
+void UplinkClient::stop() {
+    secureClient.stop();
+    plainClient.stop();
+}
+
+bool UplinkClient::connect() {
+    unsigned long now = millis();
+    if (!haveIp || now - dnsResolvedAt > UPLINK_DNS_TTL_MS) {
+        IPAddress ip;
+        if (!WiFi.hostByName(host.c_str(), ip)) {
+            APP_LOGW("Uplink DNS cozulemedi: %s", host.c_str());
+            return false;
+        }
+        cachedIp = ip;
+        dnsResolvedAt = millis();
+        haveIp = true;
+        counters.dnsLookups++;
+        counters.lastDnsMs = dnsResolvedAt - now;
+    }
+
+    unsigned long t0 = millis();
+    bool ok = https ? secureClient.connect(cachedIp, port, host.c_str(), nullptr, nullptr, nullptr)
+                    : plainClient.connect(cachedIp, port);
+    uint32_t elapsed = millis() - t0;
+    if (!ok) {
+        APP_LOGW("Uplink baglantisi kurulamadi: %s (%s:%u, %lu ms)", host.c_str(),
+                 cachedIp.toString().c_str(), port, (unsigned long)elapsed);
+        haveIp = false; // Adres degismis olabilir
+        return false;
+    }
+    if (!https) plainClient.setNoDelay(true);
+
+    counters.connects++;
+    counters.lastConnectMs = elapsed;
+    counters.totalConnectMs += elapsed;
+    if (elapsed > counters.maxConnectMs) counters.maxConnectMs = elapsed;
+    APP_LOGD("Uplink baglandi: %s (%lu ms)", host.c_str(), (unsigned long)elapsed);
+    return true;
+}
+
+int UplinkClient::post(const char* path, const uint8_t* body, size_t len, const char* contentType, bool deflated) {
+    if (!configured) return HTTPC_ERROR_CONNECTION_REFUSED;
+
+    for (int attempt = 0; attempt < 2; attempt++) {
+        bool reused = client().connected();
+        if (!reused && !connect()) {
+            counters.failures++;
+            return HTTPC_ERROR_CONNECTION_REFUSED;
+        }
+
+        unsigned long t0 = millis();
+        http.begin(client(), host, port, prefix + path, https);
+
+        // Supabase REST API Headers
+        http.addHeader("apikey", apiKey);
+        http.addHeader("Authorization", bearer);
+        // Cevap govdesine ihtiyac yok: kisa onay yeterli
+        http.addHeader("Prefer", "return=minimal");
+        http.addHeader("Content-Type", contentType);
+        if (deflated) http.addHeader("Content-Encoding", "deflate");
+
+        int code = http.POST((uint8_t*)body, len);
+        if (code > 0) {
+            // Baglanti tekrar kullanilabilsin diye cevap sonuna kadar okunur
+            String ack = http.getString();
+            if (code >= 200 && code < 300) APP_LOGV("Sunucu Cevabi: %s", ack.c_str());
+            else APP_LOGD("Sunucu Cevabi: %s", ack.c_str());
+        }
+        http.end(); // setReuse(true): sunucu izin verdiyse baglanti acik kalir
+
+        if (code < 0) {
+            stop();
+            if (reused) {
+                // Sunucu bosta kalan baglantiyi kapatmis: yeni baglantiyla bir kez daha
+                counters.retries++;
+                continue;
+            }
+            haveIp = false;
+            counters.failures++;
+            return code;
+        }
+
+        uint32_t elapsed = millis() - t0;
+        counters.requests++;
+        if (reused) counters.reused++;
+        counters.lastRequestMs = elapsed;
+        counters.totalRequestMs += elapsed;
+        return code;
+    }
+
+    counters.failures++;
+    return HTTPC_ERROR_CONNECTION_LOST;
+}
@@ -0,0 +1,79 @@
+#ifndef UPLINK_CLIENT_H
+#define UPLINK_CLIENT_H
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <WiFiClientSecure.h>
+#include <HTTPClient.h>
+
+// Supabase uplink'i icin kalici HTTP(S) baglantisi.
+//
+// Her gonderimde yeni HTTPClient + DNS + TCP + TLS el sikismasi yerine tek
+// bir WiFiClientSecure acik tutulur (HTTP/1.1 keep-alive). Host adi
+// UPLINK_DNS_TTL_MS boyunca cozulmus IP'den baglanir (SNI icin host adi yine
+// gonderilir). Sunucu bosta kalan baglantiyi kapattiysa istek bir kez yeni
+// baglantiyla tekrarlanir.
+//
+// Not: Arduino-ESP32'nin WiFiClientSecure'u mbedtls oturumuna el sikismadan
+// once erisim vermedigi icin TLS oturum devamlamasi (session resumption)
+// yapilamiyor; baglantiyi acik tutmak el sikismayi tamamen ortadan kaldirir.
+//
+// Sertifika dogrulamasi onceki HTTPClient davranisiyla ayni (setInsecure).
+// http:// adresleri duz TCP ile calisir (yerel test sunucusu icin,
+// bkz. scripts/uplink_standin.py).
+
+#define UPLINK_DNS_TTL_MS 600000   // 10 dk
+#define UPLINK_TIMEOUT_MS 10000
+
+struct UplinkStats {
+    uint32_t requests = 0;       // Tamamlanan istek (HTTP kodu alinan)
+    uint32_t failures = 0;       // Baglanti/gonderim hatasi
+    uint32_t connects = 0;       // Yeni baglanti (TLS el sikismasi)
+    uint32_t reused = 0;         // Acik baglantidan giden istek
+    uint32_t retries = 0;        // Kapanmis keep-alive baglantisi yuzunden tekrar
+    uint32_t dnsLookups = 0;
+    uint32_t lastDnsMs = 0;
+    uint32_t lastConnectMs = 0;  // TCP + TLS
+    uint32_t maxConnectMs = 0;
+    uint32_t totalConnectMs = 0;
+    uint32_t lastRequestMs = 0;  // Istek gonderimi + cevap
+    uint32_t totalRequestMs = 0;
+};
+
+class UplinkClient {
+public:
+    // baseUrl: "https://host[:port][/onek]". Adres degisirse baglanti kapatilir.
+    void configure(const String& baseUrl, const String& apiKey);
+
+    // path onekin arkasina eklenir. Donus: HTTP kodu veya HTTPClient hata kodu (<0).
+    int post(const char* path, const uint8_t* body, size_t len, const char* contentType, bool deflated);
+
+    void stop();
+    bool isConnected();
+    const UplinkStats& stats() const { return counters; }
+
+private:
+    bool connect();
+    WiFiClient& client() { return https ? (WiFiClient&)secureClient : plainClient; }
+
+    String baseUrl;
+    String apiKey;
+    String bearer;
+    String host;
+    String prefix;
+    uint16_t port = 443;
+    bool https = true;
+    bool configured = false;
+
+    WiFiClientSecure secureClient;
+    WiFiClient plainClient;
+    HTTPClient http;
+
+    IPAddress cachedIp;
+    unsigned long dnsResolvedAt = 0;
+    bool haveIp = false;
+
+    UplinkStats counters;
+};
+
+#endif
@@ -1,95 +1,324 @@
 #include "VictronBLE.h"
+#include "AppLog.h"
+#include "VictronRecords.h"
+#include "DeviceKeyTable.h"
+
+static_assert(DEVICE_KEY_TABLE_MAX == VictronDeviceTable::MAX_ENTRIES, "anahtar tablosu cihaz tablosuyla ayni boyda olmali");
+
+// Victron cihazlari cerceve basina birkac kez, toplamda saniyede birkac
+// reklam yayinlar; 15 sn'den uzun bosluk menzil disi / tarama kesintisi.
+const uint16_t VICTRON_RX_INTERVAL_BOUNDS_MS[VICTRON_RX_INTERVAL_BUCKETS - 1] = {
+    50, 100, 250, 500, 1000, 2500, 15000,
+};
 
 VictronBLE::VictronBLE() {
 }
 
-void VictronBLE::hexStringToBytes(String hex, uint8_t* bytes) {
-    for (unsigned int i = 0; i < hex.length(); i += 2) {
-        String byteString = hex.substring(i, i + 2);
-        bytes[i / 2] = (uint8_t)strtol(byteString.c_str(), NULL, 16);
+bool parseMacAddress(const String& text, uint64_t& mac) {
+    uint64_t value = 0;
+    int digits = 0;
+    for (unsigned int i = 0; i < text.length(); i++) {
+        char c = text[i];
+        int nibble;
+        if (c >= '0' && c <= '9') nibble = c - '0';
+        else if (c >= 'a' && c <= 'f') nibble = c - 'a' + 10;
+        else if (c >= 'A' && c <= 'F') nibble = c - 'A' + 10;
+        else if (c == ':' || c == '-' || c == ' ' || c == '\t' || c == '\r' || c == '\n') continue;
+        else return false;
+        if (++digits > 12) return false;
+        value = (value << 4) | (uint64_t)nibble;
+    }
+    if (digits != 12 || value == 0) return false;
+    mac = value;
+    return true;
+}
+
+void formatMacAddress(uint64_t mac, char* out) {
+    snprintf(out, 18, "%02x:%02x:%02x:%02x:%02x:%02x",
+             (unsigned)((mac >> 40) & 0xFF), (unsigned)((mac >> 32) & 0xFF),
+             (unsigned)((mac >> 24) & 0xFF), (unsigned)((mac >> 16) & 0xFF),
+             (unsigned)((mac >> 8) & 0xFF), (unsigned)(mac & 0xFF));
+}
+
+#if APP_LOG_LEVEL >= APP_LOG_DEBUG
+// "0A 1B 2C" (log icin)
+static void formatHex(const uint8_t* data, size_t len, char* out, size_t outSize) {
+    size_t pos = 0;
+    out[0] = '\0';
+    for (size_t i = 0; i < len && pos + 4 <= outSize; i++) {
+        pos += snprintf(out + pos, outSize - pos, i ? " %02X" : "%02X", data[i]);
     }
 }
+#endif
+
+void VictronBLE::setError(const char* fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    vsnprintf(lastError, sizeof(lastError), fmt, args);
+    va_end(args);
+}
 
 void VictronBLE::addDevice(String mac, String keyHex) {
-    // Key'i temizle (Boşlukları ve görünmez karakterleri sil)
-    keyHex.trim();
-    keyHex.replace(" ", "");
-    keyHex.replace("\t", "");
-    keyHex.replace("\r", "");
-    keyHex.replace("\n", "");
-    
-    if (keyHex.length() != 32) {
-        Serial.printf("HATA: Victron Key 32 karakter olmali! Girilen: %d karakter (%s)\n", keyHex.length(), keyHex.c_str());
+    // MAC adresini 48-bit sayiya cevir (aa:bb:.., AA-BB-.., aabbccddeeff)
+    uint64_t macValue;
+    if (!parseMacAddress(mac, macValue)) {
+        APP_LOGE("HATA: Gecersiz MAC adresi: %s", mac.c_str());
         return;
     }
-    
-    // MAC adresini normalize et (küçük harf, tire yerine iki nokta)
-    mac.trim();
-    mac.toLowerCase();
-    mac.replace("-", ":");
-
-    // Eğer : yoksa ve 12 karakterse, aralara : koy (aabbccddeeff -> aa:bb:cc:dd:ee:ff)
-    if (mac.indexOf(':') == -1 && mac.length() == 12) {
-        String formatted = "";
-        for (int i = 0; i < 12; i += 2) {
-            formatted += mac.substring(i, i + 2);
-            if (i < 10) formatted += ":";
+
+    char macText[18];
+    formatMacAddress(macValue, macText);
+
+    // Bosluk ve gorunmez karakterler atlanir
+    uint8_t keyBytes[16];
+    if (!parseDeviceKey(keyHex.c_str(), keyBytes)) {
+        APP_LOGE("HATA: Victron Key 32 hex karakter olmali (%s)", macText);
+        return;
+    }
+
+    VictronDeviceEntry* entry = devices.insert(macValue);
+    if (entry == nullptr) {
+        APP_LOGE("HATA: Cihaz tablosu dolu (max %d), %s eklenemedi!", (int)VictronDeviceTable::MAX_ENTRIES, macText);
+        return;
+    }
+
+    // Yeni cihaz veya anahtar degisimi: context'i sifirdan kur
+    if (!entry->key.set(keyBytes)) {
+        APP_LOGE("HATA: %s icin AES anahtari kurulamadi!", macText);
+        devices.remove(macValue);
+        return;
+    }
+    entry->data.mac = macValue;
+    entry->lastLen = 0; // Eski anahtarla cozulen cerceve artik gecerli degil
+
+    // Anahtar loga yazilmaz: log tamponu /api/logs ile disari acik
+    APP_LOGI("Cihaz eklendi: %s", macText);
+}
+
+bool VictronBLE::reloadDevices(const DeviceKeyTable& table) {
+    // Tabloda olmayan anahtarli cihazlar silinir; anahtarsiz (simulasyon) kayitlari expire temizler
+    uint64_t removed[VictronDeviceTable::MAX_ENTRIES];
+    size_t removedCount = 0;
+    devices.forEach([&](const VictronDeviceEntry& e) {
+        if (e.key.ready && table.find(e.mac) == nullptr) removed[removedCount++] = e.mac;
+    });
+    for (size_t i = 0; i < removedCount; i++) devices.remove(removed[i]);
+
+    bool ok = true;
+    int added = 0, rotated = 0;
+    for (uint16_t i = 0; i < table.count; i++) {
+        const DeviceKeyRecord& rec = table.records[i];
+        char macText[18];
+        formatMacAddress(rec.mac, macText);
+
+        VictronDeviceEntry* entry = devices.find(rec.mac);
+        bool isNew = entry == nullptr || !entry->key.ready;
+        if (entry == nullptr) entry = devices.insert(rec.mac);
+        if (entry == nullptr) {
+            APP_LOGE("HATA: Cihaz tablosu dolu (max %d), %s eklenemedi!", (int)VictronDeviceTable::MAX_ENTRIES, macText);
+            ok = false;
+            continue;
         }
-        mac = formatted;
+
+        if (isNew || memcmp(entry->key.key, rec.key, sizeof(rec.key)) != 0) {
+            // Canli veri kalir: yeni anahtarla ilk cerceve gelene (ya da kayit eskiyene) kadar gosterilir
+            if (!entry->key.set(rec.key)) {
+                APP_LOGE("HATA: %s icin AES anahtari kurulamadi!", macText);
+                if (!entry->data.valid) devices.remove(rec.mac);
+                ok = false;
+                continue;
+            }
+            entry->lastLen = 0; // Eski anahtarla cozulen cerceve artik gecerli degil
+            if (isNew) added++;
+            else rotated++;
+        }
+        entry->data.mac = rec.mac;
+        entry->capacityAh = rec.capacityAh > 0 ? rec.capacityAh : 0.0f;
     }
-    
-    std::vector<uint8_t> keyBytes(16);
-    hexStringToBytes(keyHex, keyBytes.data());
-    
-    deviceKeys[mac] = keyBytes;
-    Serial.printf("Cihaz eklendi: %s (Key: %s)\n", mac.c_str(), keyHex.c_str());
+
+    // Silinen cihazlar ve kapasite agirliklari
+    rebuildFleet();
+    snapshotDirty = true;
+    APP_LOGI("Cihazlar yuklendi: %u kayit, %d yeni, %d anahtar degisti, %u silindi", (unsigned)table.count, added,
+             rotated, (unsigned)removedCount);
+    return ok;
 }
 
 void VictronBLE::init() {
-    Serial.printf("Free Heap before BLE init: %d\n", ESP.getFreeHeap());
-    Serial.println("BLE: NimBLE init...");
+    APP_LOGI("Free Heap before BLE init: %u", (unsigned)ESP.getFreeHeap());
+    APP_LOGD("BLE: NimBLE init...");
     NimBLEDevice::init("");
 }
 
 void VictronBLE::begin() {
-    Serial.println("BLE: getScan...");
+    APP_LOGD("BLE: getScan...");
     pBLEScan = NimBLEDevice::getScan();
-    Serial.println("BLE: setCallbacks...");
-    pBLEScan->setAdvertisedDeviceCallbacks(this);
-    Serial.println("BLE: setActiveScan...");
+    APP_LOGD("BLE: setCallbacks...");
+    // wantDuplicates: ayni cihazin her reklami onResult'a gelir (tekrarlari parmak izi eler)
+    pBLEScan->setAdvertisedDeviceCallbacks(this, true);
     pBLEScan->setActiveScan(false); // Passive scan is enough for Manufacturer Data
-    Serial.println("BLE: setInterval...");
-    pBLEScan->setInterval(100);
-    Serial.println("BLE: setWindow...");
-    pBLEScan->setWindow(50); // 50% duty cycle to allow WiFi to work
-    Serial.println("BLE: begin finished.");
+    pBLEScan->setDuplicateFilter(false);
+    pBLEScan->setMaxResults(0); // Sonuc listesi tutulmaz: reklamlar birikmez, clearResults gerekmez
+    scanWindow = ScanWindow();
+    scanWindow.startedAt = millis();
+    scanWindow.level = scanPolicy.level();
+    scanWindowDrops = advertQueue.drops();
+    scanWindowTx = wifiTxEvents.load(std::memory_order_relaxed);
+    APP_LOGD("BLE: begin finished.");
 }
 
-void scanEndedCB(NimBLEScanResults results) {
-    // Tarama bitti, sonuçlar işlendi.
-    // Serial.println("BLE Scan Tamamlandi.");
-    NimBLEDevice::getScan()->clearResults(); // Bellek sızıntısını önlemek için sonuçları temizle
+// Suresiz tarama; ayar sadece tarama dururken uygulanir
+void VictronBLE::startScan() {
+    const ScanDuty& duty = scanPolicy.duty();
+    pBLEScan->setInterval(duty.intervalMs);
+    pBLEScan->setWindow(duty.windowMs);
+    if (pBLEScan->start(0, nullptr, false)) {
+        APP_LOGD("BLE taramasi: %u/%u ms", duty.intervalMs, duty.windowMs);
+    }
+}
+
+void VictronBLE::closeScanWindow(unsigned long now) {
+    uint32_t drops = advertQueue.drops();
+    uint32_t tx = wifiTxEvents.load(std::memory_order_relaxed);
+    scanWindow.durationMs = now - scanWindow.startedAt;
+    scanWindow.drops = drops - scanWindowDrops;
+    scanWindow.wifiTx = tx - scanWindowTx;
+
+    bool changed = scanPolicy.onWindow(scanWindow);
+
+    uint8_t active = activeScanStats.load(std::memory_order_relaxed);
+    uint8_t target = active ^ 1;
+    const VictronScanStats& prev = scanStats[active];
+    VictronScanStats& stats = scanStats[target];
+    scanStatsSeq[target].fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    for (int i = SCAN_STATS_HISTORY - 1; i > 0; i--) stats.windows[i] = prev.windows[i - 1];
+    stats.windows[0] = scanWindow;
+    stats.count = prev.count < SCAN_STATS_HISTORY ? prev.count + 1 : SCAN_STATS_HISTORY;
+    stats.level = scanPolicy.level();
+    stats.duty = scanPolicy.duty();
+    scanStatsSeq[target].fetch_add(1, std::memory_order_release);
+    activeScanStats.store(target, std::memory_order_release);
+
+    APP_LOGD("BLE penceresi: %lu reklam, %lu cerceve, %lu kayip, kapsama %u/1000, WiFi %lu",
+             (unsigned long)scanWindow.adverts, (unsigned long)scanWindow.frames, (unsigned long)scanWindow.lost,
+             scanWindow.coverage(), (unsigned long)scanWindow.wifiTx);
+    if (changed) {
+        APP_LOGI("BLE gorev orani: %u/%u ms (kapsama %u/1000)", scanPolicy.duty().windowMs,
+                 scanPolicy.duty().intervalMs, scanWindow.coverage());
+        pBLEScan->stop(); // Yeni ayar asagida hemen baslatilir
+    }
+
+    scanWindow = ScanWindow();
+    scanWindow.startedAt = now;
+    scanWindow.level = scanPolicy.level();
+    scanWindowDrops = drops;
+    scanWindowTx = tx;
+}
+
+void VictronBLE::getScanStats(VictronScanStats& out) const {
+    for (;;) {
+        uint8_t idx = activeScanStats.load(std::memory_order_acquire);
+        uint32_t seq = scanStatsSeq[idx].load(std::memory_order_acquire);
+        if (seq & 1) continue; // Yazar bu tampona yeniden yaziyor
+        out = scanStats[idx];
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (scanStatsSeq[idx].load(std::memory_order_relaxed) == seq) break;
+    }
+    out.restarts = scanRestarts.load(std::memory_order_relaxed);
 }
 
 void VictronBLE::update() {
-    if(!pBLEScan->isScanning()) {
-        // Asenkron (Non-blocking) tarama başlat
-        // 5 saniye sürecek, bittiğinde scanEndedCB çağrılacak.
-        // Bu sayede loop() döngüsü bloklanmaz ve buton çalışır.
-        pBLEScan->start(5, scanEndedCB, false);
+    // Eski kayitlari saniyede bir temizle: anahtari olanlar tabloda kalir
+    // (sadece canli veri dusurulur), anahtarsiz (simulasyon) kayitlar silinir.
+    unsigned long now = millis();
+    if (now - lastExpireCheck >= 1000) {
+        lastExpireCheck = now;
+        size_t expired = devices.expire(now, VICTRON_STALE_TIMEOUT_MS, [this](VictronDeviceEntry& e) {
+            if (e.data.valid) fleet.remove(fleetContribution(e));
+            e.data.valid = false;
+            return !e.key.ready;
+        });
+        if (expired > 0) snapshotDirty = true;
+        publishRxStats();
+    }
+
+    // Callback'in biriktirdigi reklamlari burada (loop task) coz
+    while (const VictronRawAdvert* advert = advertQueue.front()) {
+        processAdvert(*advert);
+        advertQueue.pop();
+    }
+
+    if (snapshotDirty || (snapshotTouched && now - lastSnapshotPublish >= VICTRON_SNAPSHOT_REFRESH_MS)) {
+        publishSnapshot();
+    }
+
+    if (now - scanWindow.startedAt >= SCAN_STATS_WINDOW_MS) closeScanWindow(now);
+
+    // Tarama suresiz; sadece ayar degisince ya da NimBLE durdurursa yeniden baslar
+    if (!pBLEScan->isScanning()) {
+        if (scanStarted) scanRestarts.fetch_add(1, std::memory_order_relaxed);
+        scanStarted = true;
+        startScan();
     }
 }
 
-bool VictronBLE::decryptData(String macAddress, const uint8_t* rawData, size_t len, uint8_t* decryptedBuffer) {
-    macAddress.toLowerCase();
-    
-    if (deviceKeys.find(macAddress) == deviceKeys.end()) {
-        Serial.printf("HATA: %s icin anahtar bulunamadi!\n", macAddress.c_str());
-        lastError = "Key Yok: " + macAddress;
-        return false;
+void VictronBLE::publishRxStats() {
+    uint8_t target = activeRxStats.load(std::memory_order_relaxed) ^ 1;
+    RxStatsBuffer& buf = rxStats[target];
+    rxStatsSeq[target].fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    size_t count = 0;
+    devices.forEach([&buf, &count](const VictronDeviceEntry& e) {
+        if (!e.key.ready) return; // Simulasyon kaydi
+        buf.items[count].mac = e.mac;
+        buf.items[count].rx = e.rx;
+        count++;
+    });
+    buf.count = count;
+    rxStatsSeq[target].fetch_add(1, std::memory_order_release);
+    activeRxStats.store(target, std::memory_order_release);
+}
+
+bool VictronBLE::getRxStatsAfter(uint64_t afterMac, VictronRxStats& out) const {
+    for (;;) {
+        uint8_t idx = activeRxStats.load(std::memory_order_acquire);
+        uint32_t seq = rxStatsSeq[idx].load(std::memory_order_acquire);
+        if (seq & 1) continue; // Yazar bu tampona yeniden yaziyor
+
+        const RxStatsBuffer& buf = rxStats[idx];
+        size_t count = buf.count;
+        if (count > VictronDeviceTable::MAX_ENTRIES) continue;
+        size_t best = count;
+        for (size_t i = 0; i < count; i++) {
+            uint64_t mac = buf.items[i].mac;
+            if (mac > afterMac && (best == count || mac < buf.items[best].mac)) best = i;
+        }
+        if (best < count) out = buf.items[best];
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (rxStatsSeq[idx].load(std::memory_order_relaxed) == seq) return best < count;
     }
-    
-    const uint8_t* key = deviceKeys[macAddress].data();
+}
+
+// RSSI ve reklam araligi; tekrar eden cerceveler dahil her reklamda
+void VictronBLE::noteAdvert(DeviceRxStats& rx, const VictronRawAdvert& advert) {
+    rx.adverts++;
+    rx.rssiEwma = rx.lastAdvertAt ? rx.rssiEwma + (advert.rssi - rx.rssiEwma) * 0.125f : (float)advert.rssi;
+    rx.rssiLast = advert.rssi;
+    if (rx.lastAdvertAt) {
+        uint32_t interval = advert.timestamp - rx.lastAdvertAt;
+        int bucket = 0;
+        while (bucket < VICTRON_RX_INTERVAL_BUCKETS - 1 && interval > VICTRON_RX_INTERVAL_BOUNDS_MS[bucket]) bucket++;
+        rx.intervalBuckets[bucket]++;
+        rx.intervalSumMs += interval;
+        rx.intervalCount++;
+    }
+    rx.lastAdvertAt = advert.timestamp;
+}
+
+bool VictronBLE::decryptData(VictronDeviceKey& entry, const uint8_t* rawData, size_t len, uint8_t* decryptedBuffer) {
+    const uint8_t* key = entry.key;
 
     // Header 8 byte olmalı: 0x10, Len, ModelL, ModelH, Type, IV_L, IV_H, KeyCheck
     if (len < 10) return false; 
@@ -97,8 +326,8 @@ bool VictronBLE::decryptData(String macAddress, const uint8_t* rawData, size_t l
 
     // Key Check (Byte 7) - Anahtarın ilk byte'ı ile eşleşmeli
     if (rawData[7] != key[0]) {
-        Serial.printf("Key Check Hatasi: %02X != %02X\n", rawData[7], key[0]);
-        lastError = "Key Check Fail";
+        APP_LOGD("Key Check Hatasi: %02X != %02X", rawData[7], key[0]);
+        setError("Key Check Fail");
         return false;
     }
 
@@ -113,275 +342,387 @@ bool VictronBLE::decryptData(String macAddress, const uint8_t* rawData, size_t l
     size_t encryptedLen = len - 8;
     const uint8_t* encryptedPtr = &rawData[8];
 
-    mbedtls_aes_context aes;
-    mbedtls_aes_init(&aes);
-    
-    int ret = mbedtls_aes_setkey_enc(&aes, key, 128);
-    if (ret != 0) return false;
-
+    // Key schedule addDevice'da hazirlandi, burada sadece CTR
     size_t nc_off = 0;
     uint8_t stream_block[16] = {0};
     
-    ret = mbedtls_aes_crypt_ctr(&aes, encryptedLen, &nc_off, nonce, stream_block, encryptedPtr, decryptedBuffer);
-    
-    mbedtls_aes_free(&aes);
+    int ret = mbedtls_aes_crypt_ctr(&entry.aes, encryptedLen, &nc_off, nonce, stream_block, encryptedPtr, decryptedBuffer);
     
     return (ret == 0);
 }
 
-void VictronBLE::parseDecryptedData(const uint8_t* data, size_t len, VictronData& result, uint8_t readoutType) {
-    // Little Endian Helper
-    auto getU16 = [&](int idx) -> uint16_t { return data[idx] | (data[idx+1] << 8); };
-    auto getS16 = [&](int idx) -> int16_t { return data[idx] | (data[idx+1] << 8); };
-    auto getU24 = [&](int idx) -> uint32_t { return data[idx] | (data[idx+1] << 8) | (data[idx+2] << 16); };
-    
+void VictronBLE::parseDecryptedData(const uint8_t* data, size_t len, VictronData& result, uint8_t readoutType, uint16_t modelId) {
     result.timestamp = millis();
-    result.valid = true;
 
     // DEBUG: Decrypted Data'yı bas
-    Serial.printf("Decrypted (%d byte, Type %02X): ", len, readoutType);
-    for(size_t i=0; i<len; i++) Serial.printf("%02X ", data[i]);
-    Serial.println();
-
-    if (readoutType == 0x01) {
-        // --- SOLAR CHARGER (MPPT) ---
-        result.type = SOLAR_CHARGER;
-        // 0: State (u8)
-        result.deviceState = data[0];
-        // Durum açıklaması (Victron MPPT State Codes)
-        switch (result.deviceState) {
-            case 0: result.chargeStateDesc = "Off"; break;
-            case 2: result.chargeStateDesc = "Fault"; break;
-            case 3: result.chargeStateDesc = "Bulk"; break;
-            case 4: result.chargeStateDesc = "Absorption"; break;
-            case 5: result.chargeStateDesc = "Float"; break;
-            case 7: result.chargeStateDesc = "Equalize"; break;
-            case 245: result.chargeStateDesc = "WakeUp"; break;
-            case 252: result.chargeStateDesc = "Ext.Control"; break;
-            default: result.chargeStateDesc = "Unknown"; break;
-        }
-
-        // 1: Error (u8)
-        result.alarm = data[1];
-        // 2-3: Battery Voltage (s16, 0.01V)
-        result.voltage = (float)getS16(2) / 100.0;
-        // 4-5: Battery Current (s16, 0.1A)
-        result.current = (float)getS16(4) / 10.0;
-        // 6-7: PV Power (u16, 1W)
-        result.pvPower = (float)getU16(6);
-        
-        // 8-9: Yield Today (u16, 10Wh units -> 0.01 kWh)
-        result.yieldToday = (float)getU16(8) * 0.01;
-        
-        // Verim Hesabı: (Battery Power / PV Power) * 100
-        // Battery Power = Voltage * Current (Output)
-        float batteryPower = result.voltage * result.current;
-        if (result.pvPower > 0) {
-            result.efficiency = (batteryPower / result.pvPower) * 100.0;
-            if (result.efficiency > 100.0) result.efficiency = 100.0; // Limit
-            if (result.efficiency < 0.0) result.efficiency = 0.0;
-        } else {
-            result.efficiency = 0.0;
-        }
-
-        // 10-11: Load Current (9 bits, 0.1A)
-        // Repo: vic_9bit_0_1_negative load_current : 9;
-        if (len >= 12) {
-            uint16_t load_raw = getU16(10);
-
-            int16_t load_current_9 = (int16_t)(load_raw & 0x1FF);
-            if (load_current_9 & 0x100) {
-                load_current_9 |= (int16_t)~0x1FF;
-            }
-
-            // 0x1FF -> -1 -> -0.1A genelde "unknown/unset" olarak görülüyor.
-            result.loadCurrent = (load_current_9 == -1) ? -1.0f : (float)load_current_9 / 10.0f;
-
-            // Bit 9: Load State (1=On, 0=Off)
-            result.loadState = (load_raw & 0x200) ? 1 : 0;
-        } else {
-            result.loadCurrent = -1.0f;
-            result.loadState = -1;
-        }
-
-        // PV Voltage/Current: BLE Advertisement paketinde bulunmuyor.
-        // Ancak 0W ise 0 kabul edebiliriz.
-        if (result.pvPower == 0) {
-            result.pvVoltage = 0.0;
-            result.pvCurrent = 0.0;
-        } else {
-            // Eğer güç varsa ama voltaj bilinmiyorsa, hesaplanamaz.
-            // Şimdilik 0 bırakıyoruz, frontend'de "--" gösterilebilir.
-        }
-
-    } else if (readoutType == 0x02) {
-        // --- BATTERY MONITOR (SmartShunt / BMV) ---
-        result.type = BATTERY_MONITOR;
-        
-        // 0-1: Time To Go (u16 minutes)
-        uint16_t ttg = getU16(0);
-        result.remainingMins = (ttg == 0xFFFF) ? -1 : ttg;
-        
-        // 2-3: Voltage (s16, 0.01V)
-        result.voltage = (float)getS16(2) / 100.0;
-        
-        // 4-5: Alarm (u16)
-        result.alarm = getU16(4);
-
-        // 6-7: Aux Voltage (u16, 0.01V) - Starter Battery
-        result.auxVoltage = (float)getS16(6) / 100.0; 
+#if APP_LOG_LEVEL >= APP_LOG_VERBOSE
+    char hex[3 * 32 + 1];
+    formatHex(data, len, hex, sizeof(hex));
+    APP_LOGV("Decrypted (%d byte, Type %02X, Model %04X): %s", (int)len, readoutType, modelId, hex);
+#endif
+
+    // Kayit tablosu ile coz (VictronRecords.cpp)
+    result.valid = victronDecodeRecord(readoutType, modelId, data, len, result);
+    if (!result.valid) {
+        APP_LOGD("Bilinmeyen kayit tipi: %02X (Model %04X)", readoutType, modelId);
+    }
+}
 
-        // --- BITFIELDS PARSING (Bytes 8-14) ---
-        // Reference: struct VICTRON_BLE_RECORD_BATTERY_MONITOR
-        
-        // Bytes 8, 9, 10 contain:
-        // - aux_input_type : 2 bits (LSB of Byte 8)
-        // - battery_current : 22 bits
-        uint32_t raw_current_chunk = data[8] | (data[9] << 8) | (data[10] << 16);
-        
-        // Extract Current (Shift right 2 bits, mask 22 bits)
-        int32_t current_val = (raw_current_chunk >> 2) & 0x3FFFFF;
-        // Sign extension for 22-bit integer
-        if (current_val & 0x200000) {
-            current_val |= 0xFFC00000;
-        }
-        result.current = (float)current_val / 1000.0; // 0.001A resolution
-        
-        // Bytes 11, 12, 13 contain:
-        // - consumed_ah : 20 bits (Starts at Byte 11)
-        uint32_t raw_ah_chunk = data[11] | (data[12] << 8) | (data[13] << 16);
-        uint32_t ah_val = raw_ah_chunk & 0xFFFFF; // Mask 20 bits
-        
-        // Repo: vic_20bit_0_1_negative (Consumed Ah = -Record value)
-        // It seems the value transmitted is positive magnitude, but represents consumption.
-        // If we follow standard Victron logic, Consumed Ah is usually negative or zero.
-        // Let's store it as negative as per repo hint.
-        if (ah_val == 0xFFFFF) {
-             // Unknown/Unset?
-             result.consumedAh = 0.0;
-        } else {
-             result.consumedAh = -1.0 * (float)ah_val / 10.0; // 0.1Ah resolution
-        }
+// FNV-1a (32 bit): 27 byte icin AES-CTR'nin yaninda maliyeti yok denecek kadar az
+static uint32_t payloadHash(const uint8_t* data, size_t len) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < len; i++) {
+        hash ^= data[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
 
-        // Bytes 13, 14 contain:
-        // - state_of_charge : 10 bits (Starts at Bit 4 of Byte 13)
-        // We need Byte 13 and Byte 14.
-        uint16_t raw_soc_chunk = data[13] | (data[14] << 8);
-        uint16_t soc_val = (raw_soc_chunk >> 4) & 0x3FF; // Shift right 4, mask 10 bits
-        
-        // 0.1% resolution, range 0..1000 (100.0%)
-        if (soc_val > 1000) {
-            result.soc = 100.0; // Or indicate error
-        } else {
-            result.soc = (float)soc_val / 10.0;
+// Ham reklam paketinde Manufacturer Data (AD tipi 0xFF) alanini bul.
+// getManufacturerData() her reklamda std::string kopyalar; bu kopyalamaz.
+static bool findManufacturerData(const uint8_t* payload, size_t len, const uint8_t*& data, size_t& dataLen) {
+    size_t i = 0;
+    while (i + 1 < len) {
+        uint8_t fieldLen = payload[i];
+        if (fieldLen == 0 || i + 1 + fieldLen > len) return false;
+        if (payload[i + 1] == 0xFF) {
+            data = &payload[i + 2];
+            dataLen = fieldLen - 1;
+            return true;
         }
-        
-        result.power = result.voltage * result.current;
-        
-        // Debug
-        Serial.printf("Parsed BMV: V=%.2f I=%.3f Ah=%.1f SOC=%.1f\n", 
-            result.voltage, result.current, result.consumedAh, result.soc);
-
-    } else {
-        result.type = UNKNOWN;
+        i += 1 + fieldLen;
     }
+    return false;
 }
 
 void VictronBLE::onResult(NimBLEAdvertisedDevice* advertisedDevice) {
+    // NimBLE host task'inda calisir: decode yok, log yok, sadece kuyruga yaz.
     // Sadece Manufacturer Data olan cihazlarla ilgileniyoruz
-    if (!advertisedDevice->haveManufacturerData()) return;
-
-    std::string manuData = advertisedDevice->getManufacturerData();
+    const uint8_t* data;
+    size_t dataLen;
+    if (!findManufacturerData(advertisedDevice->getPayload(), advertisedDevice->getPayloadLength(), data, dataLen)) return;
     
     // Veri çok kısaysa yoksay
-    if (manuData.length() < 4) return;
-
-    uint8_t* data = (uint8_t*)manuData.data();
+    if (dataLen < 4 || dataLen - 2 > VICTRON_MAX_PAYLOAD) return;
 
     // Victron ID kontrolü: 0x02E1 (Little Endian -> E1 02)
-    // Ancak bazı durumlarda ID başta olmayabilir veya farklı olabilir.
-    // Debug için gördüğümüz tüm Manufacturer Data ID'lerini yazdıralım (kısa süreliğine)
-    // Serial.printf("BLE Device: %s, ManuID: %02X%02X\n", advertisedDevice->getAddress().toString().c_str(), data[0], data[1]);
-
     if (data[0] != 0xE1 || data[1] != 0x02) return;
-    
-    String mac = advertisedDevice->getAddress().toString().c_str();
-    lastSeenDevice = mac; // Son gorulen cihazi kaydet
-    Serial.printf("Victron Cihazi Bulundu: %s\n", mac.c_str());
 
-    const uint8_t* victronPayload = &data[2];
-    size_t victronLen = manuData.length() - 2;
+    VictronRawAdvert* advert = advertQueue.reserve();
+    if (advert == nullptr) return; // Kuyruk dolu, drop sayaci artti
+
+    advert->mac = (uint64_t)advertisedDevice->getAddress();
+    advert->timestamp = millis();
+    advert->rssi = (int8_t)advertisedDevice->getRSSI();
+    advert->len = (uint8_t)(dataLen - 2);
+    memcpy(advert->payload, &data[2], dataLen - 2);
+    advertQueue.commit();
+}
+
+void VictronBLE::processAdvert(const VictronRawAdvert& advert) {
+    lastSeenMac = advert.mac; // Son gorulen cihazi kaydet
+
+    // MAC metni sadece gerektiginde (log/hata) uretilir: tekrar eden
+    // cercevelerde snprintf maliyeti decode'dan pahali olurdu
+    char macText[18];
+
+    const uint8_t* victronPayload = advert.payload;
+    size_t victronLen = advert.len;
     
     // Header Kontrol (0x10 = Victron BLE Protocol)
     uint8_t header = victronPayload[0];
     if (header != 0x10) {
         // DEBUG: Ham Veriyi Bas
-        Serial.printf("Victron Cihazi (MAC: %s) -> Header: %02X, Data: ", mac.c_str(), header);
-        for(size_t i=0; i<manuData.length(); i++) Serial.printf("%02X ", (uint8_t)manuData[i]);
-        Serial.println();
+#if APP_LOG_LEVEL >= APP_LOG_DEBUG
+        formatMacAddress(advert.mac, macText);
+        char hex[3 * VICTRON_MAX_PAYLOAD + 1];
+        formatHex(victronPayload, victronLen, hex, sizeof(hex));
+        APP_LOGD("Victron Cihazi (MAC: %s) -> Header: %02X, Data: E1 02 %s", macText, header, hex);
+#endif
         return;
     }
 
+    VictronDeviceEntry* entry = devices.find(advert.mac);
+    if (entry == nullptr || !entry->key.ready) {
+        formatMacAddress(advert.mac, macText);
+        APP_LOGD("HATA: %s icin anahtar bulunamadi!", macText);
+        setError("Key Yok: %s", macText);
+        return;
+    }
+
+    scanWindow.adverts++;
+    noteAdvert(entry->rx, advert);
+
+    // 8 byte baslik + en az 2 byte sifreli veri (decryptData ile ayni sinir);
+    // kisa cercevede IV / anahtar kontrolu byte'lari yok
+    if (victronLen < 10) return;
+
+    // Ayni cerceve tekrar geldiyse: sadece son gorulme ve RSSI yenilenir
+    uint16_t iv = victronPayload[5] | (victronPayload[6] << 8);
+    uint32_t hash = payloadHash(victronPayload, victronLen);
+    if (entry->lastLen == victronLen && entry->lastIv == iv && entry->lastHash == hash && entry->data.valid) {
+        duplicateCount++;
+        entry->rx.duplicates++;
+        entry->data.timestamp = advert.timestamp;
+        entry->data.rssi = advert.rssi;
+        entry->lastSeen = advert.timestamp;
+        snapshotTouched = true;
+        return;
+    }
+
+#if APP_LOG_LEVEL >= APP_LOG_VERBOSE
+    formatMacAddress(advert.mac, macText);
+    APP_LOGV("Victron Cihazi Bulundu: %s", macText);
+#endif
+
     uint8_t decrypted[32] = {0};
     
-    if (decryptData(mac, victronPayload, victronLen, decrypted)) {
-        Serial.printf("Sifre Cozme BASARILI: %s\n", mac.c_str());
+    if (decryptData(entry->key, victronPayload, victronLen, decrypted)) {
+#if APP_LOG_LEVEL >= APP_LOG_VERBOSE
+        APP_LOGV("Sifre Cozme BASARILI: %s", macText);
+#endif
         
-        // Mevcut kaydı al veya yeni oluştur
-        VictronData& devData = devices[mac];
-        devData.macAddress = mac;
+        // Kayit tabloda inline duruyor, kopyalama yok
+        VictronData& devData = entry->data;
         
         // Model ID ve Readout Type (Offset düzeltmesi: +1 kaydı)
         // 0: 0x10, 1: Len, 2: ModelL, 3: ModelH, 4: Type
         uint16_t modelId = victronPayload[2] | (victronPayload[3] << 8);
         uint8_t readoutType = victronPayload[4];
 
+        // Onceki cerceveden bu yana IV boslugu = kacirilan cerceveler
+        // (anahtar yeni / kayit eskidi: karsilastirilacak cerceve yok)
+        if (entry->lastLen != 0 && devData.valid) {
+            uint16_t gap = (uint16_t)(iv - entry->lastIv);
+            if (gap > 1 && gap <= SCAN_MAX_IV_GAP) {
+                scanWindow.lost += gap - 1;
+                entry->rx.lost += gap - 1;
+            }
+        }
+        scanWindow.frames++;
+
         // Veriyi işle (Header 8 byte olduğu için len - 8)
-        parseDecryptedData(decrypted, victronLen - 8, devData, readoutType);
-    } else {
-        // Şifre çözme başarısızsa nedenini anlamak için log
-        // Serial.printf("Sifre Cozme BASARISIZ: %s (Anahtar tanimli mi?)\n", mac.c_str());
+        if (devData.valid) fleet.remove(fleetContribution(*entry));
+        parseDecryptedData(decrypted, victronLen - 8, devData, readoutType, modelId);
+        decodeCount++;
+        entry->rx.decodes++;
+        if (!devData.valid) {
+            entry->rx.decodeErrors++;
+            snapshotDirty = true; // Onceki deger snapshot'tan duser
+            return;
+        }
+        fleet.add(fleetContribution(*entry));
+        entry->lastIv = iv;
+        entry->lastLen = (uint8_t)victronLen;
+        entry->lastHash = hash;
+        devData.timestamp = advert.timestamp; // Kuyrukta bekleme suresi sayilmasin
+        devData.rssi = advert.rssi;
+        entry->lastSeen = advert.timestamp;
+        entry->rx.lastGoodAt = advert.timestamp;
+        recordSample(*entry);
+        snapshotDirty = true;
+    } else if (victronPayload[7] != entry->key.key[0]) {
+        entry->rx.keyCheckFails++; // Cihazdaki anahtar degismis olabilir
+    }
+}
+
+// Aralik istatistigi + ham ornek. Power kaydi yoksa V*I (telemetriyle ayni kural).
+void VictronBLE::recordSample(VictronDeviceEntry& entry) {
+    VictronData& d = entry.data;
+    float values[SAMPLE_METRIC_COUNT];
+    values[SM_VOLTAGE] = d.voltage;
+    values[SM_CURRENT] = d.current;
+    values[SM_POWER] = (d.power == 0 && d.voltage > 0) ? d.voltage * d.current : d.power;
+    values[SM_PV_POWER] = d.pvPower;
+    entry.samples.add(d.timestamp, values);
+
+    d.minBatteryVoltage = entry.samples.stats[SM_VOLTAGE].min;
+    d.maxBatteryVoltage = entry.samples.stats[SM_VOLTAGE].max;
+    d.maxPvPower = entry.samples.stats[SM_PV_POWER].max;
+}
+
+FleetContribution VictronBLE::fleetContribution(const VictronDeviceEntry& entry) {
+    const VictronData& d = entry.data;
+    FleetContribution c = {};
+    c.typeSlot = fleetTypeSlot(d.type);
+    c.mppt = (d.type == SOLAR_CHARGER);
+    c.bank = (d.type == BATTERY_MONITOR || d.type == LYNX_BMS);
+    if (c.mppt) {
+        c.pvPowerDw = fleetFixed(d.pvPower, 0.1f);
+        c.chargeStateSlot = fleetChargeStateSlot(d.deviceState);
+    }
+    if (c.bank) {
+        float power = (d.power == 0 && d.voltage > 0) ? d.voltage * d.current : d.power;
+        c.voltageMv = fleetFixed(d.voltage, 0.001f);
+        c.currentMa = fleetFixed(d.current, 0.001f);
+        c.powerDw = fleetFixed(power, 0.1f);
+        c.weightDah = fleetFixed(entry.capacityAh > 0 ? entry.capacityAh : FLEET_DEFAULT_CAPACITY_AH, 0.1f);
+        c.socWeighted = (int64_t)fleetFixed(d.soc, 0.1f) * c.weightDah;
+        c.remainingFinite = d.remainingMins >= 0 && d.remainingMins != 0xFFFF;
+        if (c.remainingFinite) c.remainingWeighted = (int64_t)d.remainingMins * c.weightDah;
+    }
+    return c;
+}
+
+// Sadece toplu degisikliklerde (simulasyon); normal yol O(1) ekle/cikar
+void VictronBLE::rebuildFleet() {
+    fleet.clear();
+    devices.forEach([this](const VictronDeviceEntry& e) {
+        if (e.data.valid) fleet.add(fleetContribution(e));
+    });
+}
+
+bool VictronBLE::setCapacity(uint64_t mac, float capacityAh) {
+    VictronDeviceEntry* entry = devices.find(mac);
+    if (entry == nullptr) return false;
+    if (entry->data.valid) fleet.remove(fleetContribution(*entry));
+    entry->capacityAh = capacityAh;
+    if (entry->data.valid) {
+        fleet.add(fleetContribution(*entry));
+        snapshotDirty = true;
+    }
+    return true;
+}
+
+bool VictronBLE::peekSamples(uint64_t mac, DeviceSamples& out) const {
+    const VictronDeviceEntry* entry = devices.find(mac);
+    if (entry == nullptr || entry->samples.empty()) return false;
+    out = entry->samples;
+    return true;
+}
+
+void VictronBLE::resetSamples(uint64_t mac) {
+    VictronDeviceEntry* entry = devices.find(mac);
+    if (entry != nullptr) entry->samples.reset();
+}
+
+void VictronBLE::publishSnapshot() {
+    uint8_t target = activeSnapshot.load(std::memory_order_relaxed) ^ 1;
+    VictronSnapshot& snap = snapshots[target];
+
+    // Tek sayi = yaziliyor
+    snapshotSeq[target].fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    size_t count = 0;
+    devices.forEach([&](const VictronDeviceEntry& e) {
+        if (e.data.valid) snap.devices[count++] = e.data;
+    });
+    snap.count = count;
+    snap.fleet = fleet.totals();
+    snap.version = snapshotVersion.load(std::memory_order_relaxed) + 1;
+
+    snapshotSeq[target].fetch_add(1, std::memory_order_release);
+    activeSnapshot.store(target, std::memory_order_release);
+    snapshotVersion.store(snap.version, std::memory_order_release);
+
+    unsigned long now = millis();
+    if (snapshotDirty || now - lastDataVersionAt >= VICTRON_DATA_RSSI_REFRESH_MS) {
+        dataVersion.fetch_add(1, std::memory_order_release);
+        lastDataVersionAt = now;
+    }
+    snapshotDirty = false;
+    snapshotTouched = false;
+    lastSnapshotPublish = now;
+}
+
+bool VictronBLE::getSnapshot(VictronSnapshot& out) const {
+    if (out.version != 0 && out.version == getVersion()) return false;
+
+    for (;;) {
+        uint8_t idx = activeSnapshot.load(std::memory_order_acquire);
+        uint32_t seq = snapshotSeq[idx].load(std::memory_order_acquire);
+        if (seq & 1) continue; // Yazar bu tampona yeniden yaziyor
+
+        const VictronSnapshot& snap = snapshots[idx];
+        size_t count = snap.count;
+        if (count > VictronDeviceTable::MAX_ENTRIES) continue;
+        out.version = snap.version;
+        out.count = count;
+        memcpy(out.devices, snap.devices, count * sizeof(VictronData));
+        out.fleet = snap.fleet;
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (snapshotSeq[idx].load(std::memory_order_relaxed) == seq) return true;
     }
 }
 
+bool VictronBLE::getDeviceAfter(uint64_t afterMac, VictronData& out) const {
+    for (;;) {
+        uint8_t idx = activeSnapshot.load(std::memory_order_acquire);
+        uint32_t seq = snapshotSeq[idx].load(std::memory_order_acquire);
+        if (seq & 1) continue;
+
+        const VictronSnapshot& snap = snapshots[idx];
+        size_t count = snap.count;
+        if (count > VictronDeviceTable::MAX_ENTRIES) continue;
+        size_t best = count;
+        for (size_t i = 0; i < count; i++) {
+            uint64_t mac = snap.devices[i].mac;
+            if (mac > afterMac && (best == count || mac < snap.devices[best].mac)) best = i;
+        }
+        if (best < count) out = snap.devices[best];
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (snapshotSeq[idx].load(std::memory_order_relaxed) == seq) return best < count;
+    }
+}
+
+String VictronBLE::getLastSeenDevice() const {
+    if (lastSeenMac == 0) return String();
+    char macText[18];
+    formatMacAddress(lastSeenMac, macText);
+    return String(macText);
+}
+
+// Simulasyon kaydi: anahtari yok, eskidiginde tablodan silinir
+static VictronData* simulatedDevice(VictronDeviceTable& devices, uint64_t mac) {
+    VictronDeviceEntry* entry = devices.insert(mac);
+    if (entry == nullptr) return nullptr;
+    entry->data.mac = mac;
+    entry->lastSeen = millis();
+    return &entry->data;
+}
+
 void VictronBLE::simulate() {
     // 1. MPPT - Solar Charger 1
-    String mac1 = "AA:BB:CC:DD:EE:01";
-    VictronData& dev1 = devices[mac1];
-    dev1.macAddress = mac1;
-    dev1.type = SOLAR_CHARGER;
-    dev1.valid = true;
-    dev1.timestamp = millis();
-    dev1.voltage = 13.5 + (random(-10, 10) / 100.0);
-    dev1.current = 10.0 + (random(-5, 5) / 10.0);
-    dev1.pvPower = 150.0 + random(-10, 20);
-    dev1.deviceState = 3; // Bulk
-    dev1.loadCurrent = 0;
+    VictronData* dev1 = simulatedDevice(devices, 0xAABBCCDDEE01ULL);
+    if (dev1 == nullptr) return;
+    dev1->type = SOLAR_CHARGER;
+    dev1->valid = true;
+    dev1->timestamp = millis();
+    dev1->voltage = 13.5 + (random(-10, 10) / 100.0);
+    dev1->current = 10.0 + (random(-5, 5) / 10.0);
+    dev1->pvPower = 150.0 + random(-10, 20);
+    dev1->deviceState = 3; // Bulk
+    dev1->loadCurrent = 0;
 
     // 2. MPPT - Solar Charger 2
-    String mac2 = "AA:BB:CC:DD:EE:02";
-    VictronData& dev2 = devices[mac2];
-    dev2.macAddress = mac2;
-    dev2.type = SOLAR_CHARGER;
-    dev2.valid = true;
-    dev2.timestamp = millis();
-    dev2.voltage = 13.5 + (random(-10, 10) / 100.0);
-    dev2.current = 8.0 + (random(-5, 5) / 10.0);
-    dev2.pvPower = 120.0 + random(-10, 20);
-    dev2.deviceState = 3; // Bulk
-    dev2.loadCurrent = 0;
+    VictronData* dev2 = simulatedDevice(devices, 0xAABBCCDDEE02ULL);
+    if (dev2 == nullptr) return;
+    dev2->type = SOLAR_CHARGER;
+    dev2->valid = true;
+    dev2->timestamp = millis();
+    dev2->voltage = 13.5 + (random(-10, 10) / 100.0);
+    dev2->current = 8.0 + (random(-5, 5) / 10.0);
+    dev2->pvPower = 120.0 + random(-10, 20);
+    dev2->deviceState = 3; // Bulk
+    dev2->loadCurrent = 0;
 
     // 3. SmartShunt - Battery Monitor
-    String mac3 = "AA:BB:CC:DD:EE:03";
-    VictronData& dev3 = devices[mac3];
-    dev3.macAddress = mac3;
-    dev3.type = BATTERY_MONITOR;
-    dev3.valid = true;
-    dev3.timestamp = millis();
-    dev3.voltage = 12.8 + (random(-5, 5) / 100.0);
-    dev3.current = -5.2 + (random(-1, 1) / 10.0);
-    dev3.power = dev3.voltage * dev3.current;
-    dev3.soc = 85.5 + (random(-1, 1) / 10.0);
-    dev3.consumedAh = -20.0;
-    dev3.remainingMins = 1200;
+    VictronData* dev3 = simulatedDevice(devices, 0xAABBCCDDEE03ULL);
+    if (dev3 == nullptr) return;
+    dev3->type = BATTERY_MONITOR;
+    dev3->valid = true;
+    dev3->timestamp = millis();
+    dev3->voltage = 12.8 + (random(-5, 5) / 100.0);
+    dev3->current = -5.2 + (random(-1, 1) / 10.0);
+    dev3->power = dev3->voltage * dev3->current;
+    dev3->soc = 85.5 + (random(-1, 1) / 10.0);
+    dev3->consumedAh = -20.0;
+    dev3->remainingMins = 1200;
+
+    rebuildFleet();
+    snapshotDirty = true;
+    publishSnapshot();
 }
@@ -5,20 +5,33 @@
 #include <NimBLEDevice.h>
 #include "mbedtls/aes.h"
 
-// Desteklenen Cihaz Tipleri
+// Desteklenen Cihaz Tipleri (degerler Victron readout type ile ayni)
 enum VictronDeviceType {
     SOLAR_CHARGER = 0x01,
     BATTERY_MONITOR = 0x02,
     INVERTER = 0x03,
     DC_DC = 0x04,
+    SMART_LITHIUM = 0x05,
+    INVERTER_RS = 0x06,
+    AC_CHARGER = 0x08,
+    BATTERY_PROTECT = 0x09,
+    LYNX_BMS = 0x0A,
+    MULTI_RS = 0x0B,
+    VE_BUS = 0x0C,
+    DC_ENERGY_METER = 0x0D,
+    ORION_XS = 0x0F,
+    // Readout type karsiligi yok: urun ID'sinden ayrilir (0x02 kaydi gonderir)
+    SMART_BATTERY_SENSE = 0x20,
     UNKNOWN = 0xFF
 };
 
 struct VictronData {
     bool valid = false;
     VictronDeviceType type = UNKNOWN;
-    String macAddress;
-    unsigned long timestamp;
+    uint64_t mac = 0;        // 0xAABBCCDDEEFF (metin icin formatMacAddress)
+    uint16_t modelId = 0;    // Victron urun ID (orn. 0xA389 SmartShunt)
+    unsigned long timestamp = 0;
+    int rssi = 0;            // Son reklamin sinyal gucu (dBm)
     
     // Ortak Veriler
     float voltage = 0.0;     // Akü Voltajı (V)
@@ -30,6 +43,8 @@ struct VictronData {
     float consumedAh = 0.0;  // Tüketilen Ah
     int remainingMins = 0;   // Kalan Süre
     float auxVoltage = 0.0;  // Marş Aküsü Voltajı (V)
+    float midVoltage = 0.0;  // Orta Nokta Voltajı (V)
+    int auxInputType = -1;   // 0: Marş aküsü, 1: Orta nokta, 2: Sıcaklık, 3: Yok
     
     // Solar Charger (MPPT) Özel
     float pvPower = 0.0;     // Panel Gücü (W)
@@ -44,48 +59,329 @@ struct VictronData {
     float temperature = -999.0; // Varsa sıcaklık
     int alarm = 0;           // Alarm durumu
 
+    // Inverter / Multi / VE.Bus / AC Şarj Cihazı
+    float acVoltage = 0.0;   // AC Çıkış Voltajı (V)
+    float acCurrent = 0.0;   // AC Akım (A)
+    float acPower = 0.0;     // AC Çıkış Gücü (W / VA)
+    float acInPower = 0.0;   // AC Giriş Gücü (W)
+    int activeAcIn = -1;     // Aktif AC Girişi (0: AC1, 1: AC2, 2: Yok)
+
+    // DC-DC / Orion XS / BatteryProtect
+    float inputVoltage = 0.0;  // Giriş Voltajı (V)
+    float inputCurrent = 0.0;  // Giriş Akımı (A)
+    float outputVoltage = 0.0; // Çıkış Voltajı (V, BatteryProtect)
+    int offReason = 0;         // Kapanma Nedeni (bit maskesi)
+
+    // SmartLithium
+    float minCellVoltage = 0.0; // En Düşük Hücre (V)
+    float maxCellVoltage = 0.0; // En Yüksek Hücre (V)
+    int balancerStatus = 0;
+
     // Ekstra Veriler (Veritabanı Şeması İçin)
-    float maxPvVoltage = 0.0;    // Günlük Max Panel Voltajı
-    float maxPvPower = 0.0;      // Günlük Max Panel Gücü
-    float minBatteryVoltage = 0.0; // Günlük Min Akü Voltajı
-    float maxBatteryVoltage = 0.0; // Günlük Max Akü Voltajı
+    // min/max: son telemetri gönderiminden bu yana (bkz. TelemetrySamples.h)
+    float maxPvVoltage = 0.0;    // Günlük Max Panel Voltajı (BLE kaydında yok)
+    float maxPvPower = 0.0;      // Aralık Max Panel Gücü
+    float minBatteryVoltage = 0.0; // Aralık Min Akü Voltajı
+    float maxBatteryVoltage = 0.0; // Aralık Max Akü Voltajı
     float totalYield = 0.0;      // Toplam Üretilen Enerji (Lifetime)
-    String chargeStateDesc = ""; // Şarj Durumu Açıklaması (Bulk, Abs, Float)
+    const char* chargeStateDesc = ""; // Şarj Durumu Açıklaması (Bulk, Abs, Float)
 };
 
-#include <map>
+#include <atomic>
+#include "MacTable.h"
+#include "SpscRing.h"
+#include "TelemetrySamples.h"
+#include "FleetAggregate.h"
+#include "ScanPolicy.h"
+
+// Cihaz tablosu kapasitesi (2'nin kuvveti). En fazla %75'i dolar.
+#ifndef VICTRON_DEVICE_TABLE_SIZE
+#define VICTRON_DEVICE_TABLE_SIZE 64
+#endif
+
+// Bu sureden eski kayitlar canli sayilmaz (Pasif tarama icin 60 sn)
+#define VICTRON_STALE_TIMEOUT_MS 60000
+
+// Sadece timestamp/RSSI yenilendiyse snapshot en fazla bu siklikta yayinlanir
+#ifndef VICTRON_SNAPSHOT_REFRESH_MS
+#define VICTRON_SNAPSHOT_REFRESH_MS 1000
+#endif
+
+// Veri surumu (getDataVersion, /api/data ETag'i) sadece RSSI degistiyse en
+// fazla bu siklikta artar: tekrar eden cercevelerde panel 304 alir
+#ifndef VICTRON_DATA_RSSI_REFRESH_MS
+#define VICTRON_DATA_RSSI_REFRESH_MS 30000
+#endif
+
+// Kayitli cihaz anahtari: AES key schedule addDevice'da bir kez hazirlanir,
+// her reklamda sadece CTR calisir. Kopyalaninca context yeniden kurulur
+// (tablo silmede slotlari kaydirir, yazilim mbedtls context'i tasinamaz).
+struct VictronDeviceKey {
+    uint8_t key[16] = {0};
+    mbedtls_aes_context aes;
+    bool ready = false;
+
+    VictronDeviceKey() { mbedtls_aes_init(&aes); }
+    ~VictronDeviceKey() { mbedtls_aes_free(&aes); }
+    VictronDeviceKey(const VictronDeviceKey& other) : VictronDeviceKey() { *this = other; }
+    VictronDeviceKey& operator=(const VictronDeviceKey& other) {
+        if (this == &other) return *this;
+        if (other.ready) set(other.key);
+        else clear();
+        return *this;
+    }
+
+    bool set(const uint8_t newKey[16]) {
+        clear();
+        memcpy(key, newKey, 16);
+        ready = (mbedtls_aes_setkey_enc(&aes, key, 128) == 0);
+        return ready;
+    }
+
+    void clear() {
+        mbedtls_aes_free(&aes);
+        mbedtls_aes_init(&aes);
+        memset(key, 0, sizeof(key));
+        ready = false;
+    }
+};
+
+// Cihaz basina alim istatistigi (/api/metrics). Sayaclar cihaz tabloya
+// eklendiginden beri birikir; sadece loop (processAdvert) yazar.
+#define VICTRON_RX_INTERVAL_BUCKETS 8  // Son kova +Inf
+extern const uint16_t VICTRON_RX_INTERVAL_BOUNDS_MS[VICTRON_RX_INTERVAL_BUCKETS - 1];
+
+struct DeviceRxStats {
+    uint32_t adverts = 0;          // Anahtarli cihazdan gelen reklamlar (tekrarlar dahil)
+    uint32_t duplicates = 0;       // Ayni cerceve, cozulmeden atlandi
+    uint32_t decodes = 0;          // Cozulen yeni cerceveler
+    uint32_t lost = 0;             // IV bosluklarindan kacirilan cerceveler
+    uint32_t keyCheckFails = 0;    // Anahtar kontrol byte'i uymadi (yanlis / eski anahtar)
+    uint32_t decodeErrors = 0;     // Cozuldu ama kayit tipi bilinmiyor
+    int8_t rssiLast = 0;
+    float rssiEwma = 0.0f;         // alfa 1/8, ilk reklamda rssiLast
+    unsigned long lastAdvertAt = 0; // millis, 0 = reklam yok
+    unsigned long lastGoodAt = 0;   // Son gecerli kayit (millis), 0 = yok
+    // Reklamlar arasi sure; kovalar kumulatif degil (yazilirken toplanir)
+    uint32_t intervalBuckets[VICTRON_RX_INTERVAL_BUCKETS] = {0};
+    uint64_t intervalSumMs = 0;
+    uint32_t intervalCount = 0;
+};
+
+// Cihaz tablosu kaydi: anahtar ve canli veri ayni slotta
+struct VictronDeviceEntry {
+    uint64_t mac = 0;           // 0xAABBCCDDEEFF, 0 = bos slot
+    unsigned long lastSeen = 0; // Son basarili decode (millis), 0 = canli veri yok
+    VictronDeviceKey key;
+    VictronData data;
+
+    // Son cozulen cercevenin parmak izi. Victron ayni sifreli cerceveyi
+    // (ayni IV) deger degisene kadar tekrar tekrar yayinlar.
+    uint16_t lastIv = 0;
+    uint8_t lastLen = 0;        // 0 = parmak izi yok
+    uint32_t lastHash = 0;      // FNV-1a, tum payload uzerinden
+
+    // Son telemetri gonderiminden bu yana ornekler (peekSamples ile okunur, resetSamples ile sifirlanir)
+    DeviceSamples samples;
+
+    // Aku bankasi kapasitesi (filo SOC agirligi), 0 = FLEET_DEFAULT_CAPACITY_AH
+    float capacityAh = 0.0f;
+
+    // Alim / cozme sayaclari (/api/metrics)
+    DeviceRxStats rx;
+};
+
+typedef MacTable<VictronDeviceEntry, VICTRON_DEVICE_TABLE_SIZE> VictronDeviceTable;
+
+struct DeviceKeyTable; // DeviceKeyTable.h
+
+// NimBLE callback'inden loop'a aktarilan ham reklam (sifre cozulmemis)
+#ifndef VICTRON_ADVERT_QUEUE_SIZE
+#define VICTRON_ADVERT_QUEUE_SIZE 32
+#endif
+#define VICTRON_MAX_PAYLOAD 27 // 31 byte reklam - AD basligi (2) - Company ID (2)
+
+struct VictronRawAdvert {
+    uint64_t mac;
+    unsigned long timestamp; // millis()
+    int8_t rssi;
+    uint8_t len;
+    uint8_t payload[VICTRON_MAX_PAYLOAD]; // E1 02 sonrasi: 0x10 header + sifreli veri
+};
+
+// Canli cihaz verisinin degismez kopyasi. Yazar (loop) her degisiklikte
+// yeni bir surum yayinlar; okuyucular (ekran, telemetri, web) surum
+// degismediyse kopyalamayi tamamen atlayabilir.
+// ~6 KB: stack yerine static/global tutulmali (async_tcp stack'i kucuk).
+struct VictronSnapshot {
+    uint32_t version = 0; // 0 = henuz yayin yok
+    size_t count = 0;
+    VictronData devices[VictronDeviceTable::MAX_ENTRIES]; // Sadece canli (valid) kayitlar
+    FleetTotals fleet;    // devices ile ayni anin filo ozeti
+};
+
+// Surekli taramanin durumu ve son pencerelerin kapsamasi (/api/ble-stats)
+struct VictronScanStats {
+    uint8_t level = SCAN_DEFAULT_LEVEL;
+    ScanDuty duty = {0, 0};
+    uint32_t restarts = 0;           // Tarama durdu / ayar degisti, yeniden baslatildi
+    uint8_t count = 0;               // windows[0] en yeni
+    ScanWindow windows[SCAN_STATS_HISTORY];
+};
+
+// Yayinlanmis alim istatistigi (anahtarli cihazlar, saniyede bir)
+struct VictronRxStats {
+    uint64_t mac = 0;
+    DeviceRxStats rx;
+};
+
+// "aa:bb:cc:dd:ee:ff", "AA-BB-..." veya "aabbccddeeff" -> 0xAABBCCDDEEFF
+bool parseMacAddress(const String& text, uint64_t& mac);
+// 0xAABBCCDDEEFF -> "aa:bb:cc:dd:ee:ff" (out en az 18 byte)
+void formatMacAddress(uint64_t mac, char* out);
 
 // ... existing code ...
 
 class VictronBLE : public NimBLEAdvertisedDeviceCallbacks {
+    friend struct VictronBenchAccess; // bench/bench_decode.cpp (host benchmark)
+
 private:
     NimBLEScan* pBLEScan;
-    std::map<String, VictronData> devices;
-    
-    // Cihaz MAC adresi -> AES Key (16 byte) haritası
-    std::map<String, std::vector<uint8_t>> deviceKeys;
 
-    void hexStringToBytes(String hex, uint8_t* bytes);
-    // decryptData artık MAC adresini de alıyor
-    bool decryptData(String macAddress, const uint8_t* rawData, size_t len, uint8_t* decryptedBuffer);
-    void parseDecryptedData(const uint8_t* data, size_t len, VictronData& result, uint8_t readoutType);
+    // MAC -> anahtar + canli veri. Reklam basina heap kullanmaz.
+    // Sadece loop tarafindan (update) yazilir.
+    VictronDeviceTable devices;
+    unsigned long lastExpireCheck = 0;
+
+    // NimBLE host task (onResult) -> loop (update) ham reklam kuyrugu
+    SpscRing<VictronRawAdvert, VICTRON_ADVERT_QUEUE_SIZE> advertQueue;
+
+    void processAdvert(const VictronRawAdvert& advert);
+    void recordSample(VictronDeviceEntry& entry);
+
+    // Canli (valid) kayitlarin toplamlari; kayit degisirken eski katki
+    // cikarilip yenisi eklenir (bkz. FleetAggregate.h)
+    FleetAggregate fleet;
+    static FleetContribution fleetContribution(const VictronDeviceEntry& entry);
+    void rebuildFleet();
+
+    // Cift tampon + tampon basina seqlock. Yazar pasif tampona yazar ve
+    // activeSnapshot'i cevirir; okuyucu kopyalarken o tampona yazilmaya
+    // baslanirsa seq degisir ve okuyucu tekrar dener.
+    VictronSnapshot snapshots[2];
+    std::atomic<uint32_t> snapshotSeq[2] = {{0}, {0}};
+    std::atomic<uint8_t> activeSnapshot{0};
+    std::atomic<uint32_t> snapshotVersion{0};
+    std::atomic<uint32_t> dataVersion{0}; // Decode, eskime, ayar (+ seyrek RSSI)
+    bool snapshotDirty = false;
+    bool snapshotTouched = false;        // Sadece timestamp/RSSI degisti
+    unsigned long lastSnapshotPublish = 0;
+    unsigned long lastDataVersionAt = 0;
+    void publishSnapshot();
+
+    // Surekli tarama: sonuc listesi tutulmaz, gorev orani pencere
+    // istatistiginden secilir (ScanPolicy.h). Sadece loop yazar.
+    ScanPolicy scanPolicy;
+    ScanWindow scanWindow;               // Suren pencere
+    uint32_t scanWindowDrops = 0;        // Pencere basindaki kuyruk drop sayaci
+    uint32_t scanWindowTx = 0;           // Pencere basindaki wifiTxEvents
+    std::atomic<uint32_t> wifiTxEvents{0};
+    std::atomic<uint32_t> scanRestarts{0};
+    bool scanStarted = false;
+    void startScan();
+    void closeScanWindow(unsigned long now);
+
+    // Biten pencereler, snapshot gibi cift tampon + tampon basina seqlock:
+    // async_tcp (yuksek oncelik) yazari ayni cekirdekte yarida keserse
+    // okudugu aktif tampon yazilmiyordur, beklemeden kopyalar.
+    VictronScanStats scanStats[2];
+    std::atomic<uint32_t> scanStatsSeq[2] = {{0}, {0}};
+    std::atomic<uint8_t> activeScanStats{0};
+
+    // Cihaz alim istatistiklerinin kopyasi (getRxStatsAfter), scanStats gibi
+    // cift tampon + tampon basina seqlock
+    struct RxStatsBuffer {
+        size_t count = 0;
+        VictronRxStats items[VictronDeviceTable::MAX_ENTRIES];
+    };
+    RxStatsBuffer rxStats[2];
+    std::atomic<uint32_t> rxStatsSeq[2] = {{0}, {0}};
+    std::atomic<uint8_t> activeRxStats{0};
+    void publishRxStats();
+    void noteAdvert(DeviceRxStats& rx, const VictronRawAdvert& advert);
+
+    // Tekrarlanan cercevelerde atlanan decrypt+parse sayisi
+    uint32_t decodeCount = 0;
+    uint32_t duplicateCount = 0;
+
+    bool decryptData(VictronDeviceKey& key, const uint8_t* rawData, size_t len, uint8_t* decryptedBuffer);
+    void parseDecryptedData(const uint8_t* data, size_t len, VictronData& result, uint8_t readoutType, uint16_t modelId);
+    void setError(const char* fmt, ...);
 
 public:
     VictronBLE();
     void init();
     void begin();
+    // Kuyruktaki reklamlari coz, eski kayitlari temizle, taramayi surdur.
+    // Sadece loop'tan cagrilmali (cihaz tablosunun tek yazari).
     void update();
-    // Yeni cihaz ekleme fonksiyonu
+    // Yeni cihaz ekleme fonksiyonu (ayni MAC tekrar eklenirse anahtar degisir)
     void addDevice(String mac, String keyHex);
+    // Kayitli cihazlari tabloya esitler, tarama durmaz: tabloda olmayan
+    // anahtarli cihazlar silinir, yeniler eklenir, anahtari degisenler yeni
+    // anahtara gecer. Degismeyen ve anahtari degisen cihazlarin canli verisi
+    // korunur (veri boslugu olmaz). Snapshot bir sonraki update'te tek
+    // seferde yayinlanir. Sadece loop'tan. Sigmayan cihaz varsa false.
+    bool reloadDevices(const DeviceKeyTable& table);
+    // Aku bankasi kapasitesi (Ah): filo SOC / kalan sure agirligi. Kayitli cihaz yoksa false.
+    bool setCapacity(uint64_t mac, float capacityAh);
     void simulate(); // Test için simülasyon verisi ekler
     
-    // Tüm cihazların listesini döndür
-    std::map<String, VictronData> getDevices() { return devices; }
+    // Canli cihazlarin tutarli kopyasini out'a yazar. out.version zaten
+    // guncel surumse hicbir sey kopyalanmaz ve false doner.
+    // Herhangi bir task'tan cagrilabilir.
+    bool getSnapshot(VictronSnapshot& out) const;
+    // Yayinlanmis snapshot'ta MAC'i afterMac'ten buyuk ilk cihaz (MAC sirasiyla
+    // gezinmek icin, 0'dan baslanir). Snapshot kopyalanmaz. Yoksa false.
+    // Herhangi bir task'tan cagrilabilir.
+    bool getDeviceAfter(uint64_t afterMac, VictronData& out) const;
+    uint32_t getVersion() const { return snapshotVersion.load(std::memory_order_acquire); }
+    // Olcum verisi surumu: yeni decode, eskiyen kayit, ayar degisikligi ya da
+    // VICTRON_DATA_RSSI_REFRESH_MS'de bir RSSI/zaman yenilemesiyle artar.
+    // Tekrar eden cerceve artirmaz (getVersion artar). HTTP ETag'leri icin.
+    uint32_t getDataVersion() const { return dataVersion.load(std::memory_order_acquire); }
+
+    String getLastSeenDevice() const; // Son gorulen cihaz MAC adresi (yoksa "")
+
+    // Cihazin aralik orneklerini out'a kopyalar, aralik sifirlanmaz.
+    // Ornek yoksa false. Sadece loop'tan (update ile ayni task).
+    bool peekSamples(uint64_t mac, DeviceSamples& out) const;
+    // Kayit batch'e girdikten sonra araligi sifirlar. Sadece loop'tan.
+    void resetSamples(uint64_t mac);
+
+    // Reklam kuyrugu istatistikleri
+    uint32_t getAdvertDrops() const { return advertQueue.drops(); }
+    uint32_t getAdvertHighWater() const { return advertQueue.highWater(); }
+    size_t getAdvertQueueDepth() const { return advertQueue.size(); }
+    static constexpr size_t getAdvertQueueCapacity() { return VICTRON_ADVERT_QUEUE_SIZE; }
+
+    // Cozulen ve tekrar oldugu icin atlanan cerceve sayilari
+    uint32_t getDecodeCount() const { return decodeCount; }
+    uint32_t getDuplicateCount() const { return duplicateCount; }
+
+    // WiFi gonderimi oldu (uplink, SSE, web): gorev orani buna gore sinirlanir.
+    // Herhangi bir task'tan.
+    void noteWifiTx(uint32_t events = 1) { wifiTxEvents.fetch_add(events, std::memory_order_relaxed); }
+    // Tarama ayari ve son pencereler. Herhangi bir task'tan.
+    void getScanStats(VictronScanStats& out) const;
+    // Yayinlanmis alim istatistiklerinde MAC'i afterMac'ten buyuk ilk cihaz
+    // (getDeviceAfter gibi MAC sirasiyla). Yoksa false. Herhangi bir task'tan.
+    bool getRxStatsAfter(uint64_t afterMac, VictronRxStats& out) const;
 
-    String lastSeenDevice; // Son gorulen cihaz MAC adresi
-    String lastError;      // Son hata mesaji
+    uint64_t lastSeenMac = 0; // Son gorulen Victron cihazi
+    char lastError[48] = "";  // Son hata mesaji
 
-    // NimBLE Callback
+    // NimBLE Callback: sadece filtreler ve kuyruga yazar
     void onResult(NimBLEAdvertisedDevice* advertisedDevice) override;
 };
 
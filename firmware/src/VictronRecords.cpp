@@ -0,0 +1,481 @@
+#include "VictronRecords.h"
+#include "AppLog.h"
+#include <utility>
+
+// Kayit duzenleri: Victron "Extra manufacturer data" dokumani ve
+// Fabian-Schmidt/esphome-victron_ble ile ayni. Tum alanlar little-endian
+// bit akisi; bit 0 = sifresi cozulmus verinin ilk byte'inin LSB'si.
+
+namespace {
+
+const uint32_t NO_NA = 0xFFFFFFFF; // width < 32 icin "NA degeri yok"
+
+// Tek bir alanin tanimi. Hedef ya float ya int uyedir (digeri nullptr).
+struct VictronField {
+    uint8_t bit;
+    uint8_t width;     // 1..32
+    bool isSigned;
+    float scale;
+    float offset;      // Olcekten sonra eklenir (orn. sicaklik -40)
+    uint32_t na;       // Ham "not available" degeri (NO_NA = yok)
+    float naValue;     // NA veya kayit bu alani icermeyecek kadar kisaysa
+    float VictronData::*f;
+    int VictronData::*i;
+};
+
+constexpr VictronField F(uint8_t bit, uint8_t width, float VictronData::*f, float scale = 1.0f,
+                         uint32_t na = NO_NA, float naValue = 0.0f, float offset = 0.0f) {
+    return {bit, width, false, scale, offset, na, naValue, f, nullptr};
+}
+constexpr VictronField S(uint8_t bit, uint8_t width, float VictronData::*f, float scale = 1.0f,
+                         uint32_t na = NO_NA, float naValue = 0.0f) {
+    return {bit, width, true, scale, 0.0f, na, naValue, f, nullptr};
+}
+constexpr VictronField I(uint8_t bit, uint8_t width, int VictronData::*i,
+                         uint32_t na = NO_NA, int naValue = 0) {
+    return {bit, width, false, 1.0f, 0.0f, na, (float)naValue, nullptr, i};
+}
+
+// Bit/genislik derleme zamaninda sabit: sabit sayida byte okuma + kaydirma + maske
+template <unsigned Bit, unsigned Width>
+inline uint32_t readBits(const uint8_t* data) {
+    static_assert(Width >= 1 && Width <= 32, "alan genisligi 1..32 bit");
+    constexpr unsigned first = Bit / 8;
+    constexpr unsigned shift = Bit % 8;
+    constexpr unsigned bytes = (shift + Width + 7) / 8;
+    uint64_t raw = 0;
+    for (unsigned b = 0; b < bytes; b++) raw |= (uint64_t)data[first + b] << (8 * b);
+    return (uint32_t)((raw >> shift) & ((1ULL << Width) - 1));
+}
+
+template <typename Record, size_t Index>
+inline void decodeField(const uint8_t* data, size_t len, VictronData& out) {
+    constexpr VictronField field = Record::fields[Index];
+    constexpr unsigned end = field.bit + field.width;
+    static_assert(end <= 8 * 24, "alan kayit sinirinin disinda");
+
+    uint32_t raw = readBits<field.bit, field.width>(data);
+    bool missing = len * 8 < end || raw == field.na;
+    int32_t value = (int32_t)raw;
+    if constexpr (field.isSigned) {
+        constexpr unsigned pad = 32 - field.width;
+        value = (int32_t)(raw << pad) >> pad;
+    }
+
+    if constexpr (field.f != nullptr) {
+        out.*(field.f) = missing ? field.naValue : (float)value * field.scale + field.offset;
+    } else {
+        out.*(field.i) = missing ? (int)field.naValue : (int)value;
+    }
+}
+
+template <typename Record, size_t... Index>
+inline void decodeFields(const uint8_t* data, size_t len, VictronData& out, std::index_sequence<Index...>) {
+    (decodeField<Record, Index>(data, len, out), ...);
+}
+
+// Kayit bu int uyeyi iceriyor mu (derleme zamani)
+template <typename Record>
+constexpr bool hasField(int VictronData::*member) {
+    for (const VictronField& field : Record::fields) {
+        if (field.i == member) return true;
+    }
+    return false;
+}
+
+template <typename Record>
+void decodeRecord(const uint8_t* data, size_t len, VictronData& out) {
+    constexpr size_t count = sizeof(Record::fields) / sizeof(VictronField);
+    decodeFields<Record>(data, len, out, std::make_index_sequence<count>());
+    if constexpr (hasField<Record>(&VictronData::deviceState)) {
+        out.chargeStateDesc = victronStateName(out.deviceState);
+    }
+    Record::finish(data, len, out);
+}
+
+// Kayit bu kadar uzun degilse alan okunmaz
+inline bool hasBits(size_t len, unsigned end) {
+    return len * 8 >= end;
+}
+
+// Battery Monitor ve DC Energy Meter: aux girisi tipine gore yorumlanir
+void decodeAuxInput(const uint8_t* data, size_t len, VictronData& out) {
+    if (!hasBits(len, 66)) return; // aux (48..63) + aux tipi (64..65)
+    uint32_t raw = readBits<48, 16>(data);
+    switch (out.auxInputType) {
+        case 0: // Mars aküsü voltaji (s16, 0.01V)
+            out.auxVoltage = (raw == 0x7FFF) ? 0.0f : (float)(int16_t)raw * 0.01f;
+            break;
+        case 1: // Orta nokta voltaji (u16, 0.01V)
+            out.midVoltage = (raw == 0xFFFF) ? 0.0f : (float)raw * 0.01f;
+            break;
+        case 2: // Sicaklik (u16, 0.01K)
+            out.temperature = (raw == 0xFFFF) ? -999.0f : (float)raw * 0.01f - 273.15f;
+            break;
+        default: // 3: aux giris yok
+            break;
+    }
+}
+
+void finishPowerFromBattery(VictronData& out) {
+    out.power = out.voltage * out.current;
+}
+
+// --- 0x01 Solar Charger (MPPT) ---
+struct SolarChargerRecord {
+    static constexpr VictronDeviceType type = SOLAR_CHARGER;
+    static constexpr VictronField fields[] = {
+        I(0, 8, &VictronData::deviceState),
+        I(8, 8, &VictronData::alarm),
+        S(16, 16, &VictronData::voltage, 0.01f, 0x7FFF),
+        S(32, 16, &VictronData::current, 0.1f, 0x7FFF),
+        F(48, 16, &VictronData::yieldToday, 0.01f, 0xFFFF),
+        F(64, 16, &VictronData::pvPower, 1.0f, 0xFFFF),
+        F(80, 9, &VictronData::loadCurrent, 0.1f, 0x1FF, -1.0f),
+        I(89, 1, &VictronData::loadState, NO_NA, -1), // Repo'ya ozel: yuk cikisi acik
+    };
+    static void finish(const uint8_t*, size_t, VictronData& out) {
+        // Verim: aku tarafi guc / panel gucu
+        float batteryPower = out.voltage * out.current;
+        out.efficiency = 0.0f;
+        if (out.pvPower > 0) {
+            out.efficiency = batteryPower / out.pvPower * 100.0f;
+            if (out.efficiency > 100.0f) out.efficiency = 100.0f;
+            if (out.efficiency < 0.0f) out.efficiency = 0.0f;
+        } else {
+            // Reklamda panel voltaji/akimi yok; 0W ise 0 kabul edilir
+            out.pvVoltage = 0.0f;
+            out.pvCurrent = 0.0f;
+        }
+    }
+};
+
+// --- 0x02 Battery Monitor (SmartShunt / BMV / Smart Battery Sense) ---
+struct BatteryMonitorRecord {
+    static constexpr VictronDeviceType type = BATTERY_MONITOR;
+    static constexpr VictronField fields[] = {
+        I(0, 16, &VictronData::remainingMins, 0xFFFF, -1),
+        S(16, 16, &VictronData::voltage, 0.01f, 0x7FFF),
+        I(32, 16, &VictronData::alarm),
+        I(64, 2, &VictronData::auxInputType),
+        S(66, 22, &VictronData::current, 0.001f, 0x3FFFFF),
+        F(88, 20, &VictronData::consumedAh, -0.1f, 0xFFFFF),
+        F(108, 10, &VictronData::soc, 0.1f, 0x3FF),
+    };
+    static void finish(const uint8_t* data, size_t len, VictronData& out) {
+        decodeAuxInput(data, len, out);
+        finishPowerFromBattery(out);
+        APP_LOGD("Parsed BMV: V=%.2f I=%.3f Ah=%.1f SOC=%.1f",
+                 out.voltage, out.current, out.consumedAh, out.soc);
+    }
+};
+
+// --- 0x03 Inverter (Phoenix) ---
+struct InverterRecord {
+    static constexpr VictronDeviceType type = INVERTER;
+    static constexpr VictronField fields[] = {
+        I(0, 8, &VictronData::deviceState),
+        I(8, 16, &VictronData::alarm),
+        S(24, 16, &VictronData::voltage, 0.01f, 0x7FFF),
+        F(40, 16, &VictronData::acPower, 1.0f, 0xFFFF), // VA
+        F(56, 15, &VictronData::acVoltage, 0.01f, 0x7FFF),
+        F(71, 11, &VictronData::acCurrent, 0.1f, 0x7FF),
+    };
+    static void finish(const uint8_t*, size_t, VictronData& out) {
+        out.power = out.acPower;
+    }
+};
+
+// --- 0x04 DC-DC Converter (Orion Smart) ---
+struct DcDcRecord {
+    static constexpr VictronDeviceType type = DC_DC;
+    static constexpr VictronField fields[] = {
+        I(0, 8, &VictronData::deviceState),
+        I(8, 8, &VictronData::alarm),
+        F(16, 16, &VictronData::inputVoltage, 0.01f, 0xFFFF),
+        S(32, 16, &VictronData::voltage, 0.01f, 0x7FFF),
+        I(48, 32, &VictronData::offReason, NO_NA),
+    };
+    static void finish(const uint8_t*, size_t, VictronData&) {}
+};
+
+// --- 0x05 SmartLithium ---
+struct SmartLithiumRecord {
+    static constexpr VictronDeviceType type = SMART_LITHIUM;
+    static constexpr VictronField fields[] = {
+        I(32, 16, &VictronData::alarm),
+        F(104, 12, &VictronData::voltage, 0.01f, 0xFFF),
+        I(116, 4, &VictronData::balancerStatus),
+        F(120, 7, &VictronData::temperature, 1.0f, 0x7F, -999.0f, -40.0f),
+    };
+    static void finish(const uint8_t* data, size_t len, VictronData& out) {
+        // 8 hucre x 7 bit (bit 48..103): 2.60V + raw*0.01V, 0x7F = hucre yok,
+        // 0x7E = 3.86V ustu. Sadece min/max tutulur.
+        out.minCellVoltage = 0.0f;
+        out.maxCellVoltage = 0.0f;
+        if (!hasBits(len, 104)) return;
+        uint64_t cells = 0;
+        for (int b = 0; b < 7; b++) cells |= (uint64_t)data[6 + b] << (8 * b);
+        for (int c = 0; c < 8; c++) {
+            uint8_t raw = (cells >> (7 * c)) & 0x7F;
+            if (raw == 0x7F) continue;
+            float v = 2.60f + raw * 0.01f;
+            if (out.minCellVoltage == 0.0f || v < out.minCellVoltage) out.minCellVoltage = v;
+            if (v > out.maxCellVoltage) out.maxCellVoltage = v;
+        }
+    }
+};
+
+// --- 0x06 Inverter RS ---
+struct InverterRsRecord {
+    static constexpr VictronDeviceType type = INVERTER_RS;
+    static constexpr VictronField fields[] = {
+        I(0, 8, &VictronData::deviceState),
+        I(8, 8, &VictronData::alarm),
+        S(16, 16, &VictronData::voltage, 0.01f, 0x7FFF),
+        S(32, 16, &VictronData::current, 0.1f, 0x7FFF),
+        F(48, 16, &VictronData::pvPower, 1.0f, 0xFFFF),
+        F(64, 16, &VictronData::yieldToday, 0.01f, 0xFFFF),
+        S(80, 16, &VictronData::acPower, 1.0f, 0x7FFF),
+    };
+    static void finish(const uint8_t*, size_t, VictronData& out) {
+        out.power = out.acPower;
+    }
+};
+
+// --- 0x08 AC Charger (Blue Smart / Phoenix Smart) ---
+// Uc cikisin sadece ilki tutulur; cok cikisli sarj cihazlarinda 2/3
+// cikislar genelde bos (NA) gelir.
+struct AcChargerRecord {
+    static constexpr VictronDeviceType type = AC_CHARGER;
+    static constexpr VictronField fields[] = {
+        I(0, 8, &VictronData::deviceState),
+        I(8, 8, &VictronData::alarm),
+        F(16, 13, &VictronData::voltage, 0.01f, 0x1FFF),
+        F(29, 11, &VictronData::current, 0.1f, 0x7FF),
+        F(88, 7, &VictronData::temperature, 1.0f, 0x7F, -999.0f, -40.0f),
+        F(95, 9, &VictronData::acCurrent, 0.1f, 0x1FF),
+    };
+    static void finish(const uint8_t*, size_t, VictronData& out) {
+        finishPowerFromBattery(out);
+    }
+};
+
+// --- 0x09 Smart BatteryProtect ---
+struct BatteryProtectRecord {
+    static constexpr VictronDeviceType type = BATTERY_PROTECT;
+    static constexpr VictronField fields[] = {
+        I(0, 8, &VictronData::deviceState),
+        I(8, 8, &VictronData::loadState),
+        I(24, 16, &VictronData::alarm),
+        F(56, 16, &VictronData::voltage, 0.01f, 0xFFFF),
+        F(72, 16, &VictronData::outputVoltage, 0.01f, 0xFFFF),
+        I(88, 32, &VictronData::offReason, NO_NA),
+    };
+    static void finish(const uint8_t*, size_t, VictronData&) {}
+};
+
+// --- 0x0A Lynx Smart BMS ---
+struct LynxBmsRecord {
+    static constexpr VictronDeviceType type = LYNX_BMS;
+    static constexpr VictronField fields[] = {
+        I(0, 8, &VictronData::alarm),
+        I(8, 16, &VictronData::remainingMins, 0xFFFF, -1),
+        F(24, 16, &VictronData::voltage, 0.01f, 0xFFFF),
+        S(40, 16, &VictronData::current, 0.1f, 0x7FFF),
+        F(90, 10, &VictronData::soc, 0.1f, 0x3FF),
+        F(100, 20, &VictronData::consumedAh, -0.1f, 0xFFFFF),
+        F(120, 7, &VictronData::temperature, 1.0f, 0x7F, -999.0f, -40.0f),
+    };
+    static void finish(const uint8_t*, size_t, VictronData& out) {
+        finishPowerFromBattery(out);
+    }
+};
+
+// --- 0x0B Multi RS ---
+struct MultiRsRecord {
+    static constexpr VictronDeviceType type = MULTI_RS;
+    static constexpr VictronField fields[] = {
+        I(0, 8, &VictronData::deviceState),
+        I(8, 8, &VictronData::alarm),
+        S(16, 16, &VictronData::current, 0.1f, 0x7FFF),
+        F(32, 14, &VictronData::voltage, 0.01f, 0x3FFF),
+        I(46, 2, &VictronData::activeAcIn, 3, -1),
+        S(48, 16, &VictronData::acInPower, 1.0f, 0x7FFF),
+        S(64, 16, &VictronData::acPower, 1.0f, 0x7FFF),
+        F(80, 16, &VictronData::pvPower, 1.0f, 0xFFFF),
+        F(96, 16, &VictronData::yieldToday, 0.01f, 0xFFFF),
+    };
+    static void finish(const uint8_t*, size_t, VictronData& out) {
+        out.power = out.acPower;
+    }
+};
+
+// --- 0x0C VE.Bus (MultiPlus / Quattro) ---
+struct VeBusRecord {
+    static constexpr VictronDeviceType type = VE_BUS;
+    static constexpr VictronField fields[] = {
+        I(0, 8, &VictronData::deviceState),
+        I(8, 8, &VictronData::alarm),
+        S(16, 16, &VictronData::current, 0.1f, 0x7FFF),
+        F(32, 14, &VictronData::voltage, 0.01f, 0x3FFF),
+        I(46, 2, &VictronData::activeAcIn, 3, -1),
+        S(48, 19, &VictronData::acInPower, 1.0f, 0x3FFFF),
+        S(67, 19, &VictronData::acPower, 1.0f, 0x3FFFF),
+        F(88, 7, &VictronData::temperature, 1.0f, 0x7F, -999.0f, -40.0f),
+        F(95, 7, &VictronData::soc, 1.0f, 0x7F),
+    };
+    static void finish(const uint8_t*, size_t, VictronData& out) {
+        out.power = out.acPower;
+    }
+};
+
+// --- 0x0D DC Energy Meter ---
+struct DcEnergyMeterRecord {
+    static constexpr VictronDeviceType type = DC_ENERGY_METER;
+    static constexpr VictronField fields[] = {
+        S(16, 16, &VictronData::voltage, 0.01f, 0x7FFF),
+        I(32, 16, &VictronData::alarm),
+        I(64, 2, &VictronData::auxInputType),
+        S(66, 22, &VictronData::current, 0.001f, 0x3FFFFF),
+    };
+    static void finish(const uint8_t* data, size_t len, VictronData& out) {
+        decodeAuxInput(data, len, out);
+        finishPowerFromBattery(out);
+    }
+};
+
+// --- 0x0F Orion XS ---
+struct OrionXsRecord {
+    static constexpr VictronDeviceType type = ORION_XS;
+    static constexpr VictronField fields[] = {
+        I(0, 8, &VictronData::deviceState),
+        I(8, 8, &VictronData::alarm),
+        F(16, 16, &VictronData::voltage, 0.01f, 0xFFFF),
+        F(32, 16, &VictronData::current, 0.1f, 0xFFFF),
+        F(48, 16, &VictronData::inputVoltage, 0.01f, 0xFFFF),
+        F(64, 16, &VictronData::inputCurrent, 0.1f, 0xFFFF),
+        I(80, 32, &VictronData::offReason, NO_NA),
+    };
+    static void finish(const uint8_t*, size_t, VictronData& out) {
+        finishPowerFromBattery(out);
+    }
+};
+
+// --- Readout type -> cozucu ---
+typedef void (*RecordDecoder)(const uint8_t* data, size_t len, VictronData& out);
+
+struct RecordType {
+    RecordDecoder decode;
+    VictronDeviceType type;
+};
+
+template <typename Record>
+constexpr RecordType recordType() {
+    return {&decodeRecord<Record>, Record::type};
+}
+
+// Indeks = readout type. Bos satirlar (0x00, 0x07, 0x0E) bilinmeyen tip.
+constexpr RecordType RECORD_TYPES[] = {
+    {nullptr, UNKNOWN},                  // 0x00 Test kaydi
+    recordType<SolarChargerRecord>(),    // 0x01
+    recordType<BatteryMonitorRecord>(),  // 0x02
+    recordType<InverterRecord>(),        // 0x03
+    recordType<DcDcRecord>(),            // 0x04
+    recordType<SmartLithiumRecord>(),    // 0x05
+    recordType<InverterRsRecord>(),      // 0x06
+    {nullptr, UNKNOWN},                  // 0x07 GX-Device (kullanilmiyor)
+    recordType<AcChargerRecord>(),       // 0x08
+    recordType<BatteryProtectRecord>(),  // 0x09
+    recordType<LynxBmsRecord>(),         // 0x0A
+    recordType<MultiRsRecord>(),         // 0x0B
+    recordType<VeBusRecord>(),           // 0x0C
+    recordType<DcEnergyMeterRecord>(),   // 0x0D
+    {nullptr, UNKNOWN},                  // 0x0E
+    recordType<OrionXsRecord>(),         // 0x0F
+};
+constexpr size_t RECORD_TYPE_COUNT = sizeof(RECORD_TYPES) / sizeof(RECORD_TYPES[0]);
+
+// --- Urun ID tablosu ---
+// type != UNKNOWN ise kayit tipinin cihaz tipini ezer (Smart Battery Sense
+// Battery Monitor kaydi gonderir ama aku monitoru degildir). Liste tam
+// degil: tabloda olmayan urunler kayit tipine gore yine dogru cozulur.
+struct VictronProduct {
+    uint16_t first;
+    uint16_t last;
+    VictronDeviceType type;
+    const char* name;
+};
+
+constexpr VictronProduct PRODUCTS[] = {
+    {0x0203, 0x0205, UNKNOWN, "BMV-70x"},
+    {0x0300, 0x03FF, UNKNOWN, "BlueSolar MPPT"},
+    {0x2600, 0x27FF, UNKNOWN, "MultiPlus/Quattro"},
+    {0xA040, 0xA07F, UNKNOWN, "SmartSolar MPPT"},
+    {0xA230, 0xA2FF, UNKNOWN, "Phoenix Inverter"},
+    {0xA330, 0xA34F, UNKNOWN, "Blue Smart Charger"},
+    {0xA381, 0xA383, UNKNOWN, "BMV-71x Smart"},
+    {0xA389, 0xA38B, UNKNOWN, "SmartShunt"},
+    {0xA3A4, 0xA3A5, SMART_BATTERY_SENSE, "Smart Battery Sense"},
+    {0xA3C0, 0xA3DF, UNKNOWN, "Orion Smart"},
+    {0xA3F0, 0xA3FF, UNKNOWN, "Orion XS"},
+};
+
+constexpr bool productsSorted() {
+    for (size_t i = 1; i < sizeof(PRODUCTS) / sizeof(PRODUCTS[0]); i++) {
+        if (PRODUCTS[i].first <= PRODUCTS[i - 1].last) return false;
+    }
+    return true;
+}
+static_assert(productsSorted(), "PRODUCTS artan ID sirasinda ve cakismasiz olmali");
+
+const VictronProduct* findProduct(uint16_t modelId) {
+    for (const VictronProduct& p : PRODUCTS) {
+        if (modelId < p.first) return nullptr;
+        if (modelId <= p.last) return &p;
+    }
+    return nullptr;
+}
+
+} // namespace
+
+bool victronDecodeRecord(uint8_t readoutType, uint16_t modelId, const uint8_t* data, size_t len, VictronData& out) {
+    out.modelId = modelId;
+    const RecordType* record = readoutType < RECORD_TYPE_COUNT ? &RECORD_TYPES[readoutType] : nullptr;
+    if (record == nullptr || record->decode == nullptr) {
+        out.type = UNKNOWN;
+        return false;
+    }
+
+    record->decode(data, len, out);
+
+    const VictronProduct* product = findProduct(modelId);
+    out.type = (product != nullptr && product->type != UNKNOWN) ? product->type : record->type;
+    return true;
+}
+
+const char* victronProductName(uint16_t modelId) {
+    const VictronProduct* product = findProduct(modelId);
+    return product != nullptr ? product->name : "";
+}
+
+const char* victronStateName(int state) {
+    switch (state) {
+        case 0: return "Off";
+        case 1: return "Low Power";
+        case 2: return "Fault";
+        case 3: return "Bulk";
+        case 4: return "Absorption";
+        case 5: return "Float";
+        case 6: return "Storage";
+        case 7: return "Equalize";
+        case 9: return "Inverting";
+        case 11: return "Power Supply";
+        case 245: return "WakeUp";
+        case 246: return "Repeated Absorption";
+        case 247: return "Auto Equalize";
+        case 248: return "BatterySafe";
+        case 252: return "Ext.Control";
+        default: return "Unknown";
+    }
+}
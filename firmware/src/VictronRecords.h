@@ -0,0 +1,28 @@
+#ifndef VICTRON_RECORDS_H
+#define VICTRON_RECORDS_H
+
+#include "VictronBLE.h"
+
+// Victron "Instant Readout" kayit cozucu.
+//
+// Her kayit tipi (0x01 Solar Charger, 0x02 Battery Monitor, ...) VictronRecords.cpp
+// icinde bir alan tablosu olarak tanimlidir: bit ofseti, bit genisligi, isaret,
+// olcek, ofset ve "not available" degeri. Tablolar derleme zamaninda sabit
+// kaydirma/maske kodlarina acilir; yeni cihaz tipi icin yeni if/else dali
+// degil, yeni bir tablo eklenir.
+//
+// Kayit tipi reklam basligindaki readout type'tan secilir. Ayni kayit
+// yapisini kullanan ama farkli cihaz olan urunler (orn. Smart Battery Sense,
+// Battery Monitor kaydi gonderir) urun ID tablosuyla ayrilir.
+
+// Sifresi cozulmus kaydi out'a yazar. Bilinmeyen kayit tipinde out.type
+// UNKNOWN olur ve false doner.
+bool victronDecodeRecord(uint8_t readoutType, uint16_t modelId, const uint8_t* data, size_t len, VictronData& out);
+
+// Urun ID -> urun adi ("SmartShunt 500A/50mV" gibi); tabloda yoksa ""
+const char* victronProductName(uint16_t modelId);
+
+// VE.Direct cihaz durumu kodu -> kisa aciklama (Bulk, Float, Inverting...)
+const char* victronStateName(int state);
+
+#endif
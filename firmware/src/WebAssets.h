@@ -0,0 +1,396 @@
+// Bu dosya scripts/embed_web.py tarafindan web/ klasorunden uretilir, elle duzenlemeyin.
+// 2 dosya: 17154 byte -> gzip 5792 byte
+
+#ifndef WEB_ASSETS_H
+#define WEB_ASSETS_H
+
+#include <Arduino.h>
+
+struct WebAsset {
+    const char* path;         // Yayin adresi
+    const char* contentType;
+    const uint8_t* data;      // gzip
+    size_t length;
+    const char* etag;         // Icerik ozeti (tirnakli)
+    bool immutable;           // Ozetli ad: uzun sureli onbellek
+};
+
+// settings.js -> /settings.0a012e8d.js (6795 -> 2468 byte)
+static const uint8_t web_settings_js_gz[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0x59, 0x4b, 0x73, 0xdb, 0xc8,
+    0x11, 0xbe, 0xeb, 0x57, 0xb4, 0x69, 0x67, 0x09, 0x96, 0x45, 0x90, 0x92, 0x5f, 0x6b, 0x50, 0xd4,
+    0x96, 0xbc, 0xf6, 0x7a, 0xbd, 0x5e, 0xef, 0x6e, 0x95, 0x5c, 0x71, 0xa5, 0x52, 0xa9, 0x78, 0x08,
+    0x0c, 0x89, 0x59, 0x00, 0x03, 0x66, 0x30, 0xa0, 0x04, 0x79, 0x75, 0xcb, 0x4f, 0x48, 0xe5, 0x18,
+    0x1d, 0x7d, 0x8d, 0x2e, 0x7b, 0xd2, 0x8d, 0xf4, 0xff, 0xc9, 0x4f, 0x48, 0xf7, 0x0c, 0x40, 0x02,
+    0xa4, 0x44, 0xdb, 0x71, 0x45, 0xae, 0x92, 0x31, 0xaf, 0x9e, 0x7e, 0x7c, 0xfd, 0x1a, 0xf5, 0x7a,
+    0x70, 0x54, 0x30, 0x15, 0x33, 0x05, 0x19, 0x8f, 0x12, 0x9e, 0x09, 0x0f, 0x84, 0x0c, 0xf8, 0xa9,
+    0x1b, 0xea, 0x24, 0x06, 0x11, 0x47, 0xc0, 0xe6, 0xef, 0x17, 0x97, 0xf1, 0xe2, 0xf2, 0xc3, 0x85,
+    0x66, 0x30, 0xca, 0x21, 0x48, 0xb3, 0x82, 0x15, 0x8b, 0x4b, 0x28, 0xe6, 0x57, 0x51, 0xcc, 0x15,
+    0x38, 0x71, 0xca, 0x82, 0x63, 0xae, 0xb5, 0x90, 0x93, 0xec, 0x28, 0xcb, 0xb8, 0xee, 0xb8, 0x3b,
+    0xbd, 0x1e, 0x7c, 0x97, 0xaa, 0x04, 0x6e, 0x67, 0xe5, 0x02, 0x88, 0xf9, 0x7b, 0x21, 0x39, 0x14,
+    0xec, 0xcc, 0x90, 0x53, 0x03, 0x18, 0xa7, 0x32, 0xca, 0x44, 0x91, 0x4a, 0xba, 0x7e, 0x8c, 0xbb,
+    0x73, 0x09, 0xa9, 0xf4, 0x63, 0xe1, 0x47, 0xbd, 0x54, 0x66, 0xf9, 0x28, 0x11, 0xba, 0x4d, 0xdc,
+    0x48, 0x98, 0xbf, 0x67, 0x8b, 0x0b, 0x65, 0x0f, 0xba, 0x3b, 0x3b, 0x41, 0xea, 0xe7, 0x09, 0x97,
+    0xda, 0x9d, 0x70, 0xfd, 0x2c, 0xe6, 0xf4, 0xf9, 0xa4, 0x78, 0x11, 0x38, 0xed, 0xea, 0xb6, 0x76,
+    0xc7, 0x15, 0x52, 0x72, 0xf5, 0xfd, 0xeb, 0x57, 0x3f, 0xc2, 0x10, 0xde, 0xee, 0x00, 0x1c, 0x04,
+    0x62, 0x06, 0x7e, 0xcc, 0xb2, 0x6c, 0xd8, 0x0a, 0xf8, 0x4c, 0xf8, 0xbc, 0xeb, 0x33, 0x15, 0xb4,
+    0x0e, 0x71, 0x0d, 0x57, 0xc3, 0x7d, 0xc8, 0x74, 0x11, 0xf3, 0x61, 0x2b, 0x61, 0x6a, 0x22, 0x64,
+    0x57, 0xa7, 0x53, 0xaf, 0x6f, 0x98, 0xd4, 0xdd, 0x4c, 0x9c, 0x71, 0x6f, 0xcf, 0xdd, 0x57, 0x3c,
+    0x19, 0xb4, 0x0e, 0x5f, 0xe6, 0x2a, 0x8f, 0xf3, 0xa4, 0xd2, 0xdc, 0xe2, 0xf2, 0xa0, 0x17, 0xee,
+    0x97, 0x64, 0x48, 0x0c, 0x10, 0xc1, 0xb0, 0x55, 0x71, 0x42, 0x5a, 0x68, 0x01, 0xf3, 0xb5, 0x48,
+    0xe5, 0xb0, 0xd5, 0xcb, 0xd8, 0x8c, 0xb7, 0x20, 0xe1, 0x3a, 0x4c, 0x71, 0xd3, 0x2f, 0x3f, 0x1f,
+    0xbf, 0x6e, 0x41, 0x25, 0xeb, 0xb0, 0xa5, 0xb8, 0xce, 0x95, 0x04, 0x3b, 0xa4, 0x93, 0x0e, 0x9f,
+    0xa1, 0x6c, 0x9d, 0x92, 0xc9, 0xa6, 0x10, 0x74, 0x55, 0x77, 0xa2, 0xd2, 0x7c, 0xba, 0x5c, 0xc6,
+    0x0d, 0x31, 0x1b, 0xf1, 0x98, 0xb4, 0x89, 0x2c, 0x64, 0x02, 0xc5, 0x7b, 0x23, 0xbe, 0x13, 0x70,
+    0x14, 0xa0, 0xc1, 0x9c, 0xe3, 0xe3, 0x17, 0x4f, 0x3b, 0x70, 0x30, 0xca, 0xb5, 0x4e, 0x25, 0xe8,
+    0x62, 0x8a, 0xd2, 0xda, 0x41, 0xab, 0x52, 0x3c, 0x9e, 0xf2, 0x99, 0x7c, 0x23, 0xc6, 0xc2, 0xe9,
+    0xb4, 0x2a, 0x8d, 0x8c, 0xd1, 0xc2, 0xda, 0x53, 0x62, 0x12, 0xea, 0x01, 0x8c, 0x98, 0x1f, 0xd1,
+    0xad, 0x32, 0xf0, 0x64, 0x2a, 0x39, 0x4e, 0xa4, 0x2a, 0xe0, 0xaa, 0x1c, 0xf8, 0x69, 0x9c, 0x2a,
+    0x6f, 0xc6, 0x94, 0xd3, 0xed, 0x4e, 0x95, 0x40, 0x5d, 0x16, 0x1d, 0x9c, 0xcd, 0x55, 0x86, 0xd3,
+    0xd3, 0x54, 0x48, 0xcd, 0x55, 0x5d, 0xa9, 0x7d, 0xf7, 0x6b, 0xab, 0xd4, 0xa3, 0xc5, 0x85, 0xd1,
+    0x25, 0xbc, 0x66, 0x8a, 0xc1, 0x7f, 0x2e, 0xfe, 0xf1, 0xf7, 0x83, 0x9e, 0xe5, 0xed, 0xf0, 0xa0,
+    0x67, 0x84, 0xaa, 0x09, 0x49, 0x5a, 0x28, 0x79, 0x0b, 0x44, 0x36, 0x8d, 0x59, 0xe1, 0x8d, 0x63,
+    0x7e, 0x3a, 0x80, 0x09, 0x43, 0xa3, 0xb9, 0x0f, 0x2c, 0xc9, 0xe5, 0x7e, 0x73, 0x26, 0xe3, 0x31,
+    0xf7, 0xb5, 0xb5, 0x0d, 0x2a, 0xe6, 0xaf, 0x76, 0x6c, 0x04, 0x0f, 0x99, 0x9c, 0x10, 0xa9, 0x1b,
+    0x51, 0x85, 0xfb, 0x11, 0x51, 0x33, 0x16, 0xe7, 0x1c, 0xd1, 0xa4, 0x43, 0x91, 0xd9, 0xc1, 0x52,
+    0x43, 0x27, 0x22, 0xd0, 0xa1, 0xf7, 0xa0, 0xff, 0x87, 0x01, 0x4c, 0x59, 0x10, 0xa0, 0xe1, 0x91,
+    0x8d, 0x47, 0x86, 0x8f, 0x4a, 0x3f, 0x7b, 0xd3, 0x53, 0xc8, 0xd2, 0x58, 0x04, 0x70, 0x3b, 0xd8,
+    0x0b, 0x1e, 0x04, 0xa3, 0x6a, 0xa5, 0xab, 0x58, 0x20, 0xf2, 0xcc, 0x7b, 0x38, 0x3d, 0x6d, 0x68,
+    0xf7, 0x24, 0x14, 0x9a, 0xaf, 0x8b, 0x61, 0x44, 0x49, 0xa7, 0x84, 0x26, 0x30, 0x2c, 0x0c, 0x5b,
+    0x46, 0x77, 0xe8, 0xbe, 0xe4, 0x5f, 0xae, 0xeb, 0x1e, 0xf4, 0xec, 0xf2, 0x9a, 0xf8, 0x3d, 0x2b,
+    0xef, 0xda, 0xac, 0x90, 0xd3, 0x5c, 0x97, 0x48, 0xd0, 0xfc, 0x14, 0xd5, 0x51, 0xe9, 0xa7, 0x05,
+    0x92, 0x25, 0xbc, 0xfa, 0x46, 0x15, 0xfb, 0x3c, 0x4c, 0x63, 0x64, 0x77, 0xd8, 0x9a, 0xf1, 0x82,
+    0x22, 0x81, 0x62, 0xf8, 0x9f, 0x71, 0x67, 0x84, 0x8f, 0xe2, 0x7f, 0xcb, 0x85, 0xe2, 0xc1, 0xa6,
+    0x42, 0xea, 0xe0, 0xec, 0xa1, 0xe1, 0x96, 0x50, 0x6e, 0x0c, 0x3e, 0x07, 0xd7, 0x53, 0xdc, 0x56,
+    0xe2, 0xfa, 0xc3, 0xbf, 0xc4, 0x58, 0x61, 0xd4, 0xda, 0x84, 0x48, 0x5d, 0x32, 0x3a, 0x70, 0x82,
+    0xba, 0xb6, 0xd2, 0x99, 0xe3, 0xa5, 0x74, 0xf6, 0xbb, 0x21, 0x5d, 0x83, 0x6e, 0xeb, 0xcb, 0xb9,
+    0x1d, 0xa1, 0xef, 0xbc, 0x40, 0x3f, 0xfc, 0x56, 0x84, 0xec, 0x6c, 0x49, 0x18, 0x9c, 0xa7, 0x26,
+    0x06, 0xc1, 0x2f, 0x2f, 0x7e, 0xea, 0x6c, 0xe7, 0x7e, 0x65, 0x97, 0x92, 0x54, 0xc9, 0x7b, 0x35,
+    0x6a, 0x70, 0x3f, 0xff, 0xa7, 0x92, 0x1e, 0x3c, 0x3c, 0x7a, 0xfc, 0xa4, 0xfb, 0x72, 0x7f, 0x65,
+    0x96, 0x1a, 0xe9, 0x2c, 0x61, 0x71, 0x5c, 0x99, 0xc9, 0xba, 0xeb, 0xed, 0x87, 0xa3, 0x47, 0xfb,
+    0x5f, 0x63, 0xb0, 0xab, 0x9c, 0x69, 0x14, 0xa7, 0x7e, 0x34, 0x80, 0x7a, 0x24, 0x74, 0xf7, 0x4b,
+    0xaf, 0x7a, 0xc3, 0x47, 0x88, 0x71, 0xc9, 0x63, 0x1b, 0x99, 0x59, 0x8c, 0xa1, 0x65, 0x71, 0x81,
+    0x20, 0x58, 0x5c, 0x9e, 0x41, 0xb4, 0xb8, 0xcc, 0x18, 0xc9, 0x04, 0x51, 0x1a, 0xe4, 0x32, 0x87,
+    0x89, 0x50, 0x88, 0x4a, 0x44, 0x1f, 0xdd, 0xfa, 0xe5, 0xca, 0xcc, 0xa7, 0x78, 0x6d, 0x44, 0x91,
+    0x91, 0xe9, 0xd6, 0xe1, 0x1f, 0xb9, 0x12, 0xf0, 0x7c, 0xfe, 0x3b, 0x32, 0x82, 0xa1, 0x06, 0xec,
+    0x34, 0x85, 0xe3, 0x75, 0x75, 0xd6, 0x7c, 0xbf, 0x41, 0xa1, 0xd4, 0x64, 0x73, 0xae, 0x81, 0xe0,
+    0xbd, 0xfe, 0xff, 0xdf, 0xa7, 0xd7, 0xfc, 0xb9, 0xdf, 0x3a, 0xfc, 0xe1, 0xf8, 0xe7, 0x9f, 0xc0,
+    0xc1, 0x28, 0x9a, 0x51, 0xa6, 0x8d, 0x99, 0xec, 0xdc, 0xe0, 0xd5, 0xcd, 0x93, 0x7b, 0xe5, 0xc9,
+    0xbb, 0xf0, 0x94, 0x8f, 0x63, 0xa6, 0x39, 0x38, 0xd9, 0xe2, 0x32, 0x32, 0xb9, 0x1b, 0x13, 0x27,
+    0x52, 0x4a, 0xe8, 0xfb, 0xd3, 0x88, 0xed, 0x63, 0xa2, 0x4b, 0x93, 0x29, 0x8b, 0x34, 0x2c, 0xfe,
+    0x1d, 0x89, 0x18, 0x21, 0x4b, 0xe6, 0x3e, 0x83, 0x19, 0x2a, 0xfb, 0x1a, 0x12, 0x9b, 0x11, 0xe6,
+    0x8b, 0xa1, 0xf6, 0x32, 0xd5, 0x0c, 0x33, 0x3e, 0xdc, 0x7f, 0x8e, 0x3a, 0xa4, 0xfc, 0x20, 0x35,
+    0x69, 0x43, 0x05, 0x0c, 0xae, 0x93, 0x0b, 0x4c, 0x60, 0x12, 0x86, 0xd7, 0xb1, 0x31, 0xa6, 0xe1,
+    0x15, 0xa2, 0x3c, 0xc6, 0xa3, 0x8b, 0xcb, 0xc4, 0x80, 0x14, 0x45, 0x60, 0x31, 0x1d, 0x73, 0xe1,
+    0x18, 0x11, 0xea, 0xe7, 0x48, 0x0d, 0x6d, 0xcb, 0x33, 0xdd, 0xf5, 0x49, 0x5e, 0xc4, 0xc9, 0xb2,
+    0x30, 0xc9, 0xf1, 0x2c, 0xe5, 0x7a, 0x48, 0xe3, 0x84, 0x38, 0xb9, 0x01, 0xc8, 0xd5, 0x28, 0x54,
+    0x95, 0xb0, 0x25, 0x3e, 0xfa, 0x4b, 0x3c, 0x90, 0x60, 0x35, 0xb4, 0xf0, 0x07, 0xfc, 0x11, 0x1f,
+    0x55, 0x62, 0x7b, 0xb0, 0x67, 0x72, 0x16, 0xf4, 0x09, 0x1a, 0x4b, 0x6a, 0xf7, 0x96, 0xf9, 0x77,
+    0x55, 0x83, 0x18, 0xf4, 0x95, 0xca, 0x1a, 0xa5, 0x98, 0x1e, 0x93, 0x55, 0xbe, 0xb3, 0x11, 0xe6,
+    0x47, 0x91, 0x69, 0x13, 0x11, 0xc3, 0x7b, 0x0d, 0x17, 0x23, 0xf0, 0x23, 0x8c, 0x79, 0x60, 0x03,
+    0x4f, 0x46, 0xfb, 0x5a, 0x6b, 0x35, 0x4f, 0x49, 0x11, 0xf6, 0xd6, 0x13, 0xe8, 0xc1, 0xad, 0x6e,
+    0x17, 0x9e, 0x61, 0xb9, 0x27, 0x11, 0x03, 0x3e, 0xdd, 0x43, 0x35, 0x5b, 0x99, 0x03, 0x26, 0x64,
+    0x77, 0x1e, 0x41, 0xb7, 0x7b, 0x83, 0x5e, 0x36, 0x2b, 0x2f, 0x13, 0xdf, 0x36, 0x3d, 0x3d, 0xbc,
+    0xdf, 0x64, 0xc8, 0xeb, 0x03, 0xfe, 0xab, 0x74, 0xd3, 0x28, 0x1b, 0x1e, 0x5b, 0x16, 0xff, 0xc4,
+    0xa5, 0x00, 0x2b, 0x38, 0xb1, 0x87, 0x52, 0xdf, 0x5f, 0xab, 0x13, 0xb6, 0x85, 0x96, 0x55, 0x78,
+    0x39, 0x7c, 0x75, 0xf4, 0x2d, 0x56, 0x49, 0xd7, 0xe6, 0x92, 0x2d, 0x11, 0x59, 0xf2, 0x93, 0x57,
+    0xcc, 0x5f, 0x8b, 0xc1, 0x8c, 0x79, 0xa3, 0x91, 0xe7, 0xfb, 0x5e, 0x10, 0x78, 0x9c, 0x7b, 0xe3,
+    0xf1, 0x4d, 0x29, 0xf0, 0xf3, 0x38, 0x7c, 0x26, 0x7d, 0x55, 0x58, 0x17, 0x7d, 0xc9, 0x8b, 0xcf,
+    0xe4, 0x12, 0x4f, 0xac, 0x71, 0x79, 0x6f, 0x1f, 0x22, 0x2c, 0xb5, 0x22, 0x2c, 0xc8, 0x62, 0x11,
+    0x41, 0xc8, 0x4f, 0x81, 0x49, 0x16, 0x6a, 0xa6, 0xb6, 0xb0, 0x7b, 0x6d, 0xe9, 0x58, 0xf2, 0x3f,
+    0xd2, 0xb2, 0x9b, 0x71, 0x3f, 0x95, 0x01, 0x16, 0x7d, 0xb5, 0x82, 0x12, 0x41, 0x67, 0x21, 0x87,
+    0x15, 0xe5, 0xa1, 0x41, 0x67, 0xc1, 0x4b, 0x63, 0x95, 0x05, 0xde, 0xf5, 0xa8, 0x21, 0xc8, 0x3d,
+    0x17, 0x67, 0xe8, 0xcc, 0x46, 0x2a, 0x0f, 0x4c, 0x6c, 0xcb, 0x34, 0x26, 0x94, 0x09, 0x3a, 0x24,
+    0xf1, 0xbe, 0x84, 0x22, 0xba, 0xb5, 0xce, 0x35, 0xf3, 0x59, 0x03, 0x85, 0x75, 0x6d, 0x84, 0x02,
+    0xb1, 0x2f, 0xad, 0x3e, 0x2c, 0x08, 0xb3, 0x1f, 0x32, 0xe2, 0xde, 0xa6, 0x80, 0x72, 0xaa, 0xe6,
+    0x7e, 0x0d, 0x51, 0x6d, 0x45, 0xbe, 0x14, 0x95, 0xaa, 0xf8, 0x2e, 0xca, 0x8b, 0x21, 0x8a, 0x15,
+    0x01, 0xd7, 0x4d, 0x49, 0x0e, 0x7a, 0x64, 0x4a, 0xfa, 0x2e, 0x25, 0x7a, 0x3b, 0xd8, 0xd9, 0x89,
+    0xb9, 0x86, 0xf2, 0x12, 0x2c, 0x21, 0xff, 0xfc, 0x17, 0x9c, 0xc2, 0x1e, 0xc9, 0x46, 0x20, 0xc0,
+    0x14, 0x86, 0xb6, 0x8c, 0x39, 0x1a, 0x43, 0xa2, 0x25, 0x12, 0x72, 0x32, 0x3e, 0x63, 0x53, 0x13,
+    0xbf, 0xb0, 0x5e, 0x46, 0xa3, 0xb0, 0x04, 0x83, 0xde, 0xfc, 0x4a, 0xcd, 0xaf, 0x8a, 0x14, 0xd3,
+    0x02, 0x8c, 0x30, 0x91, 0x60, 0x3b, 0x15, 0x31, 0xd4, 0x36, 0x68, 0x1e, 0x29, 0x6a, 0xe1, 0x52,
+    0x0a, 0x56, 0xca, 0xdc, 0x45, 0x65, 0xfc, 0x6b, 0x91, 0x60, 0x7f, 0x36, 0x04, 0x89, 0x01, 0x70,
+    0xb0, 0x33, 0xce, 0xa5, 0xe9, 0x42, 0x60, 0x59, 0xe1, 0x2b, 0x4e, 0xb5, 0x48, 0x48, 0x25, 0xad,
+    0xca, 0xf9, 0x2e, 0x30, 0xad, 0x79, 0x32, 0xd5, 0x38, 0xee, 0x77, 0xe0, 0x9d, 0x91, 0x05, 0xcd,
+    0x99, 0x21, 0x31, 0x9b, 0x3f, 0x87, 0xb0, 0xb5, 0x44, 0x2e, 0x4b, 0xea, 0x76, 0x67, 0x60, 0x8e,
+    0x8a, 0x31, 0x38, 0x4b, 0x8a, 0xc3, 0x1a, 0x4d, 0x43, 0x37, 0xe6, 0x4c, 0x11, 0x7f, 0x69, 0xae,
+    0x9d, 0x25, 0xaf, 0xe5, 0x49, 0xfa, 0xb1, 0xb4, 0x1a, 0x5d, 0x5c, 0x7b, 0xa3, 0xf0, 0xa5, 0x5e,
+    0x01, 0x43, 0x3a, 0x6a, 0xa4, 0x5e, 0xf8, 0xb6, 0x2d, 0x95, 0x73, 0xf3, 0x7b, 0xcc, 0xb5, 0x1f,
+    0x3a, 0xed, 0x1e, 0x9b, 0x8a, 0xde, 0x09, 0x0a, 0xdd, 0xa5, 0xcb, 0xda, 0x98, 0x22, 0x97, 0xd2,
+    0x7f, 0xf5, 0x15, 0x34, 0xd8, 0x84, 0x6f, 0xa0, 0xfd, 0x4d, 0xb9, 0x38, 0xdc, 0x6b, 0x83, 0x07,
+    0xed, 0x76, 0xa7, 0x63, 0x88, 0xb9, 0x3a, 0xe4, 0x12, 0x0f, 0xa2, 0x09, 0x0f, 0xb1, 0xb6, 0xca,
+    0xdc, 0x5f, 0x11, 0x42, 0x4e, 0x63, 0x31, 0x60, 0xd8, 0x26, 0xe3, 0xea, 0x4a, 0x54, 0xd2, 0x03,
+    0xcd, 0xba, 0x74, 0xb3, 0x24, 0xf0, 0xd6, 0x6e, 0x3c, 0x80, 0xbd, 0x07, 0x75, 0xbd, 0x18, 0xd1,
+    0x6b, 0xa6, 0xc3, 0x36, 0xb2, 0xd2, 0x92, 0xd3, 0x21, 0xba, 0x4b, 0xe3, 0x8d, 0x59, 0x9c, 0xd5,
+    0x6c, 0x76, 0x17, 0xf6, 0x3a, 0xbb, 0x80, 0xe5, 0x4a, 0xbf, 0xa6, 0xc4, 0xc6, 0xf5, 0x92, 0x6b,
+    0x2c, 0x82, 0xa3, 0xcc, 0xc5, 0x28, 0x3e, 0xd1, 0x61, 0x65, 0x13, 0xdb, 0x73, 0xae, 0xce, 0x9c,
+    0xd7, 0x18, 0xdf, 0x7a, 0x70, 0x8d, 0xe9, 0x4f, 0xb1, 0x17, 0x35, 0x2a, 0x23, 0x84, 0x28, 0xfa,
+    0x1c, 0x0b, 0xa8, 0x50, 0x6b, 0x5a, 0xac, 0xfa, 0xd9, 0x64, 0x69, 0xf9, 0x89, 0x3e, 0x63, 0x3b,
+    0x45, 0xa0, 0x66, 0xb6, 0xcd, 0x61, 0x32, 0xff, 0x5d, 0x71, 0x72, 0x00, 0x11, 0xef, 0xe2, 0xe0,
+    0x6a, 0xfe, 0x3e, 0x9e, 0x5f, 0x51, 0x61, 0x7a, 0x46, 0xa5, 0xd3, 0xd8, 0x54, 0x0a, 0xca, 0x54,
+    0x11, 0x98, 0xa6, 0x84, 0x5a, 0x01, 0xd0, 0x00, 0x1b, 0x1b, 0x53, 0x85, 0x18, 0x36, 0x8a, 0x36,
+    0xfc, 0x1b, 0x56, 0x57, 0x37, 0x93, 0x27, 0x99, 0x97, 0x90, 0x9b, 0xa4, 0xd9, 0x6c, 0xbb, 0x6a,
+    0xb2, 0x34, 0xb5, 0x87, 0x41, 0xe1, 0x19, 0x43, 0x2c, 0xe2, 0x44, 0x13, 0x20, 0xf4, 0x63, 0x2e,
+    0xb9, 0x3b, 0x84, 0xb7, 0x6b, 0xb7, 0xdc, 0x79, 0x87, 0xdb, 0x5d, 0xf2, 0xae, 0xf3, 0xd6, 0x61,
+    0x6d, 0x00, 0x8e, 0x1d, 0x28, 0x1c, 0x9d, 0x43, 0xf0, 0x24, 0xd9, 0x85, 0x97, 0x76, 0x86, 0xba,
+    0x59, 0xac, 0xce, 0xcf, 0x57, 0x25, 0xda, 0xdb, 0x9a, 0x26, 0xb7, 0x7b, 0x18, 0x71, 0xb1, 0xb1,
+    0xa1, 0x6a, 0x7b, 0x4b, 0x5d, 0x95, 0xce, 0x55, 0x62, 0xde, 0x67, 0xe4, 0x5e, 0x5c, 0xa9, 0xa6,
+    0x48, 0xa4, 0xdd, 0x34, 0xe6, 0x2e, 0x2e, 0xa4, 0xca, 0x69, 0x9b, 0x9e, 0xaa, 0x0c, 0x62, 0x21,
+    0x2a, 0x05, 0x6d, 0xe2, 0xb5, 0x77, 0x01, 0x57, 0xff, 0x17, 0x8f, 0x47, 0x22, 0x23, 0xf6, 0xe1,
+    0x82, 0xa2, 0x3e, 0x12, 0x3a, 0xdb, 0xf0, 0x7b, 0xa4, 0x89, 0x88, 0x59, 0x86, 0xbb, 0xfa, 0xf3,
+    0x94, 0x53, 0xc1, 0xb6, 0x1e, 0x16, 0x90, 0xd9, 0xb1, 0x98, 0xb4, 0xbf, 0xc0, 0xc5, 0x3f, 0xf5,
+    0xe5, 0xc0, 0x86, 0x01, 0x9c, 0x83, 0xdf, 0x7e, 0xc3, 0xa8, 0x32, 0xf8, 0x38, 0x01, 0xdb, 0xe4,
+    0xad, 0x93, 0xb0, 0xb3, 0x9f, 0x4c, 0xa4, 0xde, 0xdf, 0xd4, 0x48, 0x1d, 0x9b, 0x54, 0x6a, 0x7d,
+    0xbc, 0xbe, 0x85, 0xe8, 0xd6, 0xa3, 0xc8, 0x2a, 0x6d, 0x99, 0xad, 0xd5, 0x10, 0x77, 0x51, 0x1a,
+    0x5b, 0x39, 0x2d, 0xb5, 0x61, 0x36, 0xd3, 0x53, 0x96, 0x77, 0xea, 0xa6, 0x6d, 0x04, 0xad, 0xce,
+    0x80, 0xdc, 0xf8, 0x98, 0x15, 0xe8, 0x9d, 0xd5, 0xeb, 0xa2, 0xf4, 0x99, 0xb7, 0x4a, 0x83, 0xc0,
+    0xb3, 0x48, 0x14, 0x19, 0x37, 0x98, 0xc1, 0x00, 0xaf, 0x6e, 0xc6, 0xdc, 0x1a, 0xd2, 0xe8, 0x4d,
+    0x0e, 0xd2, 0x28, 0xaf, 0x80, 0x26, 0x2a, 0x9c, 0xad, 0x81, 0xa2, 0x56, 0x94, 0x34, 0x32, 0x5d,
+    0xc2, 0xfc, 0x6d, 0x69, 0xce, 0xd6, 0x7b, 0x95, 0x0e, 0x5d, 0x54, 0x60, 0x52, 0xc9, 0x69, 0xcf,
+    0x47, 0xbc, 0xf8, 0xc8, 0x79, 0xac, 0xc4, 0x36, 0xce, 0x97, 0xf9, 0xd2, 0xb9, 0x45, 0xd7, 0xa3,
+    0x5e, 0x6f, 0x21, 0x99, 0x7a, 0x80, 0x65, 0x31, 0x57, 0xda, 0x69, 0x53, 0x8d, 0x3a, 0xe3, 0x54,
+    0xfd, 0xe1, 0x0c, 0x93, 0xb6, 0xee, 0x19, 0xa5, 0xd8, 0xf9, 0x60, 0x39, 0x94, 0xb0, 0xb3, 0x5b,
+    0xed, 0x4e, 0xdd, 0x1e, 0xab, 0x20, 0x5a, 0x06, 0xd0, 0xd2, 0x72, 0xee, 0x34, 0xcf, 0x42, 0xe7,
+    0x1d, 0xc9, 0xea, 0xd1, 0xaf, 0x5d, 0xe2, 0xda, 0x33, 0xac, 0x57, 0xf1, 0xe1, 0x3a, 0x63, 0xee,
+    0x6c, 0xc5, 0x58, 0x53, 0x33, 0xe4, 0xbb, 0x25, 0x32, 0x3f, 0x51, 0x17, 0xe5, 0x89, 0xba, 0x8d,
+    0xb0, 0xc2, 0x4f, 0x67, 0xbc, 0x34, 0x93, 0x79, 0x95, 0xae, 0x74, 0x52, 0x09, 0x82, 0x2d, 0xe4,
+    0x72, 0x0d, 0x93, 0xdf, 0x16, 0xe6, 0x9b, 0x74, 0xd7, 0xd7, 0x1b, 0x10, 0x88, 0x71, 0x6a, 0x9b,
+    0x0d, 0xd7, 0x9b, 0xa8, 0x55, 0xbd, 0xe3, 0x54, 0x7c, 0xdd, 0x94, 0x28, 0x89, 0xf4, 0x5a, 0x80,
+    0xab, 0x3d, 0x65, 0x96, 0x1d, 0xf2, 0x63, 0x9f, 0xdd, 0x63, 0xe3, 0xaa, 0xdb, 0xa1, 0x25, 0x4f,
+    0x60, 0x1f, 0x2c, 0x7c, 0x6c, 0x77, 0xbe, 0xe7, 0x72, 0x7e, 0x75, 0x66, 0xcb, 0x5e, 0xe0, 0xd4,
+    0x8f, 0x25, 0x3c, 0x11, 0x1f, 0x2e, 0x5c, 0x5b, 0x69, 0xb6, 0xb7, 0x9a, 0xbf, 0x9e, 0xcc, 0x2a,
+    0xe3, 0x94, 0x0c, 0x57, 0xb9, 0xc9, 0x09, 0x76, 0x41, 0x74, 0x9a, 0xc1, 0x6d, 0x99, 0x9a, 0x9a,
+    0xad, 0x46, 0xad, 0x73, 0x31, 0x1a, 0xe9, 0x5a, 0x5a, 0xd7, 0xbd, 0x57, 0x36, 0x7a, 0x88, 0x0d,
+    0x22, 0xf5, 0x26, 0xf7, 0x84, 0xd3, 0x23, 0xb3, 0xf7, 0xb0, 0x4f, 0x9d, 0xf0, 0x9d, 0x77, 0x81,
+    0x8b, 0xf0, 0x3c, 0x5f, 0x6b, 0x42, 0xb6, 0x12, 0x28, 0xbb, 0xc3, 0xf2, 0x99, 0xa6, 0xf9, 0xe6,
+    0x80, 0xd5, 0x3a, 0xe1, 0x9c, 0xc8, 0x22, 0xd6, 0x5d, 0xac, 0xe9, 0x6d, 0x33, 0xe1, 0xf4, 0x77,
+    0x1f, 0x76, 0xce, 0x4d, 0x0e, 0xbf, 0xf6, 0xa2, 0x9b, 0xa6, 0x3f, 0xd6, 0x0c, 0x05, 0xf4, 0xac,
+    0xac, 0x6a, 0x9d, 0x50, 0x03, 0xd0, 0x77, 0xde, 0x89, 0x73, 0x6c, 0x88, 0x8e, 0x45, 0xbc, 0xde,
+    0x07, 0x5d, 0x7b, 0xeb, 0xdb, 0x55, 0x72, 0xbb, 0x16, 0x49, 0x36, 0x75, 0xd7, 0x61, 0x5e, 0xff,
+    0x2b, 0x42, 0x05, 0x42, 0x8c, 0xbb, 0xb6, 0x59, 0x8e, 0xed, 0x2b, 0x01, 0x36, 0xcf, 0xb5, 0xae,
+    0x0a, 0xcb, 0xa9, 0xf9, 0x7b, 0xe4, 0x4e, 0x89, 0x29, 0x4c, 0x56, 0x9d, 0x57, 0x1b, 0xc3, 0xb4,
+    0x66, 0xdb, 0x9d, 0xb9, 0xd6, 0x52, 0xd5, 0x3c, 0x9a, 0x68, 0xbb, 0x96, 0xb6, 0x18, 0x17, 0x95,
+    0x7b, 0x2c, 0xdd, 0xd4, 0xfc, 0xb1, 0x83, 0x5a, 0x0f, 0x62, 0xfc, 0xbf, 0xec, 0xdc, 0x5e, 0x7c,
+    0x8b, 0x1a, 0x00, 0x00,
+};
+
+// index.html -> /index.html (10359 -> 3324 byte)
+static const uint8_t web_index_html_gz[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xad, 0x5a, 0x4f, 0x73, 0xdb, 0xc6,
+    0x15, 0xbf, 0xfb, 0x53, 0xac, 0x69, 0xa7, 0x04, 0x13, 0x11, 0x22, 0xe9, 0x3f, 0x92, 0x45, 0x51,
+    0x1d, 0x59, 0x96, 0x13, 0x77, 0xec, 0xc6, 0x53, 0x29, 0xc9, 0x74, 0x3a, 0x1d, 0x7b, 0x09, 0x2c,
+    0xc9, 0x35, 0x01, 0x2c, 0xbb, 0x58, 0x52, 0xa2, 0x15, 0xcd, 0xf4, 0xde, 0x43, 0x0f, 0xed, 0xa1,
+    0xd3, 0xe9, 0xd4, 0xc7, 0x5c, 0xab, 0x4b, 0xa7, 0x07, 0xdf, 0xa4, 0x7c, 0x91, 0x7c, 0x81, 0xf6,
+    0x23, 0xf4, 0xbd, 0xdd, 0x05, 0xb0, 0x00, 0x41, 0xc9, 0x1e, 0xc7, 0x19, 0x3b, 0xe0, 0xe2, 0xed,
+    0xdb, 0xf7, 0xe7, 0xf7, 0xfe, 0xec, 0x23, 0x77, 0x6f, 0x3f, 0xf9, 0xfa, 0xe0, 0xf8, 0xb7, 0x2f,
+    0x0f, 0xc9, 0x44, 0xc5, 0xd1, 0xde, 0xad, 0x5d, 0xfc, 0x1f, 0x89, 0x68, 0x32, 0x1e, 0x34, 0x94,
+    0x6c, 0xe0, 0x02, 0xa3, 0xe1, 0xde, 0x2d, 0x42, 0x76, 0x63, 0xa6, 0x28, 0x09, 0x26, 0x54, 0xa6,
+    0x4c, 0x0d, 0x1a, 0xdf, 0x1c, 0x3f, 0x6d, 0x6f, 0x37, 0x8a, 0x17, 0x09, 0x8d, 0xd9, 0xa0, 0xb1,
+    0xe0, 0xec, 0x64, 0x26, 0xa4, 0x6a, 0x90, 0x40, 0x24, 0x8a, 0x25, 0x40, 0x78, 0xc2, 0x43, 0x35,
+    0x19, 0x84, 0x6c, 0xc1, 0x03, 0xd6, 0xd6, 0x1f, 0x36, 0x08, 0x4f, 0xb8, 0xe2, 0x34, 0x6a, 0xa7,
+    0x01, 0x8d, 0xd8, 0xa0, 0xeb, 0x77, 0x0c, 0x23, 0xc5, 0x55, 0xc4, 0xf6, 0xbe, 0xe5, 0x81, 0x92,
+    0x22, 0x21, 0x2f, 0x04, 0x50, 0x09, 0xb9, 0xbb, 0x69, 0x96, 0x91, 0x20, 0x55, 0x4b, 0xf3, 0x44,
+    0xc8, 0x8e, 0x14, 0x42, 0x91, 0x33, 0xd2, 0x6e, 0xcf, 0x24, 0x8f, 0xa9, 0x5c, 0xee, 0x90, 0x3b,
+    0x9d, 0xde, 0xf6, 0xfd, 0x60, 0xab, 0x0f, 0x6b, 0xc3, 0x31, 0x7c, 0x1c, 0xdd, 0x1b, 0xdd, 0x1f,
+    0x3d, 0xc4, 0x8f, 0x01, 0x95, 0x21, 0x2e, 0xe8, 0x3f, 0xb8, 0xa0, 0xd8, 0xa9, 0x82, 0x85, 0xee,
+    0xa8, 0xf7, 0xe8, 0x9e, 0xde, 0x90, 0xce, 0x83, 0x80, 0xa5, 0x29, 0xae, 0x75, 0x86, 0x8f, 0xb6,
+    0xbb, 0xb8, 0x76, 0x42, 0x65, 0xc2, 0x13, 0xcd, 0xe9, 0xc1, 0x23, 0xd6, 0x19, 0xe2, 0x5a, 0x08,
+    0x96, 0x61, 0x12, 0x96, 0xd8, 0xe8, 0x3e, 0xfc, 0xe9, 0x93, 0x73, 0x2d, 0xcd, 0x50, 0x84, 0x4b,
+    0x10, 0x66, 0x04, 0x4a, 0xb7, 0x47, 0x34, 0xe6, 0x11, 0x88, 0xd3, 0xa6, 0xb3, 0x59, 0xc4, 0xda,
+    0xe9, 0x32, 0x55, 0x2c, 0xde, 0x20, 0x8f, 0x23, 0x9e, 0x4c, 0x5f, 0xd0, 0xe0, 0x48, 0x7f, 0x7e,
+    0x0a, 0x94, 0x1b, 0xa4, 0x71, 0xc4, 0xc6, 0x82, 0x91, 0x6f, 0x9e, 0x35, 0x36, 0xc8, 0x6f, 0xc4,
+    0x50, 0x28, 0xb1, 0x41, 0xbe, 0x62, 0xd1, 0x82, 0x29, 0x1e, 0xd0, 0x0d, 0xb2, 0x2f, 0xc1, 0x48,
+    0x1b, 0x24, 0xa5, 0x49, 0xda, 0x4e, 0x99, 0xe4, 0x20, 0xfa, 0x90, 0x06, 0xd3, 0xb1, 0x14, 0xf3,
+    0x24, 0x6c, 0x07, 0x22, 0x12, 0x20, 0xc9, 0x82, 0x4a, 0x0f, 0x15, 0x6e, 0xf5, 0x49, 0x69, 0x05,
+    0x55, 0x84, 0x35, 0x30, 0xcd, 0x98, 0x27, 0x3b, 0xa4, 0xd3, 0x27, 0x33, 0x1a, 0x86, 0x5a, 0x1f,
+    0x78, 0x8e, 0x79, 0xd2, 0x9e, 0x30, 0x3e, 0x9e, 0x80, 0x19, 0xba, 0x9d, 0xce, 0x62, 0x92, 0x69,
+    0xe2, 0xa3, 0xbf, 0x99, 0x04, 0x65, 0x8a, 0xa3, 0x32, 0x96, 0xd6, 0xd2, 0xc5, 0x49, 0x27, 0x13,
+    0xae, 0x98, 0xc3, 0xb8, 0x2b, 0x59, 0xdc, 0x27, 0x78, 0x72, 0x9b, 0x46, 0x7c, 0x0c, 0xc7, 0x06,
+    0x80, 0x01, 0x26, 0x41, 0x6e, 0x71, 0xda, 0x4e, 0x27, 0x34, 0x14, 0x27, 0x70, 0x3c, 0xe9, 0xcd,
+    0x4e, 0xc9, 0x7d, 0xf8, 0x2b, 0xc7, 0x43, 0xea, 0x75, 0x36, 0xf4, 0x7f, 0x7e, 0xb7, 0x55, 0x95,
+    0x61, 0xd2, 0x05, 0x31, 0x1c, 0x05, 0xb4, 0x79, 0x53, 0xfe, 0x96, 0xc1, 0x49, 0x7e, 0xef, 0x81,
+    0x3e, 0xcc, 0xee, 0x48, 0xe8, 0x02, 0x68, 0x43, 0x9e, 0xce, 0x22, 0x0a, 0xb6, 0x1f, 0x45, 0xec,
+    0xb4, 0x4f, 0xde, 0xcc, 0x53, 0xc5, 0x47, 0xcb, 0xb6, 0xc5, 0xa2, 0x23, 0x8d, 0xa3, 0x5a, 0x55,
+    0x87, 0x8e, 0x6f, 0x18, 0x8f, 0xe9, 0x2c, 0x53, 0xa8, 0x2c, 0x7c, 0x17, 0x04, 0xef, 0x55, 0x85,
+    0xef, 0x3c, 0x68, 0xb9, 0xb2, 0xb4, 0x87, 0x2a, 0xa9, 0x98, 0x30, 0x11, 0x09, 0x43, 0x56, 0x32,
+    0x44, 0xfc, 0x98, 0x4f, 0x95, 0x43, 0xed, 0x71, 0xae, 0x9a, 0xc5, 0xc2, 0x89, 0xf5, 0xd6, 0xc3,
+    0x4e, 0x27, 0xb7, 0xff, 0x9d, 0x87, 0xc3, 0xad, 0xde, 0x36, 0x7e, 0x9e, 0xcb, 0x14, 0x17, 0x66,
+    0x82, 0x67, 0xf6, 0xc6, 0x73, 0xda, 0x00, 0x29, 0x25, 0xe2, 0x1d, 0x2d, 0x6f, 0x2a, 0x22, 0x1e,
+    0x12, 0x25, 0x01, 0x4d, 0x33, 0x2a, 0xc1, 0x12, 0x55, 0x81, 0x7d, 0x1a, 0x28, 0xbe, 0x60, 0x20,
+    0x77, 0x09, 0x48, 0x85, 0xd7, 0x4b, 0x4c, 0xdb, 0x6b, 0x88, 0x0c, 0x4f, 0xc3, 0x18, 0x0d, 0x4f,
+    0x79, 0xa2, 0xe1, 0x54, 0x01, 0x49, 0x4c, 0x4f, 0x4d, 0x36, 0xd0, 0x1a, 0xcd, 0x4e, 0x1d, 0xa4,
+    0x12, 0x3a, 0x57, 0xa2, 0xc4, 0x68, 0xf3, 0x73, 0xf2, 0x84, 0xa6, 0x93, 0xa1, 0x80, 0x38, 0x26,
+    0x47, 0x98, 0x04, 0x52, 0xf2, 0xf9, 0xa6, 0x39, 0xc3, 0x66, 0x16, 0x0c, 0xf1, 0x5a, 0xd0, 0xe2,
+    0x8b, 0x42, 0x76, 0x49, 0x43, 0x3e, 0x87, 0x30, 0xef, 0xf6, 0xf0, 0xc8, 0x15, 0x99, 0x50, 0x82,
+    0xdc, 0x68, 0xeb, 0x9c, 0x7f, 0xef, 0x1a, 0xe4, 0x5a, 0x69, 0xf2, 0x20, 0xba, 0x09, 0x91, 0xe0,
+    0x0a, 0x20, 0x1f, 0x32, 0x75, 0xc2, 0x58, 0xd2, 0x27, 0x3a, 0x6a, 0xda, 0x00, 0xc8, 0x38, 0x75,
+    0x63, 0xa7, 0xe4, 0xcb, 0x6e, 0xee, 0xcb, 0x3b, 0xec, 0x01, 0xdb, 0x62, 0xc3, 0x5c, 0x8f, 0x9c,
+    0x24, 0xc3, 0x70, 0x45, 0xa1, 0x6c, 0xb9, 0x2c, 0xab, 0x4e, 0xaf, 0x59, 0xf2, 0xca, 0x50, 0xb6,
+    0xe5, 0xa0, 0xac, 0xea, 0xe1, 0x52, 0x18, 0x76, 0x6b, 0x38, 0xc6, 0x34, 0xc8, 0xf8, 0x19, 0xb2,
+    0x8e, 0xbf, 0x65, 0x4e, 0xce, 0x70, 0xfb, 0x28, 0xa0, 0xf7, 0xe8, 0xa8, 0x0c, 0x96, 0xb1, 0xe4,
+    0xa1, 0x6b, 0x31, 0xfc, 0xdc, 0xd7, 0xff, 0x42, 0x2e, 0x8b, 0x61, 0x4d, 0x31, 0xc4, 0xdc, 0x3c,
+    0x4e, 0xd0, 0x7f, 0x23, 0x89, 0x7f, 0x6d, 0x98, 0xe6, 0xfc, 0xad, 0x1c, 0x50, 0x91, 0x24, 0x47,
+    0x19, 0x6a, 0x53, 0x91, 0x03, 0x91, 0x3b, 0xa3, 0x47, 0x23, 0x3a, 0x1a, 0x96, 0x22, 0xd1, 0xb2,
+    0xaa, 0x00, 0x66, 0x1b, 0xf1, 0x52, 0x62, 0xdf, 0x8e, 0xe8, 0x90, 0x45, 0x37, 0x28, 0x9a, 0x05,
+    0x68, 0xae, 0xd5, 0x30, 0x12, 0xc1, 0xb4, 0xc6, 0x33, 0xbd, 0x1a, 0x05, 0xda, 0x0b, 0x1a, 0xcd,
+    0x59, 0xf9, 0x84, 0x3c, 0xf1, 0xad, 0x75, 0xd7, 0x9d, 0x6e, 0xb7, 0xbb, 0xdd, 0xdb, 0xca, 0x79,
+    0xcd, 0xa1, 0x8c, 0x56, 0xa5, 0xdc, 0x5e, 0x65, 0x71, 0xbf, 0x2e, 0xaf, 0xb8, 0xfe, 0x99, 0x49,
+    0x31, 0x96, 0x50, 0x23, 0xdb, 0x43, 0x8a, 0xc8, 0xb6, 0xc1, 0x0b, 0xc5, 0xe3, 0xb3, 0x3e, 0xc9,
+    0x4a, 0x89, 0xb6, 0x52, 0xc9, 0xc0, 0x19, 0x44, 0x2b, 0xe6, 0xbc, 0x8f, 0x84, 0x62, 0xc1, 0xe4,
+    0x28, 0xc2, 0xc0, 0x9a, 0xf0, 0x30, 0x44, 0xfc, 0x5b, 0xb3, 0x28, 0x31, 0x5b, 0x41, 0x6b, 0x7e,
+    0xfc, 0x88, 0x47, 0x68, 0x75, 0xa7, 0x7a, 0x7d, 0xd6, 0xaf, 0x89, 0x7b, 0x5b, 0xd1, 0x01, 0xaf,
+    0x3a, 0xe5, 0x41, 0xc3, 0x21, 0x00, 0x04, 0x5a, 0x6a, 0x60, 0x7d, 0x2f, 0x25, 0x8c, 0xa6, 0xac,
+    0x9a, 0x65, 0x9e, 0x0a, 0x19, 0x57, 0x13, 0xcc, 0x08, 0xd6, 0xda, 0xc8, 0x7b, 0x96, 0x57, 0xa3,
+    0x4a, 0x8a, 0x30, 0x3c, 0x32, 0x38, 0x54, 0x5d, 0x5d, 0x36, 0xfc, 0x56, 0x8d, 0xf7, 0x1e, 0xa0,
+    0xe9, 0xaf, 0x8d, 0x55, 0x9e, 0xcc, 0xe6, 0xaa, 0x6a, 0xf4, 0x75, 0x98, 0x2d, 0xa5, 0x88, 0xb0,
+    0x1b, 0x3e, 0x08, 0x57, 0xed, 0xff, 0x50, 0x3b, 0x0a, 0x53, 0x1b, 0x7f, 0xab, 0x79, 0xe4, 0x49,
+    0xe6, 0xb4, 0xa6, 0x00, 0xd9, 0x26, 0x67, 0x0e, 0xa2, 0x25, 0x7e, 0x4a, 0x17, 0xcc, 0xd6, 0xb7,
+    0x92, 0x38, 0xeb, 0x5a, 0x93, 0x1b, 0xbb, 0x86, 0x15, 0xf1, 0xdd, 0x52, 0x59, 0x96, 0xb8, 0xa6,
+    0x12, 0x56, 0x2b, 0xdf, 0x8a, 0xf0, 0x2e, 0xa6, 0x5c, 0x75, 0x4a, 0x29, 0x4b, 0x1b, 0x38, 0xf7,
+    0xf2, 0xf5, 0x29, 0xa2, 0xbb, 0x36, 0x3f, 0xd4, 0xd8, 0x3f, 0xc3, 0xff, 0x35, 0xc0, 0xf1, 0xc1,
+    0x98, 0xd0, 0xdf, 0x41, 0x4d, 0x08, 0xc1, 0x4e, 0xa5, 0xe3, 0xdb, 0x2b, 0x85, 0x7e, 0x9d, 0x09,
+    0x9d, 0xfe, 0xe1, 0x66, 0x33, 0xae, 0x18, 0xcd, 0x11, 0xc4, 0x74, 0xb8, 0xb5, 0x52, 0x18, 0x7f,
+    0x1a, 0x82, 0xeb, 0xdc, 0xa9, 0x33, 0x54, 0x8e, 0xe0, 0x6b, 0xc5, 0xb9, 0x5f, 0x2b, 0x4e, 0x4d,
+    0xae, 0xb2, 0x12, 0xc2, 0x21, 0x2c, 0x6c, 0x1b, 0xa7, 0xfd, 0x4c, 0xe5, 0x75, 0xa5, 0xf3, 0xbb,
+    0xb9, 0xde, 0xba, 0x00, 0x32, 0xa9, 0xcb, 0x95, 0xc5, 0x28, 0x6a, 0x05, 0x8e, 0x04, 0x45, 0xee,
+    0x6b, 0x6a, 0x51, 0xd5, 0xbd, 0xb9, 0x2c, 0xbd, 0x5c, 0xe9, 0xdd, 0x4d, 0x7b, 0xeb, 0xd9, 0xdd,
+    0x34, 0x57, 0xb1, 0x5d, 0xbc, 0x6c, 0xe8, 0xeb, 0x50, 0xc8, 0x17, 0x24, 0x88, 0x68, 0x9a, 0x0e,
+    0x1a, 0xa6, 0xe1, 0x68, 0x98, 0xbb, 0xd1, 0xee, 0xa4, 0xbb, 0xf7, 0xd3, 0xdf, 0xff, 0x42, 0x56,
+    0x6e, 0x52, 0xb0, 0xae, 0x39, 0xc2, 0x46, 0x7c, 0xa8, 0xf0, 0x80, 0x36, 0x30, 0x63, 0x60, 0x42,
+    0xdd, 0x79, 0xa1, 0x03, 0xde, 0xf4, 0x87, 0x0d, 0x22, 0x92, 0x20, 0xe2, 0xc1, 0x74, 0xd0, 0x48,
+    0x27, 0xe2, 0xe4, 0x98, 0x0e, 0xbd, 0x66, 0x98, 0x75, 0x67, 0xcd, 0x56, 0x63, 0xef, 0xcb, 0xcb,
+    0x7f, 0xc3, 0x15, 0x47, 0x8e, 0x19, 0x79, 0x49, 0x13, 0x16, 0xf1, 0xdd, 0x4d, 0xc3, 0xee, 0x3a,
+    0xde, 0x75, 0x4c, 0xe1, 0x9e, 0xa9, 0xc0, 0x18, 0x29, 0xf2, 0xdc, 0x5f, 0x52, 0x19, 0x51, 0xe9,
+    0xb2, 0xb2, 0x6a, 0x54, 0x94, 0xc8, 0x5b, 0xce, 0x4c, 0x95, 0xdb, 0xed, 0xb6, 0xd3, 0x3c, 0x02,
+    0x63, 0xb8, 0xc5, 0xd9, 0x57, 0xb8, 0x8d, 0x87, 0x83, 0x46, 0x2e, 0x7d, 0x23, 0xe3, 0xa2, 0xe8,
+    0x30, 0x03, 0x91, 0xe5, 0xe3, 0x92, 0x6b, 0xf4, 0x3d, 0xe7, 0x69, 0xf1, 0xae, 0x2c, 0x83, 0xf5,
+    0x79, 0x63, 0xef, 0x5b, 0xb8, 0xb4, 0x91, 0x21, 0x9b, 0x46, 0x2c, 0xe1, 0x4b, 0x21, 0x7d, 0xdf,
+    0xcf, 0x6d, 0xaf, 0xf7, 0x14, 0x1f, 0x0a, 0x65, 0xac, 0xc8, 0x47, 0x56, 0x79, 0x94, 0x78, 0x87,
+    0xc0, 0x79, 0x92, 0x4f, 0x09, 0x8f, 0xa6, 0xe0, 0x04, 0x1e, 0xc1, 0xd1, 0x94, 0x64, 0xe6, 0xf1,
+    0xdf, 0xa4, 0xf0, 0x82, 0x91, 0xe5, 0x5c, 0x9f, 0x23, 0x57, 0xf5, 0xcb, 0x28, 0xeb, 0xd4, 0xb3,
+    0xa5, 0xb7, 0xac, 0x65, 0x55, 0x8f, 0xdf, 0x5e, 0xbe, 0xaf, 0xd7, 0x21, 0x7f, 0x74, 0x9c, 0x91,
+    0x06, 0x92, 0xcf, 0x94, 0x79, 0x3f, 0x9a, 0x27, 0x01, 0x16, 0x5e, 0x92, 0x39, 0x15, 0x4e, 0x7e,
+    0x16, 0xb6, 0xc8, 0x99, 0x3d, 0x2d, 0x14, 0xc1, 0x3c, 0x06, 0x29, 0xfc, 0x3f, 0xcc, 0x99, 0x5c,
+    0x1e, 0xb1, 0x88, 0x05, 0x00, 0xd4, 0xfd, 0x28, 0xf2, 0x9a, 0xbe, 0x23, 0x64, 0xb3, 0x85, 0x55,
+    0xf8, 0x90, 0x06, 0x13, 0x0f, 0x4a, 0xec, 0x60, 0x8f, 0xb0, 0xc8, 0xd7, 0x32, 0xa2, 0x13, 0x30,
+    0x27, 0x78, 0x4d, 0xa3, 0x46, 0xb3, 0xd5, 0xea, 0x7f, 0x00, 0x6b, 0x0b, 0xba, 0xeb, 0xd9, 0x42,
+    0x04, 0x42, 0x83, 0xe2, 0x35, 0x0d, 0xea, 0x1d, 0xce, 0xd5, 0x03, 0xc6, 0x4c, 0x1d, 0x46, 0x0c,
+    0x1f, 0x1f, 0x2f, 0x9f, 0x85, 0x56, 0xc5, 0x1a, 0x46, 0x99, 0x88, 0x19, 0x1f, 0xb6, 0xc0, 0xdd,
+    0x0a, 0x0a, 0x03, 0x53, 0x55, 0x75, 0xb2, 0x43, 0x2b, 0x67, 0xf2, 0x91, 0x61, 0x4f, 0x06, 0x83,
+    0x01, 0x71, 0x02, 0x24, 0x37, 0xa8, 0x6e, 0x44, 0xc0, 0x6d, 0x19, 0x7c, 0xf6, 0x53, 0x20, 0xf2,
+    0x5a, 0xce, 0x5b, 0xc8, 0x49, 0x6a, 0xc2, 0x12, 0xcf, 0x6b, 0xa1, 0xc6, 0x2e, 0xad, 0xd7, 0xaa,
+    0xd0, 0x05, 0x54, 0xa1, 0x69, 0xa4, 0x44, 0x4a, 0x70, 0x05, 0x64, 0x41, 0xe6, 0xc3, 0x47, 0x21,
+    0xbd, 0x26, 0x06, 0x24, 0x49, 0xe9, 0x72, 0x44, 0xd3, 0xab, 0x0b, 0xb2, 0x34, 0x00, 0x01, 0x23,
+    0x84, 0x7c, 0xa7, 0xb9, 0x41, 0x80, 0xa8, 0xb0, 0x97, 0xc9, 0x84, 0xe7, 0x06, 0xdc, 0x9b, 0x9b,
+    0xc4, 0xc6, 0x32, 0x00, 0x78, 0x1a, 0xb3, 0x94, 0x13, 0x0f, 0x3b, 0x2c, 0xf2, 0x05, 0x99, 0x8a,
+    0x70, 0xde, 0x22, 0x74, 0x29, 0x81, 0x61, 0x28, 0xd2, 0x25, 0x0d, 0xe9, 0x86, 0x81, 0xfc, 0xe5,
+    0x0f, 0x57, 0x17, 0xd1, 0xd5, 0xc5, 0x8f, 0xef, 0x00, 0xf6, 0x43, 0x40, 0xf8, 0x94, 0xbd, 0xcd,
+    0x8e, 0xe4, 0xd2, 0x34, 0x5f, 0x4c, 0xe5, 0x01, 0xa1, 0x75, 0x26, 0x03, 0x92, 0xcc, 0xa3, 0xa8,
+    0x5f, 0x86, 0x61, 0x8d, 0x69, 0x72, 0xd3, 0xf1, 0x11, 0xf1, 0x6e, 0x97, 0x78, 0xb8, 0x66, 0x5d,
+    0x61, 0xce, 0x4e, 0xc8, 0x4b, 0x29, 0x62, 0x9e, 0x32, 0xcf, 0x83, 0xbe, 0x54, 0x44, 0x0b, 0xb6,
+    0x41, 0x24, 0x7b, 0x03, 0x30, 0xd3, 0x96, 0x75, 0x3d, 0x82, 0xb6, 0x03, 0xf9, 0x60, 0x5b, 0x0e,
+    0x9a, 0x40, 0x32, 0xb8, 0xd0, 0x58, 0xdc, 0x40, 0xae, 0xd3, 0x41, 0x53, 0xf8, 0x5b, 0x1f, 0xe9,
+    0xa7, 0x32, 0x80, 0x3d, 0xcd, 0xcd, 0x3c, 0xd4, 0x3b, 0xb4, 0xd3, 0xed, 0xb1, 0xed, 0x10, 0x62,
+    0xbe, 0x59, 0x26, 0x15, 0x09, 0xea, 0x06, 0xd4, 0x56, 0x96, 0xea, 0x5b, 0xed, 0x36, 0x78, 0x6d,
+    0xdc, 0x7e, 0x56, 0x6f, 0x2c, 0x2b, 0xbf, 0x87, 0xca, 0x1d, 0x6a, 0x3f, 0x6b, 0x19, 0x5a, 0x78,
+    0xbf, 0x75, 0x19, 0xe6, 0x5a, 0x60, 0xd9, 0xf1, 0xe9, 0x6c, 0xc6, 0x92, 0xf0, 0x60, 0xc2, 0xa3,
+    0xd0, 0x4b, 0x1d, 0x0d, 0xce, 0x2b, 0x08, 0x20, 0xc0, 0x5e, 0xcd, 0x65, 0x52, 0x3e, 0xbb, 0x7f,
+    0xab, 0xa0, 0x28, 0x3b, 0x4b, 0x02, 0x57, 0x26, 0x9f, 0xe8, 0x6c, 0x9b, 0x7a, 0x26, 0xeb, 0xa6,
+    0x85, 0x4f, 0x8c, 0x51, 0x8b, 0x11, 0xc3, 0x60, 0x6d, 0x44, 0x36, 0x8b, 0x8c, 0x5d, 0x58, 0x18,
+    0xdd, 0x6d, 0x79, 0xfa, 0x80, 0xa3, 0x31, 0x5c, 0x0b, 0x30, 0xa8, 0x3a, 0xae, 0xd3, 0x73, 0xe6,
+    0x3e, 0x4f, 0xe0, 0xdf, 0xaf, 0x8e, 0x5f, 0x3c, 0x47, 0x7f, 0xd4, 0xe6, 0xc8, 0x03, 0x3e, 0xa1,
+    0x6f, 0xa1, 0x47, 0x8e, 0xe6, 0x09, 0x8d, 0x69, 0x78, 0x75, 0xe1, 0x93, 0xe7, 0x97, 0xef, 0xd5,
+    0x08, 0x7a, 0x03, 0x5d, 0x01, 0x96, 0x3c, 0xc9, 0x73, 0xa7, 0xe3, 0x3b, 0x63, 0x92, 0xc2, 0x50,
+    0xf6, 0x01, 0xf1, 0xac, 0x47, 0xb1, 0x70, 0x5c, 0x4e, 0x9d, 0x89, 0x9b, 0x25, 0xad, 0xb0, 0x8c,
+    0x33, 0xdc, 0x63, 0x2e, 0x8e, 0xe9, 0x57, 0xd5, 0xad, 0xe6, 0x2d, 0x74, 0x20, 0x92, 0xd6, 0xbc,
+    0xcb, 0x1f, 0x20, 0x3a, 0xbf, 0x15, 0x91, 0xa2, 0x50, 0xbb, 0x7f, 0x41, 0x0e, 0xe6, 0x12, 0xc7,
+    0x44, 0xc4, 0x3b, 0x10, 0x71, 0x2c, 0x92, 0x22, 0x39, 0xb8, 0x87, 0x7c, 0x31, 0x20, 0xaf, 0x1d,
+    0x64, 0xb8, 0xa6, 0x31, 0x64, 0x4e, 0x8d, 0xd4, 0x04, 0xd0, 0x92, 0x25, 0x65, 0x0a, 0x73, 0x91,
+    0x86, 0x6a, 0x89, 0x27, 0xbf, 0x81, 0x7e, 0x07, 0x28, 0x2a, 0x9b, 0x56, 0xb8, 0x9a, 0xab, 0x71,
+    0x63, 0xef, 0xee, 0x59, 0xe8, 0x2f, 0x8c, 0xc4, 0xbe, 0x12, 0x4f, 0xf9, 0x29, 0x0b, 0xbd, 0x5e,
+    0xeb, 0xbc, 0x7c, 0x0c, 0xde, 0x80, 0x81, 0xbd, 0xe5, 0x5c, 0x2a, 0xc1, 0x95, 0x32, 0xfc, 0xe9,
+    0x4a, 0xec, 0x4f, 0xaf, 0x2e, 0xe2, 0x8f, 0xd2, 0x81, 0xe8, 0xfe, 0x0e, 0x3b, 0x17, 0xec, 0x05,
+    0x51, 0xa1, 0xc0, 0x1a, 0x7e, 0x8f, 0x74, 0xc8, 0x2f, 0x49, 0xb3, 0x7c, 0x9f, 0x6d, 0x92, 0x9d,
+    0x6c, 0xc9, 0x76, 0xe2, 0xcd, 0x73, 0x63, 0x07, 0xbb, 0x2d, 0xb7, 0x43, 0xb7, 0xde, 0x0e, 0xfb,
+    0x1f, 0x68, 0x87, 0xd7, 0xfd, 0x5b, 0xf9, 0xb3, 0x0e, 0x16, 0x5f, 0x2d, 0x67, 0x4c, 0x07, 0x49,
+    0x17, 0x82, 0x04, 0xb1, 0x72, 0x24, 0x30, 0x8f, 0x1f, 0x4c, 0xb0, 0x84, 0x49, 0x87, 0xd3, 0x35,
+    0x00, 0xf9, 0x00, 0xeb, 0x5e, 0x6b, 0x5f, 0xdd, 0x52, 0x92, 0x2f, 0x2f, 0xdf, 0x07, 0x97, 0xef,
+    0xeb, 0xcc, 0xfc, 0xc1, 0x86, 0x36, 0x26, 0xb4, 0x33, 0xfe, 0x96, 0xb1, 0xe0, 0x6c, 0xf1, 0x6a,
+    0x26, 0x4e, 0x98, 0xac, 0xb5, 0xdb, 0x77, 0xeb, 0xec, 0x56, 0x83, 0xa0, 0x4f, 0xd5, 0x12, 0xf4,
+    0x4b, 0x22, 0x28, 0x70, 0xe4, 0xf2, 0x1f, 0x90, 0x20, 0x78, 0xfc, 0x33, 0x68, 0x9a, 0xe1, 0x07,
+    0x35, 0x05, 0x5f, 0x2e, 0x39, 0x8b, 0xc2, 0x57, 0x4a, 0x84, 0x74, 0x49, 0xbe, 0xff, 0x1e, 0xd2,
+    0xde, 0x4d, 0xe1, 0x33, 0xfd, 0x6e, 0xf2, 0xa9, 0x06, 0xc8, 0xc4, 0xd2, 0x33, 0x3d, 0x33, 0xca,
+    0xd3, 0x57, 0xb4, 0x84, 0xf4, 0xfa, 0x1f, 0x63, 0x9d, 0x27, 0x73, 0x39, 0xff, 0x58, 0x93, 0x68,
+    0xff, 0x42, 0xdb, 0xac, 0xd8, 0xf9, 0x87, 0xc8, 0xff, 0xda, 0x29, 0x63, 0xd0, 0x16, 0xa6, 0xac,
+    0x1a, 0x02, 0x3d, 0x1b, 0x02, 0x8f, 0xa9, 0x82, 0xbb, 0xce, 0x32, 0xbb, 0x63, 0x7d, 0x42, 0x10,
+    0xfc, 0x5c, 0xd6, 0xd9, 0x4f, 0xa0, 0x55, 0x9a, 0x62, 0x88, 0x5c, 0xfe, 0xf0, 0x49, 0xb8, 0xd1,
+    0x11, 0x81, 0xe1, 0x40, 0xf6, 0x06, 0x1f, 0x93, 0x89, 0x5e, 0x50, 0x35, 0xf1, 0xf5, 0xe0, 0xc0,
+    0xcb, 0x18, 0x68, 0x84, 0x7d, 0x72, 0x54, 0xbd, 0xee, 0xaf, 0xf6, 0x54, 0x22, 0x38, 0x40, 0x61,
+    0xb1, 0xfa, 0xfb, 0xf0, 0x01, 0x72, 0xe6, 0x83, 0x35, 0xa2, 0x7a, 0x19, 0x41, 0xcf, 0x21, 0xc8,
+    0xe2, 0xbf, 0x46, 0x97, 0x52, 0x2f, 0xe6, 0x56, 0xce, 0x1a, 0x4f, 0x5a, 0xbb, 0x39, 0xa3, 0x26,
+    0x3d, 0x8a, 0x69, 0xd4, 0x5a, 0xde, 0x12, 0x67, 0xf3, 0x82, 0xfa, 0xd1, 0x45, 0x65, 0x72, 0x51,
+    0x4c, 0x44, 0x3a, 0xfe, 0xa3, 0x95, 0x09, 0x22, 0x4e, 0xc2, 0x56, 0xce, 0xb2, 0x20, 0xd9, 0xfb,
+    0xf1, 0x9f, 0x54, 0xbe, 0x21, 0x3a, 0x66, 0xe6, 0xc4, 0x3b, 0xfa, 0xfa, 0xa0, 0x55, 0x8f, 0x8a,
+    0x8c, 0x5e, 0x07, 0x8a, 0x08, 0xdc, 0x32, 0xf2, 0xd9, 0x1a, 0x1c, 0xad, 0xfa, 0xac, 0x0c, 0x2e,
+    0x77, 0x64, 0x5c, 0x27, 0x5f, 0x1d, 0x29, 0x8e, 0x77, 0x73, 0x20, 0x9a, 0x01, 0xa3, 0x95, 0xe8,
+    0xbc, 0x3c, 0xe7, 0xbd, 0x7b, 0x96, 0x39, 0x1f, 0x50, 0x57, 0x2f, 0xca, 0x5a, 0xf9, 0x56, 0xfd,
+    0x95, 0x0d, 0x7f, 0x5c, 0x43, 0x6f, 0xbb, 0xb3, 0xfc, 0x95, 0x51, 0xfe, 0x87, 0xf8, 0xad, 0x46,
+    0x69, 0x6b, 0xe5, 0x63, 0xc8, 0xee, 0x90, 0xd9, 0xa1, 0xf3, 0xdc, 0x21, 0xba, 0x78, 0x03, 0x9c,
+    0xa1, 0x79, 0x0d, 0x5f, 0xd1, 0x49, 0xa9, 0x80, 0xef, 0x4f, 0xd6, 0x79, 0xcb, 0x32, 0x3a, 0xba,
+    0x7c, 0x2f, 0x99, 0xe1, 0x01, 0xd2, 0x42, 0xb7, 0x0a, 0x70, 0x7e, 0x15, 0xf3, 0x24, 0xd5, 0x69,
+    0xaa, 0xdd, 0x45, 0xac, 0x1f, 0x21, 0xf3, 0xb7, 0x88, 0xf1, 0x15, 0xa2, 0x2f, 0x48, 0x93, 0x84,
+    0xd3, 0xe6, 0xf9, 0x07, 0x7b, 0xf8, 0xda, 0x54, 0x59, 0x74, 0x0c, 0x93, 0x1b, 0x9a, 0x43, 0xe7,
+    0x6b, 0xbb, 0xc6, 0xfa, 0xc2, 0x51, 0xfa, 0x3a, 0xed, 0xfa, 0x24, 0xe8, 0x7e, 0x9b, 0x65, 0xb2,
+    0x7d, 0xd1, 0xae, 0xa0, 0x0d, 0x7e, 0xfa, 0xdb, 0x1f, 0xff, 0xfb, 0x9f, 0x3f, 0x93, 0x17, 0x2f,
+    0x5f, 0x1e, 0x9b, 0xbe, 0xc5, 0xe6, 0x84, 0x22, 0xa3, 0x23, 0xd5, 0xff, 0xde, 0xfd, 0xf5, 0x4f,
+    0xe4, 0x08, 0x70, 0xa1, 0x8e, 0x26, 0xf3, 0x44, 0xe9, 0xb4, 0xa0, 0x3b, 0xfb, 0x66, 0x6b, 0x9d,
+    0x89, 0x6a, 0x84, 0x88, 0x69, 0x60, 0x44, 0x80, 0x87, 0xda, 0x6d, 0x37, 0xd4, 0x4b, 0x2c, 0x01,
+    0x2b, 0xda, 0xde, 0x3d, 0x73, 0x2a, 0xca, 0xf9, 0x4d, 0xec, 0xee, 0x9e, 0xe5, 0x29, 0xeb, 0xfc,
+    0xda, 0x1e, 0xaf, 0x7a, 0x57, 0xab, 0xbf, 0xf3, 0xa0, 0x3b, 0xfb, 0xee, 0x3d, 0x3e, 0xbf, 0xa5,
+    0x8d, 0x98, 0x0a, 0x26, 0x4f, 0xa8, 0xa2, 0xce, 0x55, 0x1a, 0xea, 0xe2, 0xe1, 0xd5, 0x3b, 0xc8,
+    0xfb, 0xf9, 0x64, 0x8d, 0xd0, 0x29, 0x84, 0x09, 0xdc, 0x60, 0xae, 0xde, 0x71, 0xac, 0xa6, 0x0b,
+    0x9c, 0x8c, 0x5d, 0xfe, 0x80, 0x13, 0x00, 0xe2, 0x89, 0x59, 0xca, 0x97, 0x70, 0x45, 0x8d, 0x5a,
+    0xc5, 0x7e, 0x5d, 0x6e, 0xd7, 0xde, 0xe7, 0x8a, 0x71, 0xa3, 0x33, 0x38, 0xb1, 0x92, 0xa7, 0xce,
+    0x30, 0x28, 0xbf, 0x5e, 0x59, 0xc6, 0x5a, 0x58, 0xaf, 0xb9, 0x49, 0x67, 0x7c, 0x33, 0x04, 0x99,
+    0x9b, 0xc5, 0xa5, 0xc6, 0x4c, 0x45, 0x20, 0x05, 0xcd, 0x20, 0x58, 0x18, 0xde, 0xac, 0xb2, 0x67,
+    0xb8, 0x6c, 0x8b, 0xc4, 0x1d, 0x8e, 0x18, 0x52, 0xdc, 0x6f, 0xc8, 0x4a, 0xd7, 0x54, 0x58, 0x75,
+    0x49, 0xaf, 0x9b, 0xa1, 0xe8, 0xf1, 0xe0, 0x04, 0x36, 0xa4, 0x57, 0x17, 0x95, 0xa9, 0x49, 0x31,
+    0x2d, 0x39, 0xa0, 0x58, 0xcf, 0xb5, 0xc1, 0x76, 0x88, 0x16, 0x5c, 0xcf, 0x8d, 0x52, 0x48, 0xe5,
+    0x47, 0x87, 0x2d, 0x92, 0x42, 0x64, 0x04, 0xcc, 0x18, 0xf6, 0xc7, 0x77, 0x70, 0xd9, 0x0c, 0x10,
+    0xad, 0x00, 0x6f, 0xd8, 0xc3, 0xa1, 0x33, 0xf1, 0x33, 0x3e, 0x8f, 0xe9, 0xd5, 0xbb, 0x88, 0x26,
+    0x0a, 0xa7, 0x35, 0x62, 0x9a, 0x52, 0xe2, 0x2d, 0xd8, 0x92, 0x12, 0x45, 0x25, 0x5d, 0x5e, 0x5d,
+    0x04, 0x38, 0x73, 0x61, 0xa9, 0xc2, 0x9b, 0x6a, 0x8c, 0x73, 0xbe, 0x94, 0xb6, 0xc8, 0x3d, 0xfc,
+    0xe9, 0x09, 0x5f, 0xb2, 0x90, 0xe9, 0xa9, 0x0b, 0x6c, 0x03, 0x06, 0x57, 0x17, 0x96, 0xa7, 0x29,
+    0xc0, 0x11, 0x5f, 0x30, 0xab, 0xbb, 0x9d, 0x8a, 0xbc, 0xa0, 0x33, 0xcf, 0x6a, 0x81, 0x77, 0xce,
+    0x99, 0x88, 0xa2, 0x63, 0x1e, 0xeb, 0x0b, 0xba, 0x99, 0xc8, 0x54, 0x26, 0x83, 0x20, 0x81, 0x7a,
+    0x09, 0x44, 0x90, 0x92, 0x2a, 0xd3, 0x98, 0x7c, 0x6b, 0xab, 0x72, 0x4d, 0x76, 0x30, 0x97, 0x2d,
+    0xb9, 0xc7, 0xa4, 0x4c, 0x3d, 0xc3, 0xf9, 0x3a, 0x34, 0x35, 0x5e, 0x4e, 0xba, 0x41, 0xee, 0x75,
+    0x3a, 0x9d, 0x56, 0x3d, 0x88, 0x53, 0x28, 0x01, 0xf5, 0x32, 0xdc, 0x5e, 0x2b, 0x44, 0x10, 0x31,
+    0x2a, 0xf3, 0x73, 0x0a, 0xb2, 0x3a, 0x89, 0x8a, 0x51, 0x54, 0xf5, 0x64, 0xfc, 0x91, 0xd0, 0xf2,
+    0x39, 0x18, 0xd1, 0x8b, 0xd3, 0x71, 0xf9, 0x68, 0x58, 0xf0, 0x47, 0xb0, 0xb1, 0xe5, 0x1a, 0xd9,
+    0xd7, 0xc7, 0x16, 0x7a, 0x23, 0x51, 0xed, 0x5c, 0xc0, 0xdd, 0x83, 0x83, 0x2e, 0x9d, 0x8c, 0x36,
+    0x48, 0xd8, 0x2a, 0x6d, 0x35, 0xb3, 0xc9, 0x30, 0xdf, 0x8a, 0x5f, 0xdd, 0x57, 0x36, 0x87, 0x0c,
+    0xdc, 0xc8, 0xf0, 0x4d, 0xb1, 0xb5, 0x8c, 0xf9, 0xdf, 0xf9, 0xbe, 0xef, 0xee, 0xd0, 0xcd, 0x64,
+    0xea, 0xb5, 0x7e, 0x0f, 0x55, 0x5b, 0x2a, 0xcf, 0x03, 0xdb, 0x0f, 0xf5, 0xd8, 0x89, 0xa2, 0x0c,
+    0x7e, 0x24, 0xf0, 0x67, 0x5f, 0x07, 0x22, 0xc6, 0x9f, 0xa1, 0x78, 0x43, 0x5f, 0x73, 0x2e, 0x3b,
+    0x06, 0xd5, 0x3f, 0xe1, 0x49, 0x28, 0x4e, 0xfc, 0x43, 0x44, 0xfb, 0x91, 0x98, 0xcb, 0x80, 0x55,
+    0x67, 0x3f, 0x36, 0x10, 0x0c, 0xec, 0x1c, 0x3a, 0x1b, 0xe0, 0xe6, 0x75, 0x65, 0xde, 0x8a, 0xb3,
+    0x30, 0x31, 0x83, 0x38, 0xc9, 0x46, 0x61, 0x25, 0xd7, 0xaf, 0x90, 0x96, 0xc7, 0x66, 0x65, 0xac,
+    0x56, 0x88, 0x69, 0x18, 0x6a, 0x19, 0x30, 0x17, 0x31, 0xd8, 0x98, 0x8d, 0x9d, 0x52, 0x8c, 0xec,
+    0xf2, 0xa4, 0xa6, 0xf6, 0x4c, 0x42, 0x94, 0xfe, 0xf6, 0xaf, 0x40, 0xc4, 0xaf, 0x8e, 0xbe, 0xfe,
+    0xb5, 0x3f, 0xc3, 0x1f, 0xdc, 0x79, 0xcc, 0x37, 0x89, 0xa5, 0x0f, 0xd7, 0x11, 0x9d, 0x52, 0x08,
+    0xe6, 0x94, 0x96, 0xfe, 0xad, 0x4e, 0x29, 0xa7, 0x38, 0xe9, 0xa2, 0x9a, 0x5a, 0xfa, 0xf9, 0x1c,
+    0xae, 0xc8, 0xf6, 0x90, 0x18, 0xae, 0xfe, 0x15, 0x4d, 0x21, 0x0d, 0xc4, 0x04, 0xbf, 0x56, 0x60,
+    0x64, 0xcc, 0x70, 0x90, 0x4b, 0xa6, 0x34, 0xa4, 0x72, 0x5d, 0xb8, 0xd9, 0x2b, 0x51, 0xa6, 0x50,
+    0x9d, 0x59, 0xec, 0x57, 0x57, 0xf6, 0xbb, 0x80, 0xdd, 0x4d, 0xf3, 0xa5, 0xd5, 0xee, 0xa6, 0xf9,
+    0x99, 0xe1, 0xff, 0x01, 0x1f, 0x28, 0xba, 0xd4, 0x77, 0x28, 0x00, 0x00,
+};
+
+static const WebAsset WEB_ASSETS[] = {
+    {"/settings.0a012e8d.js", "application/javascript", web_settings_js_gz, sizeof(web_settings_js_gz), "\"0a012e8d\"", true},
+    {"/index.html", "text/html", web_index_html_gz, sizeof(web_index_html_gz), "\"095abb2d\"", false},
+};
+static const size_t WEB_ASSET_COUNT = sizeof(WEB_ASSETS) / sizeof(WEB_ASSETS[0]);
+static const WebAsset& WEB_INDEX_ASSET = WEB_ASSETS[1];
+
+#endif
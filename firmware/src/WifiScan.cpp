@@ -0,0 +1,148 @@
+#include "WifiScan.h"
+#include <WiFi.h>
+#include <atomic>
+#include <string.h>
+#include "AppLog.h"
+
+static WifiScanResult cache;
+static portMUX_TYPE cacheLock = portMUX_INITIALIZER_UNLOCKED;
+static std::atomic<bool> requested{false};
+static bool running = false;           // Sadece loop / setup
+static unsigned long startedAt = 0;
+
+static void setScanning(bool scanning) {
+    portENTER_CRITICAL(&cacheLock);
+    cache.scanning = scanning;
+    portEXIT_CRITICAL(&cacheLock);
+}
+
+void wifiScanRequest(bool force) {
+    portENTER_CRITICAL(&cacheLock);
+    bool stale = cache.updatedAt == 0 || millis() - cache.updatedAt >= WIFI_SCAN_TTL_MS;
+    portEXIT_CRITICAL(&cacheLock);
+    if (force || stale) requested.store(true, std::memory_order_relaxed);
+}
+
+static bool startScan() {
+    int16_t result = WiFi.scanNetworks(true); // async: hemen doner
+    if (result == WIFI_SCAN_FAILED) {
+        APP_LOGW("WiFi taramasi baslatilamadi");
+        return false;
+    }
+    running = true;
+    startedAt = millis();
+    setScanning(true);
+    return true;
+}
+
+// Ayni SSID'in en guclu BSSID'i kalir; liste doluysa en zayif ag cikar
+static void addNetwork(WifiScanResult& result, const String& ssid, int i) {
+    int8_t rssi = (int8_t)WiFi.RSSI(i);
+    int slot = -1;
+    for (int k = 0; k < result.count; k++) {
+        if (strcmp(result.networks[k].ssid, ssid.c_str()) == 0) {
+            if (rssi <= result.networks[k].rssi) return;
+            slot = k;
+            break;
+        }
+    }
+    if (slot < 0) {
+        if (result.count < WIFI_SCAN_MAX_NETWORKS) {
+            slot = result.count++;
+        } else {
+            int weakest = 0;
+            for (int k = 1; k < result.count; k++) {
+                if (result.networks[k].rssi < result.networks[weakest].rssi) weakest = k;
+            }
+            if (rssi <= result.networks[weakest].rssi) return;
+            slot = weakest;
+        }
+    }
+
+    WifiNetwork& net = result.networks[slot];
+    strlcpy(net.ssid, ssid.c_str(), sizeof(net.ssid));
+    net.rssi = rssi;
+    net.channel = (uint8_t)WiFi.channel(i);
+    const uint8_t* bssid = WiFi.BSSID(i);
+    if (bssid != nullptr) memcpy(net.bssid, bssid, sizeof(net.bssid));
+    else memset(net.bssid, 0, sizeof(net.bssid));
+    net.encryption = (uint8_t)WiFi.encryptionType(i);
+}
+
+static void collect(int count) {
+    static WifiScanResult fresh; // Sadece loop task'i
+    fresh.count = 0;
+    for (int i = 0; i < count; i++) {
+        String ssid = WiFi.SSID(i);
+        if (ssid.length() == 0) continue; // Gizli ag
+        addNetwork(fresh, ssid, i);
+    }
+    WiFi.scanDelete();
+
+    // RSSI'ye gore (guclu once)
+    for (int i = 1; i < fresh.count; i++) {
+        WifiNetwork net = fresh.networks[i];
+        int k = i - 1;
+        while (k >= 0 && fresh.networks[k].rssi < net.rssi) {
+            fresh.networks[k + 1] = fresh.networks[k];
+            k--;
+        }
+        fresh.networks[k + 1] = net;
+    }
+    fresh.updatedAt = millis() | 1; // 0 = hic tarama yok
+    fresh.scanning = false;
+
+    portENTER_CRITICAL(&cacheLock);
+    cache = fresh;
+    portEXIT_CRITICAL(&cacheLock);
+    APP_LOGI("WiFi taramasi: %d sonuc, %u ag (%lu ms)", count, fresh.count, millis() - startedAt);
+}
+
+void wifiScanLoop() {
+    if (running) {
+        int16_t n = WiFi.scanComplete();
+        if (n >= 0) {
+            running = false;
+            collect(n);
+        } else if (n == WIFI_SCAN_FAILED || millis() - startedAt > WIFI_SCAN_TIMEOUT_MS) {
+            APP_LOGW("WiFi taramasi basarisiz (%d)", n);
+            WiFi.scanDelete();
+            running = false;
+            setScanning(false);
+        }
+        return;
+    }
+    if (requested.exchange(false, std::memory_order_relaxed)) startScan();
+}
+
+bool wifiScanBlocking(unsigned long timeoutMs) {
+    requested.store(false, std::memory_order_relaxed);
+    if (!running && !startScan()) return false;
+    unsigned long start = millis();
+    while (running && millis() - start < timeoutMs) {
+        delay(50);
+        wifiScanLoop();
+    }
+    return !running;
+}
+
+void wifiScanSnapshot(WifiScanResult& out) {
+    portENTER_CRITICAL(&cacheLock);
+    out = cache;
+    portEXIT_CRITICAL(&cacheLock);
+}
+
+bool wifiScanFind(const String& ssid, uint8_t& channel, uint8_t bssid[6]) {
+    bool found = false;
+    portENTER_CRITICAL(&cacheLock);
+    for (int i = 0; i < cache.count; i++) {
+        if (strcmp(cache.networks[i].ssid, ssid.c_str()) == 0) {
+            channel = cache.networks[i].channel;
+            memcpy(bssid, cache.networks[i].bssid, 6);
+            found = true;
+            break;
+        }
+    }
+    portEXIT_CRITICAL(&cacheLock);
+    return found;
+}
@@ -0,0 +1,52 @@
+#ifndef WIFI_SCAN_H
+#define WIFI_SCAN_H
+
+#include <Arduino.h>
+
+// Arka planda WiFi taramasi ve sonuc onbellegi.
+//
+// Tarama WiFi.scanNetworks(async) ile loop tarafindan baslatilir ve
+// wifiScanLoop() tamamlanmasini yoklar; hicbir web handler'i taramayi
+// beklemez. Sonuclar SSID'e gore tekillestirilir (en guclu BSSID kalir),
+// RSSI'ye gore siralanir ve WIFI_SCAN_TTL_MS boyunca gecerli sayilir.
+// /api/wifi-scan onbellekten hemen cevap verir, onbellek eskiyse yeni
+// tarama ister. setup() ayni onbellekten hedef agin kanal/BSSID'ini alir.
+//
+// wifiScanRequest() ve wifiScanSnapshot() herhangi bir task'tan; diger
+// fonksiyonlar sadece loop / setup tarafindan cagrilir.
+
+#define WIFI_SCAN_MAX_NETWORKS 20
+#define WIFI_SCAN_TTL_MS 30000
+#define WIFI_SCAN_TIMEOUT_MS 15000     // Takilan taramadan vazgecilir
+
+struct WifiNetwork {
+    char ssid[33];
+    int8_t rssi;
+    uint8_t channel;
+    uint8_t bssid[6];
+    uint8_t encryption;                // wifi_auth_mode_t
+};
+
+struct WifiScanResult {
+    uint8_t count = 0;
+    WifiNetwork networks[WIFI_SCAN_MAX_NETWORKS];
+    unsigned long updatedAt = 0;       // millis, 0 = hic tarama yok
+    bool scanning = false;
+};
+
+// Onbellek eskiyse (veya force) bir sonraki wifiScanLoop'ta tarama baslatilir
+void wifiScanRequest(bool force = false);
+
+// loop()'tan: bekleyen istegi baslatir, biten taramayi onbellege alir
+void wifiScanLoop();
+
+// setup()'tan: taramayi baslatir ve bitmesini (en fazla timeoutMs) bekler
+bool wifiScanBlocking(unsigned long timeoutMs = WIFI_SCAN_TIMEOUT_MS);
+
+// Onbellegin tutarli kopyasi
+void wifiScanSnapshot(WifiScanResult& out);
+
+// Onbellekte SSID varsa kanal ve BSSID (en guclu erisim noktasi)
+bool wifiScanFind(const String& ssid, uint8_t& channel, uint8_t bssid[6]);
+
+#endif
@@ -1,26 +1,46 @@
 #include <Arduino.h>
 #include <WiFi.h>
-#include <HTTPClient.h>
 #include <ESPAsyncWebServer.h>
 #include <NimBLEDevice.h>
 #include <TFT_eSPI.h>
 #include <SPI.h>
-#include <map>
-#include <ArduinoJson.h>
 #include <DNSServer.h>
 #include "VictronBLE.h"
 #include "ConfigManager.h"
+#include "AppLog.h"
+#include "TelemetryCodec.h"
+#include "TelemetryQueue.h"
+#include "UplinkClient.h"
+#include "Uplink.h"
+#include "ChangeDetector.h"
+#include "DisplayView.h"
+#include "WifiScan.h"
+#include "FastBoot.h"
+#include "DeviceKeyTable.h"
+#include "Metrics.h"
+#include <LittleFS.h>
+#include <time.h>
 
 #define BOOT_BUTTON 0
 
+// Açılışta seri monitör için bekleme (geliştirme: -DBOOT_SERIAL_WAIT_MS=3000)
+#ifndef BOOT_SERIAL_WAIT_MS
+#define BOOT_SERIAL_WAIT_MS 0
+#endif
+
 // --- Global Nesneler ---
 AsyncWebServer server(80);
 DNSServer dnsServer;
 VictronBLE victronScanner;
 TFT_eSPI tft = TFT_eSPI();
+DisplayView displayView(tft); // Sadece değişen widget'lar yeniden çizilir
+// Sadece uplink task'i kullanir (bkz. Uplink.h)
+TelemetryQueue telemetryQueue; // WiFi kesintisinde flash'ta bekleyen telemetri
+UplinkClient uplinkClient;     // Supabase'e kalici baglanti
 
 // --- Değişkenler ---
-unsigned long lastTelemeterySend = 0;
+unsigned long lastTelemeterySend = 0; // Uplink task'ine son teslim edilen ölçüm
+unsigned long lastTelemetryCheck = 0;
 bool firstPingSent = false; // Cihaz açılır açılmaz anında veri atması için bayrak
 const long TELEMETRY_INTERVAL = 60000; // 1 Dakika (Değişiklik yoksa Heartbeat)
 const long TELEMETRY_MIN_INTERVAL = 5000; // Minimum 5 saniyede bir at (Flood koruması)
@@ -28,12 +48,15 @@ unsigned long lastDisplayUpdate = 0;
 unsigned long apTimeout = 0;
 bool isApMode = false;
 String lastWifiError = ""; // WiFi Hata Durumu
+volatile bool fastBootSaved = false; // Bu IP'nin kirası RTC'ye yazıldı (GOT_IP sıfırlar)
+
+// Loop tarafindaki okuyucularin (ekran, telemetri) ortak kopyasi.
+// Sadece VictronBLE yeni surum yayinladiginda yeniden kopyalanir.
+VictronSnapshot loopSnapshot;
 
 // --- Son Gönderilen Verilerin Hafızası (Değişiklik Tespiti İçin) ---
-std::map<String, float> lastSentVoltage;
-std::map<String, float> lastSentSoc;
-std::map<String, int> lastSentAlarm;
-std::map<String, float> lastSentPower;
+// Alan başına ölü bant + histerezis, cihaz başına tek kayıt (bkz. ChangeDetector.h)
+ChangeDetector changeDetector;
 
 void setupDisplay() {
     // Backlight pinini manuel olarak açalım (LilyGo T-Display için GPIO 4)
@@ -52,20 +75,9 @@ void setupDisplay() {
     tft.setTextSize(1);
     tft.setCursor(10, 40);
     tft.println("Sistem Baslatiliyor...");
-}
 
-const char* getMpptStateName(int state) {
-    switch (state) {
-        case 0: return "Off";
-        case 2: return "Fault";
-        case 3: return "Bulk";
-        case 4: return "Absorption";
-        case 5: return "Float";
-        case 6: return "Storage";
-        case 7: return "Equalize";
-        case 245: return "Wake-up";
-        case 252: return "Ext. Control";
-        default: return "Unknown";
+    if (!displayView.begin()) {
+        APP_LOGW("Ekran sprite'i ayrilamadi, widget'lar dogrudan cizilecek");
     }
 }
 
@@ -73,208 +85,46 @@ void updateDisplay() {
     if (millis() - lastDisplayUpdate < 500) return;
     lastDisplayUpdate = millis();
 
-    std::map<String, VictronData> devices = victronScanner.getDevices();
+    victronScanner.getSnapshot(loopSnapshot);
     
     // DEBUG: Cihaz listesi durumunu yazdır
-    // Serial.printf("UpdateDisplay: Toplam %d cihaz hafızada.\n", devices.size());
+    // Serial.printf("UpdateDisplay: Toplam %d cihaz hafızada.\n", loopSnapshot.count);
     
-    // Verileri Topla
-    float totalPvPower = 0.0;
-    float mainBatteryVoltage = 0.0;
-    float mainBatteryCurrent = 0.0;
-    float mainBatterySoc = 0.0;
-    float mainBatteryConsumed = 0.0;
-    int mainBatteryRemaining = 0;
-    bool batteryMonitorFound = false;
-    int mpptCount = 0;
-    int mainMpptState = -1; // -1: Yok/Bilinmiyor
-    
-    for (auto const& [mac, data] : devices) {
-        // Son 60 saniye içinde güncel veri mi? (Pasif tarama için süreyi uzattık)
-        if (millis() - data.timestamp > 60000) {
-            // Serial.printf("Cihaz %s verisi eski (gecen sure: %lu ms)\n", mac.c_str(), millis() - data.timestamp);
-            continue;
-        }
-        
-        // Serial.printf("Cihaz %s verisi guncel. Tip: %d\n", mac.c_str(), data.type);
-
-        if (data.type == SOLAR_CHARGER) {
-            totalPvPower += data.pvPower;
-            if (mpptCount == 0) { // İlk MPPT'nin durumunu al
-                mainMpptState = data.deviceState;
-            }
-            mpptCount++;
-        } else if (data.type == BATTERY_MONITOR) {
-            // Birden fazla BMV varsa ilkini al veya mantık ekle
-            if (!batteryMonitorFound) {
-                mainBatteryVoltage = data.voltage;
-                mainBatteryCurrent = data.current;
-                mainBatterySoc = data.soc;
-                mainBatteryConsumed = data.consumedAh;
-                mainBatteryRemaining = data.remainingMins;
-                batteryMonitorFound = true;
-            }
-        }
-    }
-
-    tft.fillScreen(TFT_BLACK); 
-
-    // Header
-    tft.setTextColor(TFT_CYAN, TFT_BLACK);
-    tft.setTextSize(2);
-    tft.setCursor(0, 0);
-    tft.print("Victron BLE");
+    // Filo özeti (VictronBLE her kayıtta O(1) günceller, bkz. FleetAggregate.h).
+    // Birden fazla akü bankası varsa akım/güç toplanır, SOC kapasiteyle ağırlıklanır.
+    const FleetTotals& fleet = loopSnapshot.fleet;
+
+    DisplayState state;
+    state.batteryFound = fleet.batteryBanks > 0;
+    state.batteryVoltage = fleet.batteryVoltage;
+    state.batteryCurrent = fleet.batteryCurrent;
+    state.batterySoc = fleet.batterySoc;
+    state.batteryRemaining = fleet.batteryRemaining;
+    state.mpptCount = fleet.mpptCount;
+    state.pvPower = fleet.pvPower;
+    state.mpptState = fleet.mpptState;
 
     // WiFi Status
-    tft.setTextSize(1);
-    tft.setTextDatum(TR_DATUM); // Sağ üst köşe hizalama
-    int wifiStatusX = tft.width() - 2;
-    
     if (WiFi.status() == WL_CONNECTED) {
-        tft.setTextColor(TFT_GREEN, TFT_BLACK);
+        state.wifi = DISPLAY_WIFI_CONNECTED;
         String ip = WiFi.localIP().toString();
-        if (ip == "0.0.0.0") {
-            tft.drawString("WIFI: BAGLI", wifiStatusX, 5, 1);
-        } else {
-            String label = "IP: " + ip;
-            tft.drawString(label.c_str(), wifiStatusX, 5, 1);
-        }
+        if (ip != "0.0.0.0") strlcpy(state.ip, ip.c_str(), sizeof(state.ip));
     } else if (isApMode) {
-        tft.setTextColor(TFT_MAGENTA, TFT_BLACK);
-        tft.drawString("MOD: SETUP", wifiStatusX, 5, 1);
-    } else {
-        tft.setTextColor(TFT_RED, TFT_BLACK);
-        tft.drawString("WIFI: YOK", wifiStatusX, 5, 1);
+        state.wifi = DISPLAY_WIFI_AP;
     }
-    tft.setTextDatum(TL_DATUM); // Sol üst köşe hizalamaya geri dön
-
-    tft.drawLine(0, 22, tft.width(), 22, TFT_DARKGREY);
-
-    if (batteryMonitorFound || mpptCount > 0) {
-        int row1_y = 30;
-        int row1_val_y = 45;
-        int col2_x = 130;
-
-        // Voltage
-        tft.setTextColor(TFT_LIGHTGREY, TFT_BLACK);
-        tft.setTextSize(1);
-        tft.setCursor(0, row1_y);
-        tft.print("AKU VOLTAJI");
-        
-        tft.setTextColor(TFT_WHITE, TFT_BLACK);
-        tft.setTextSize(3);
-        tft.setCursor(0, row1_val_y);
-        if (batteryMonitorFound) tft.printf("%.2fV", mainBatteryVoltage);
-        else tft.print("--.--V");
-
-        // Current
-        tft.setTextColor(TFT_LIGHTGREY, TFT_BLACK);
-        tft.setTextSize(1);
-        tft.setCursor(col2_x, row1_y);
-        tft.print("AKIM");
-        
-        tft.setTextSize(3);
-        tft.setCursor(col2_x, row1_val_y);
-        if (batteryMonitorFound) {
-             if (mainBatteryCurrent > 0) tft.setTextColor(TFT_GREEN, TFT_BLACK);
-             else tft.setTextColor(TFT_RED, TFT_BLACK);
-             tft.printf("%.1fA", mainBatteryCurrent);
-        } else {
-             tft.setTextColor(TFT_WHITE, TFT_BLACK);
-             tft.print("--.-A");
-        }
 
-        // SOC
-        int row2_y = 72;
-        tft.setTextColor(TFT_YELLOW, TFT_BLACK);
-        tft.setTextSize(2);
-        tft.setCursor(0, row2_y);
-        if (batteryMonitorFound) tft.printf("SOC: %.1f%%", mainBatterySoc);
-        else tft.print("SOC: --.-%");
-        
-        // SOC Bar
-        int barY = 96;
-        int barHeight = 15;
-        int barWidth = tft.width() - 4;
-        
-        tft.drawRect(0, barY, barWidth, barHeight, TFT_WHITE);
-        if (batteryMonitorFound) {
-            int fillWidth = (int)((mainBatterySoc / 100.0) * (barWidth - 4));
-            tft.fillRect(2, barY + 2, fillWidth, barHeight - 4, (mainBatterySoc > 50 ? TFT_GREEN : TFT_RED));
-        }
-
-        // Solar Info
-        int row3_y = 118;
-        if (mpptCount > 0) {
-            tft.setTextColor(TFT_ORANGE, TFT_BLACK);
-            tft.setTextSize(1);
-            tft.setCursor(0, row3_y);
-            tft.printf("PV: %.0fW", totalPvPower);
-            
-            // MPPT State - Yanına veya Altına
-            if (mainMpptState != -1) {
-                 tft.printf(" (%s)", getMpptStateName(mainMpptState));
-            }
-        }
-        
-        // TTG
-        tft.setTextColor(TFT_LIGHTGREY, TFT_BLACK);
-        tft.setTextSize(1);
-        tft.setCursor(130, row3_y); // Solar'ın yanına veya altına
-        if (batteryMonitorFound) {
-             if (mainBatteryRemaining == 0xFFFF || mainBatteryRemaining == -1) {
-                  tft.print("SURE: Sonsuz");
-             } else {
-                  tft.printf("SURE: %ddk", mainBatteryRemaining);
-             }
-        } else {
-             tft.print("SURE: --");
-        }
-
-    } else {
-        tft.setTextColor(TFT_ORANGE, TFT_BLACK);
-        tft.setTextSize(2);
-        tft.setCursor(40, 80);
-        tft.println("Veri Bekleniyor...");
-        
-        // --- DEBUG BILGISI ---
-        if (victronScanner.lastSeenDevice.length() > 0) {
-             tft.setTextSize(1);
-             tft.setTextColor(TFT_YELLOW, TFT_BLACK);
-             tft.setCursor(10, 165);
-             tft.printf("Son: %s", victronScanner.lastSeenDevice.c_str());
-        }
-        
-        if (victronScanner.lastError.length() > 0) {
-             tft.setTextSize(1);
-             tft.setTextColor(TFT_RED, TFT_BLACK);
-             tft.setCursor(10, 180);
-             tft.printf("Err: %s", victronScanner.lastError.c_str());
-        }
-        // ---------------------
-        
-        if (isApMode) {
-             tft.setTextSize(1);
-             tft.setCursor(20, 120);
-             tft.println("WiFi: VictronMonitor_Setup");
-             tft.setCursor(20, 135);
-             tft.print("IP: "); tft.println(WiFi.softAPIP());
-             tft.setCursor(20, 150);
-             tft.println("Lutfen ayarlari yapin.");
-             
-             if (lastWifiError.length() > 0) {
-                 tft.setTextColor(TFT_RED, TFT_BLACK);
-                 tft.setCursor(20, 165);
-                 tft.printf("Hata: %s", lastWifiError.c_str());
-             }
-        } else {
-             tft.setTextSize(1);
-             tft.setCursor(40, 120);
-             tft.println("Victron cihazi araniyor...");
-             tft.setCursor(40, 135);
-             tft.println("Lutfen cihazi yaklastirin.");
-        }
+    // Bekleme ekranı (DEBUG bilgisi dahil)
+    if (victronScanner.lastSeenMac != 0) {
+        strlcpy(state.lastSeen, victronScanner.getLastSeenDevice().c_str(), sizeof(state.lastSeen));
+    }
+    strlcpy(state.lastError, victronScanner.lastError, sizeof(state.lastError));
+    if (isApMode) {
+        strlcpy(state.apIp, WiFi.softAPIP().toString().c_str(), sizeof(state.apIp));
+        strlcpy(state.wifiError, lastWifiError.c_str(), sizeof(state.wifiError));
     }
+
+    // Sadece metni / rengi değişen alanlar panele gider (bkz. DisplayView.h)
+    displayView.render(state);
 }
 
 const char* wifiReasonToString(uint8_t reason) {
@@ -315,21 +165,25 @@ const char* wifiReasonToString(uint8_t reason) {
 }
 
 void WiFiEvent(WiFiEvent_t event, WiFiEventInfo_t info) {
-    Serial.printf("[WiFi-event] event: %d\n", event);
+    APP_LOGD("[WiFi-event] event: %d", event);
     switch(event) {
     case SYSTEM_EVENT_STA_GOT_IP:
-        Serial.println("WiFi Connected & Got IP");
+        APP_LOGI("WiFi Connected & Got IP");
+        bootMark(BOOT_PHASE_GOT_IP);
+        fastBootSaved = false; // Kira (yeni IP) loop'ta RTC'ye yazılır
         lastWifiError = ""; // Bağlanınca hatayı temizle
+        configTime(0, 0, "pool.ntp.org"); // Kuyruktaki ölçümlerin yaşı için
+        uplinkNotifyConnected(); // Bağlantı geri geldi: flash kuyruğu hemen boşaltılır
         break;
     case SYSTEM_EVENT_STA_DISCONNECTED:
-        Serial.printf("WiFi Disconnected (reason: %d - %s)\n", info.wifi_sta_disconnected.reason, wifiReasonToString(info.wifi_sta_disconnected.reason));
+        APP_LOGW("WiFi Disconnected (reason: %d - %s)", info.wifi_sta_disconnected.reason, wifiReasonToString(info.wifi_sta_disconnected.reason));
         lastWifiError = String(wifiReasonToString(info.wifi_sta_disconnected.reason));
         break;
     case SYSTEM_EVENT_STA_START:
-        Serial.println("WiFi Station Started");
+        APP_LOGD("WiFi Station Started");
         break;
     case SYSTEM_EVENT_STA_STOP:
-        Serial.println("WiFi Station Stopped");
+        APP_LOGD("WiFi Station Stopped");
         break;
     default:
         break;
@@ -368,18 +222,41 @@ void startAP() {
     Serial.println("DNS Sunucusu Baslatildi (Captive Portal)");
 }
 
+// WiFi bağlantısını bekler; beklerken BLE reklamları işlenir (tarama paralel)
+bool waitForWifi(unsigned long timeoutMs) {
+    unsigned long start = millis();
+    int dots = 0;
+    while (WiFi.status() != WL_CONNECTED && millis() - start < timeoutMs) {
+        victronScanner.update();
+        delay(50);
+        if ((millis() - start) / 500 > (unsigned long)dots) {
+            Serial.print(".");
+            tft.setCursor(10 + (dots * 5), 60);
+            tft.print(".");
+            dots++;
+        }
+    }
+    Serial.println();
+    if (WiFi.status() != WL_CONNECTED) return false;
+    bootMark(BOOT_PHASE_WIFI_CONNECTED);
+    return true;
+}
+
 void setup() {
   Serial.begin(115200);
   
   // WiFi Event Listener
   WiFi.onEvent(WiFiEvent);
-  delay(3000); // Wait for serial monitor
+#if BOOT_SERIAL_WAIT_MS > 0
+  delay(BOOT_SERIAL_WAIT_MS); // Seri monitörü bekle (sadece geliştirme)
+#endif
   Serial.println("\n\n--- SISTEM BASLATILIYOR ---");
   
   // Boot Düğmesi Ayarı
   pinMode(BOOT_BUTTON, INPUT_PULLUP);
 
   setupDisplay();
+  bootMark(BOOT_PHASE_DISPLAY);
 
   // BLE'yi Erken Başlat (WiFi Çakışmasını Önlemek İçin)
   // WiFi başlatılmadan önce BLE kaynaklarını rezerve ediyoruz
@@ -387,13 +264,33 @@ void setup() {
   
   // NVS'den Ayarları Oku (ConfigManager)
   loadConfig();
+  bootMark(BOOT_PHASE_CONFIG);
+
+  // Telemetri kuyruğu (LittleFS, "spiffs" bölümü). İlk açılışta biçimlendirilir.
+  if (LittleFS.begin(true)) {
+      telemetryQueue.begin((uint16_t)esp_random());
+  } else {
+      Serial.println("LittleFS baslatilamadi, telemetri kuyrugu devre disi!");
+  }
+  // Telemetri gönderimi ayrı task'te (loop ağ beklemez)
+  if (!uplinkBegin()) {
+      Serial.println("Uplink task'i baslatilamadi!");
+  }
+  bootMark(BOOT_PHASE_STORAGE);
   
   Serial.println("--- DEBUG: STARTUP CONFIG ---");
   Serial.println("SSID: " + config_ssid);
-  Serial.println("DevicesJSON Length: " + String(config_devicesJson.length()));
-  Serial.println("DevicesJSON Content: " + config_devicesJson);
+  Serial.printf("Kayitli cihaz: %u\n", (unsigned)config_devices.count);
   Serial.println("-----------------------------");
 
+  // Cihazlar ve BLE WiFi'den önce: tarama WiFi bağlanırken başlar.
+  // Kayıtlı cihazlar NVS ikili tablosundan (loadConfig), JSON parse yok.
+  applyDeviceTable(config_devices);
+  victronScanner.begin();
+  victronScanner.update(); // İlk BLE taraması (asenkron)
+  bootMark(BOOT_PHASE_BLE_READY);
+  Serial.println("BLE Baslatildi.");
+
   // WiFi Bağlantısı Dene
     if (config_ssid != "") {
         Serial.println("WiFi Baglaniyor...");
@@ -408,10 +305,15 @@ void setup() {
         tft.setCursor(10, 40);
         tft.printf("SSID: %s", config_ssid.c_str());
         
+        // Hızlı yol: son başarılı erişim noktasının kanalına tarama yapmadan bağlan.
+        // Yazılımsal yeniden başlatmada önceki DHCP kirası da kullanılır (FastBoot.h).
+        FastBootWifi fastWifi;
+        bool haveFastWifi = fastBootLoadWifi(config_ssid, fastWifi);
+
         WiFi.disconnect(true, true);  // Daha agresif temizlik
-        delay(500);
+        if (!haveFastWifi) delay(500);
         WiFi.mode(WIFI_STA);
-        delay(100);
+        if (!haveFastWifi) delay(100);
         WiFi.persistent(false);
         WiFi.setAutoReconnect(true);
         // WiFi.setSleep(false); // Bu satır kaldırıldı veya true yapıldı
@@ -423,37 +325,48 @@ void setup() {
         
         Serial.printf("SSID: %s, PASS: %s\n", config_ssid.c_str(), config_pass.c_str());
         
-        int targetChannel = 0;
-        Serial.println("Ag Taramasi Baslatiliyor...");
-        int n = WiFi.scanNetworks();
-        if (n > 0) {
-            for (int i = 0; i < n; ++i) {
-                if (WiFi.SSID(i) == config_ssid) {
-                    targetChannel = WiFi.channel(i);
-                    Serial.printf("HEDEF AG BULUNDU! Kanal: %d, RSSI: %d\n", targetChannel, WiFi.RSSI(i));
-                    break;
-                }
+        bool connected = false;
+        if (haveFastWifi) {
+            FastBootLease lease;
+            bool leaseReused = fastBootLoadLease(config_ssid, lease);
+            if (leaseReused) {
+                WiFi.config(IPAddress(lease.ip), IPAddress(lease.gateway), IPAddress(lease.mask), IPAddress(lease.dns));
+            }
+            Serial.printf("Hizli baglanti: kanal %d%s\n", fastWifi.channel, leaseReused ? " (onceki IP)" : "");
+            bootMark(BOOT_PHASE_WIFI_BEGIN);
+            WiFi.begin(config_ssid.c_str(), config_pass.c_str(), fastWifi.channel);
+            connected = waitForWifi(FAST_BOOT_ASSOC_TIMEOUT_MS);
+            bootNoteFastPath(true, connected, leaseReused && connected);
+            if (!connected) {
+                Serial.println("Hizli baglanti basarisiz, taramaya donuluyor...");
+                fastBootForget();
+                WiFi.disconnect();
+                if (leaseReused) fastBootUseDhcp();
             }
+            // Bağlandıysa önceki kira ilk uplink'e kadar kullanılır, sonra
+            // uplink task'i DHCP'ye geçer (fastBootLeaseTick).
         }
 
-        if (targetChannel > 0) {
-            Serial.printf("Hedef Kanal (%d) ile baglaniliyor...\n", targetChannel);
-            WiFi.begin(config_ssid.c_str(), config_pass.c_str(), targetChannel);
-        } else {
-            Serial.println("Hedef ag taramada bulunamadi, normal baglanti deneniyor...");
-            WiFi.begin(config_ssid.c_str(), config_pass.c_str());
-        }
+        if (!connected) {
+            // Tarama sonucu onbellege girer: kanal buradan, AP moduna dusulurse
+            // /api/wifi-scan ayni listeyi hemen gosterir. BSSID'e sabitlenmez
+            // (ayni SSID'li baska erisim noktasina gecebilsin).
+            uint8_t targetChannel = 0;
+            uint8_t targetBssid[6];
+            Serial.println("Ag Taramasi Baslatiliyor...");
+            wifiScanBlocking();
+            if (wifiScanFind(config_ssid, targetChannel, targetBssid)) {
+                Serial.printf("HEDEF AG BULUNDU! Kanal: %d\n", targetChannel);
+                Serial.printf("Hedef Kanal (%d) ile baglaniliyor...\n", targetChannel);
+                WiFi.begin(config_ssid.c_str(), config_pass.c_str(), targetChannel);
+            } else {
+                Serial.println("Hedef ag taramada bulunamadi, normal baglanti deneniyor...");
+                WiFi.begin(config_ssid.c_str(), config_pass.c_str());
+            }
         
-        int attempts = 0;
-        while (WiFi.status() != WL_CONNECTED && attempts < 20) { // 10 saniye (Süre kısaltıldı)
-            delay(500);
-            Serial.print(".");
-            tft.setCursor(10 + (attempts * 5), 60);
-            tft.print(".");
-            
-            attempts++;
+            bootMark(BOOT_PHASE_WIFI_BEGIN);
+            waitForWifi(10000); // 10 saniye (Süre kısaltıldı)
         }
-        Serial.println();
         
         if (WiFi.status() == WL_CONNECTED) {
             Serial.print("WiFi Baglandi. IP: ");
@@ -481,60 +394,47 @@ void setup() {
   // Web Sunucusunu Başlat (ConfigManager)
   setupWebServer();
   server.begin();
+  bootMark(BOOT_PHASE_WEB_READY);
 
-  // BLE Başlat (AP Modunda da çalışsın)
-    // Kayıtlı cihazları JSON'dan yükle
-    Serial.println("JSON Parse Ediliyor: " + config_devicesJson);
-    DynamicJsonDocument devicesDoc(4096);
-    DeserializationError error = deserializeJson(devicesDoc, config_devicesJson);
-    
-    if (!error) {
-        JsonArray devices = devicesDoc.as<JsonArray>();
-        Serial.printf("Kayitli %d cihaz yukleniyor...\n", devices.size());
-        
-        for (JsonObject d : devices) {
-            String mac = d["mac"].as<String>();
-            String key = d["key"].as<String>();
-            
-            Serial.printf("Cihaz Ekleme Deneniyor -> MAC: %s, Key: %s\n", mac.c_str(), key.c_str());
-            
-            if (mac.length() > 0 && key.length() > 0) {
-                victronScanner.addDevice(mac, key);
-            } else {
-                Serial.println("HATA: MAC veya Key bos!");
-            }
-        }
-    } else {
-        Serial.printf("JSON Parse Hatasi: %s\n", error.c_str());
-    }
-    
-    if (!isApMode) {
-        Serial.println("BLE Baslatiliyor... (1s bekleme)");
-        delay(1000);
-        victronScanner.begin();
-        Serial.println("BLE Baslatildi.");
-    } else {
-        Serial.println("AP Modu aktif, BLE cakismayi onlemek icin baslatilmadi.");
-    }
-  
   // Ekrana Son Durumu Bas
   Serial.println("Setup bitti. Ilk ekran guncellemesi...");
   updateDisplay();
+  bootMark(BOOT_PHASE_SETUP_DONE);
+}
+
+// Batch'i kapatıp uplink kuyruğuna verir; verildiyse snapshot'taki
+// [first, end) cihazlarının aralık örnekleri sıfırlanır ve değişim
+// dedektörüne gönderildi olarak yazılır. Verilemezse ikisi de dokunulmaz:
+// sonraki döngü aynı cihazları değişmiş sayıp yeniden gönderir.
+static bool submitTelemetryBatch(TelemetryEncoder& encoder, const uint8_t* body, size_t first, size_t end,
+                                 unsigned long now) {
+    uint8_t records = encoder.count();
+    size_t batchLen = encoder.finish();
+    if (batchLen == 0 || !uplinkSubmit(body, batchLen, telemetryEpoch(), now / 1000)) {
+        APP_LOGE("Telemetri uplink kuyruguna verilemedi");
+        return false;
+    }
+    for (size_t i = first; i < end; i++) {
+        const VictronData& data = loopSnapshot.devices[i];
+        float power = (data.power == 0 && data.voltage > 0) ? (data.voltage * data.current) : data.power;
+        victronScanner.resetSamples(data.mac);
+        changeDetector.commit(data, power, now);
+    }
+    APP_LOGD("Telemetri uplink kuyruguna verildi: %u kayit, %u byte", records, (unsigned)batchLen);
+    return true;
 }
 
 void sendTelemetry() {
-    if (WiFi.status() != WL_CONNECTED) return;
-    
     unsigned long now = millis();
     
     if (config_supabaseUrl == "" || config_secret == "") {
-        Serial.println("HATA: Supabase URL veya Secret eksik!");
+        APP_LOGE("HATA: Supabase URL veya Secret eksik!");
         return;
     }
 
-    std::map<String, VictronData> devices = victronScanner.getDevices();
-    if (devices.empty()) {
-        Serial.println("Gonderilecek cihaz verisi yok.");
+    victronScanner.getSnapshot(loopSnapshot);
+    if (loopSnapshot.count == 0) {
+        APP_LOGD("Gonderilecek cihaz verisi yok.");
         return;
     }
 
@@ -545,120 +445,77 @@ void sendTelemetry() {
     if (!firstPingSent) {
         shouldSend = true;
         firstPingSent = true;
-        Serial.println("ILK BAGLANTI (Initial Ping): Veri aninda gonderiliyor.");
+        APP_LOGI("ILK BAGLANTI (Initial Ping): Veri aninda gonderiliyor.");
     } 
     // Eğer 1 dakika (Heartbeat) dolmadıysa, kritik bir değişiklik var mı diye kontrol et
     else if (!isHeartbeat) {
         // En az 5 saniye bekle (Flood koruması)
         if (now - lastTelemeterySend < TELEMETRY_MIN_INTERVAL) return;
         
-        for (auto const& [mac, data] : devices) {
-            if (now - data.timestamp > 60000) continue; // Eski veriyi atla
+        for (size_t i = 0; i < loopSnapshot.count; i++) {
+            const VictronData& data = loopSnapshot.devices[i]; // Snapshot'ta sadece canlı (60 sn) kayıtlar
             
             float power = (data.power == 0 && data.voltage > 0) ? (data.voltage * data.current) : data.power;
             
-            // Kritik Değişim Şartları (Delta)
-            if (abs(data.voltage - lastSentVoltage[mac]) >= 0.2 ||     // 0.2V Voltaj değişimi
-                abs(data.soc - lastSentSoc[mac]) >= 1.0 ||             // %1 Şarj (SoC) değişimi
-                data.alarm != lastSentAlarm[mac] ||                    // Alarm durumu değişimi
-                abs(power - lastSentPower[mac]) >= 50.0                // 50W Güç değişimi
-            ) {
+            // Kritik Değişim: ölü bandı onaylı olarak aşan alan (voltaj, SoC, güç, alarm, durum).
+            // Sayaçlar her kontrolde ilerler, bu yüzden ilk değişimde döngüden çıkılmaz.
+            TelemetryField field;
+            if (changeDetector.check(data, power, now, &field) && !shouldSend) {
                 shouldSend = true;
-                Serial.printf("Kritik Degisim Algilandi: %s\n", mac.c_str());
-                break; // Bir cihazda bile değişim varsa tüm veriyi gönder
+                char macText[18];
+                formatMacAddress(data.mac, macText);
+                APP_LOGI("Kritik Degisim Algilandi: %s (%s)", macText, TELEMETRY_FIELDS[field].name);
             }
         }
     } else {
         shouldSend = true;
-        Serial.println("Heartbeat: 5 dakika doldu, periyodik veri gonderiliyor.");
+        APP_LOGI("Heartbeat: 1 dakika doldu, periyodik veri gonderiliyor.");
     }
 
     if (!shouldSend) return; // Göndermeye gerek yok
 
-    // JSON Oluştur (RPC Formatı: { \"payload\": [ ... ] })
-    DynamicJsonDocument doc(4096);
-    JsonArray measurements = doc.createNestedArray("payload");
-    
+    // İkili batch (bkz. TelemetryCodec.h). Uplink task'i bunu seçili formatta
+    // (JSON / deflate / ikili) gönderir, gönderemezse flash kuyruğuna yazar.
+    // Örnekli kayıt ~126 byte: batch dolunca gönderilir ve kalan cihazlarla
+    // yenisine geçilir, her gönderimde tüm cihazlar gider.
+    static uint8_t binaryBody[UPLINK_BATCH_MAX];
+    static DeviceSamples samples; // Aralık istatistiği + ham örnekler (bkz. TelemetrySamples.h)
+    TelemetryEncoder encoder(binaryBody, sizeof(binaryBody));
+    encoder.begin(config_boatId.c_str(), TELEMETRY_FLAG_SAMPLES);
+    size_t batchStart = 0; // Bu batch'in ilk cihazı (snapshot sırası)
     bool hasNewData = false;
+    bool submitted = false;
 
-    for (auto const& [mac, data] : devices) {
-        // Sadece son 1 dakika içinde güncellenen verileri gönder
-        if (now - data.timestamp > 60000) continue;
-        
-        hasNewData = true;
-        JsonObject m = measurements.createNestedObject();
-        
-        m["mac_address"] = mac; // Cihaz MAC adresi
-        m["boat_name"] = config_boatId; // Kullanıcının girdiği tekne adı (Device PIN)
+    for (size_t i = 0; i < loopSnapshot.count; i++) {
+        const VictronData& data = loopSnapshot.devices[i];
         
         // Power hesapla (Eğer yoksa)
         float power = (data.power == 0 && data.voltage > 0) ? (data.voltage * data.current) : data.power;
-        
-        // Supabase DB Column Names
-        m["voltage"] = data.voltage;
-        m["current"] = data.current;
-        m["power"] = power;
-        m["temperature"] = data.temperature;
-        m["alarm"] = data.alarm;
-        m["device_type"] = (int)data.type;
-        m["soc"] = data.soc;
-        m["pv_power"] = data.pvPower;
-        m["pv_voltage"] = data.pvVoltage;
-        m["pv_current"] = data.pvCurrent;
-        m["load_current"] = data.loadCurrent;
-        m["device_state"] = data.deviceState;
-        m["yield_today"] = data.yieldToday;
-        m["efficiency"] = data.efficiency;
-        m["consumed_ah"] = data.consumedAh;
-        m["remaining_mins"] = data.remainingMins;
-        m["aux_voltage"] = data.auxVoltage;
-        m["charge_state"] = data.chargeStateDesc;
-        m["load_state"] = data.loadState;
-        
-        // Son gönderilenleri hafızaya kaydet
-        lastSentVoltage[mac] = data.voltage;
-        lastSentSoc[mac] = data.soc;
-        lastSentAlarm[mac] = data.alarm;
-        lastSentPower[mac] = power;
+
+        // Örnekler burada sıfırlanmaz: batch kuyruğa girince (submitTelemetryBatch)
+        bool haveSamples = victronScanner.peekSamples(data.mac, samples);
+        if (!encoder.add(data, power, haveSamples ? &samples : nullptr, now)) {
+            if (encoder.count() > 0) {
+                submitted |= submitTelemetryBatch(encoder, binaryBody, batchStart, i, now);
+                encoder.begin(config_boatId.c_str(), TELEMETRY_FLAG_SAMPLES);
+                batchStart = i;
+            }
+            if (!encoder.add(data, power, haveSamples ? &samples : nullptr, now)) {
+                char macText[18];
+                formatMacAddress(data.mac, macText);
+                APP_LOGW("Telemetri kaydi bos batch'e sigmadi, %s atlandi", macText);
+                batchStart = i + 1;
+                continue;
+            }
+        }
+        hasNewData = true; // Değişim dedektörü batch kuyruğa girince güncellenir
     }
 
     if (!hasNewData) return;
+    changeDetector.expire(now);
 
-    lastTelemeterySend = now; // Gönderim zamanını güncelle
-
-    String payload;
-    serializeJson(doc, payload);
-    Serial.println("Gonderilen JSON: " + payload);
-
-    // URL Oluştur (Supabase RPC)
-    // Örnek: https://xxx.supabase.co/rest/v1/rpc/ingest_telemetry
-    String url = config_supabaseUrl;
-    if (url.endsWith("/")) url = url.substring(0, url.length() - 1);
-    url += "/rest/v1/rpc/ingest_telemetry";
-
-    // HTTP POST Gönder
-    HTTPClient http;
-    http.begin(url);
-    http.addHeader("Content-Type", "application/json");
-    
-    // Supabase REST API Headers
-    http.addHeader("apikey", config_secret);
-    http.addHeader("Authorization", String("Bearer ") + config_secret);
-    
-    // Supabase REST API insert için "Prefer: return=representation" diyebiliriz (cevap dönsün diye)
-    http.addHeader("Prefer", "return=representation");
-    
-    int httpResponseCode = http.POST(payload);
-    
-    if (httpResponseCode >= 200 && httpResponseCode < 300) {
-        Serial.printf("Telemetri Gonderildi: %d\n", httpResponseCode);
-        Serial.println("Sunucu Cevabi: " + http.getString());
-    } else {
-        Serial.printf("Telemetri Hatasi: %d (WiFi IP: %s)\n", httpResponseCode, WiFi.localIP().toString().c_str());
-        Serial.println("Sunucu Cevabi: " + http.getString());
-    }
-    
-    http.end();
+    if (encoder.count() > 0) submitted |= submitTelemetryBatch(encoder, binaryBody, batchStart, loopSnapshot.count, now);
+    if (submitted) lastTelemeterySend = now;
 }
 
 // Buton Zamanlayıcısı
@@ -666,29 +523,33 @@ unsigned long bootBtnTimer = 0;
 bool bootBtnPressed = false;
 
 void loop() {
+  unsigned long loopStartUs = micros();
+
   // Boot Butonu Kontrolü (5 sn basılı tutulursa resetle)
   // BOOT_BUTTON genellikle GPIO 0'dır ve pull-up direnci vardır.
   // Basılınca LOW olur. Ancak bazı boardlarda farklı olabilir.
   // Debug için buton durumunu sürekli okuyalım.
   
+#if APP_LOG_LEVEL >= APP_LOG_VERBOSE
   static unsigned long lastButtonDebug = 0;
   if (millis() - lastButtonDebug > 1000) {
-      Serial.printf("DEBUG: Boot Button Status: %d\n", digitalRead(BOOT_BUTTON));
+      APP_LOGV("DEBUG: Boot Button Status: %d", digitalRead(BOOT_BUTTON));
       lastButtonDebug = millis();
   }
+#endif
 
   if (digitalRead(BOOT_BUTTON) == LOW) {
       if (!bootBtnPressed) {
           bootBtnPressed = true;
           bootBtnTimer = millis();
-          Serial.println("Boot butonuna basildi...");
+          APP_LOGI("Boot butonuna basildi...");
       } else {
           // Basılı tutuluyor
           unsigned long pressDuration = millis() - bootBtnTimer;
           
           // Ekrana geri sayım bas (Her 1 saniyede bir)
           if (pressDuration > 1000 && pressDuration % 1000 < 50) {
-               Serial.printf("Basili Sure: %lu ms\n", pressDuration);
+               APP_LOGD("Basili Sure: %lu ms", pressDuration);
           }
 
           if (pressDuration > 3000) {
@@ -700,7 +561,7 @@ void loop() {
               tft.setCursor(10, 90);
               tft.println("ACILIYOR...");
               
-              Serial.println("Boot butonuna basildi. AP Moduna geciliyor...");
+              APP_LOGI("Boot butonuna basildi. AP Moduna geciliyor...");
               
               // Buton bırakılana kadar bekle
               while(digitalRead(BOOT_BUTTON) == LOW) { delay(100); }
@@ -709,17 +570,30 @@ void loop() {
               
               bootBtnPressed = false;
               bootBtnTimer = 0;
+              displayView.invalidate(); // AP ekranı doğrudan çizildi
               updateDisplay();
           }
       }
   } else {
       if (bootBtnPressed) {
-          Serial.println("Boot butonu birakildi.");
+          APP_LOGI("Boot butonu birakildi.");
       }
       bootBtnPressed = false;
       bootBtnTimer = 0;
   }
 
+  // /save ile kaydedilen ayarlar: yeniden başlatmadan uygulanır
+  if (applyPendingConfig()) {
+      Serial.println("WiFi ayarlari degisti, yeni aga baglaniliyor...");
+      WiFi.disconnect();
+      fastBootUseDhcp(); // Eski ağın sabit IP'si kalmasın
+      WiFi.begin(config_ssid.c_str(), config_pass.c_str());
+      apTimeout = millis(); // AP modunda 30 sn sonra tekrar denenir
+  }
+
+  // Arka plan WiFi taraması (/api/wifi-scan isteği)
+  wifiScanLoop();
+
   // Captive Portal DNS İsteklerini İşle
   if (isApMode) {
       dnsServer.processNextRequest();
@@ -732,26 +606,47 @@ void loop() {
           isApMode = false;
       } else if (millis() - apTimeout > 30000) {
           apTimeout = millis();
+          fastBootUseDhcp();
           WiFi.begin(config_ssid.c_str(), config_pass.c_str());
       }
   }
   
-  // BLE güncelle (Her zaman)
-  if (!isApMode) {
-      victronScanner.update();
+  // BLE güncelle (Her zaman, AP modunda da): tarama WiFi'den önce başlar ve
+  // durmaz; kuyruk burada boşalmazsa her reklam düşer.
+  // Uplink istekleri WiFi yükü sayılır: yoğunken BLE görev oranı sınırlanır
+  static uint32_t lastUplinkRequests = 0;
+  uint32_t uplinkRequests = uplinkClient.stats().requests;
+  if (uplinkRequests != lastUplinkRequests) {
+      victronScanner.noteWifiTx(uplinkRequests - lastUplinkRequests);
+      lastUplinkRequests = uplinkRequests;
+  }
+  victronScanner.update();
+  if (victronScanner.getDecodeCount() > 0) bootMark(BOOT_PHASE_FIRST_ADVERT);
+
+  // Hızlı açılış: bağlantı / yeni IP başına bir kez erişim noktası + kira
+  // kaydedilir (sabit kiradan DHCP'ye geçince yeni kira yazılsın)
+  if (!isApMode && WiFi.status() == WL_CONNECTED) {
+      if (!fastBootSaved) {
+          fastBootSaved = true;
+          fastBootRemember(config_ssid);
+      }
+  } else {
+      fastBootSaved = false;
   }
 
   // Ekranı Güncelle
   updateDisplay();
 
-  // Telemetri Gönderimi (Sadece WiFi bağlıysa)
-  if (millis() - lastTelemeterySend > TELEMETRY_INTERVAL) {
-    if (WiFi.status() == WL_CONNECTED) {
-        Serial.println("Veri Buluta Gonderiliyor...");
-        sendTelemetry();
-    }
-    lastTelemeterySend = millis();
+  // Web paneline canlı itme (SSE): sadece değişen cihazlar, hız sınırlı
+  pushLiveData(loopSnapshot);
+
+  // Telemetri: heartbeat / kritik değişim kararı sendTelemetry'de verilir.
+  // Gönderim (ve WiFi yokken flash kuyruğu) uplink task'inde, burada ağ beklenmez.
+  if (millis() - lastTelemetryCheck >= TELEMETRY_MIN_INTERVAL) {
+    lastTelemetryCheck = millis();
+    sendTelemetry();
   }
-  
+
+  metricsLoopTick(micros() - loopStartUs); // /api/metrics (bekleme haric)
   delay(10);
 }
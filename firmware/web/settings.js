@@ -0,0 +1,162 @@
+// Ayarlar sekmesi: index.html ilk açılışta bu dosyayı yükler (loadSettingsAsset).
+// Form #settings içine yazılır; fonksiyonlar formun onclick/onsubmit'inden çağrılır.
+
+document.getElementById('settings').innerHTML = `
+  <div class="device-card">
+    <h2 style="margin-top:0; font-size:1.2rem;">Kurulum Ayarları</h2>
+    <form id="settingsForm" action="/save" method="POST" onsubmit="return submitForm(event)">
+      <div class="form-group">
+        <label for="ssid">WiFi Adı (SSID) <button type="button" onclick="scanWifi()" style="float:right; background:none; border:none; color:var(--primary); cursor:pointer; font-size:0.8rem;">Ağları Tara 🔄</button></label>
+        <div style="display:flex; gap:0.5rem;">
+            <select id="ssid_select" onchange="document.getElementById('ssid').value = this.value" style="width:50%; padding:0.75rem; border:1px solid #d1d5db; border-radius:6px; background:white;">
+                <option value="">Ağ seçin...</option>
+            </select>
+            <input type="text" id="ssid" name="ssid" placeholder="veya buraya yazın" required style="width:50%;">
+        </div>
+      </div>
+      <div class="form-group">
+        <label for="pass">WiFi Şifresi</label>
+        <input type="password" id="pass" name="pass" placeholder="WiFi Şifresi">
+      </div>
+      <div class="form-group">
+        <label for="boatId">Cihaz Şifresi (Device PIN)</label>
+        <input type="text" id="boatId" name="boatId" placeholder="Örn: 6A9B-K2" required>
+        <small style="color:#6b7280; display:block; margin-top:0.25rem;">Web panelinden aldığınız kısa PIN kodunu girin.</small>
+      </div>
+      <div class="form-group">
+        <label for="uplinkFormat">Veri Gönderim Formatı</label>
+        <select id="uplinkFormat" name="uplinkFormat" style="width:100%; padding:0.75rem; border:1px solid #d1d5db; border-radius:6px; background:white;">
+            <option value="0">JSON (varsayılan)</option>
+            <option value="1">JSON + Deflate (sıkıştırılmış)</option>
+            <option value="2">Kompakt İkili (en az veri)</option>
+        </select>
+        <small style="color:#6b7280; display:block; margin-top:0.25rem;">Kotalı 4G bağlantılarda sıkıştırılmış veya ikili format veri kullanımını azaltır. Sunucuda ingest-compact fonksiyonu kurulu olmalı.</small>
+      </div>
+
+      <hr style="border:0; border-top:1px solid #e5e7eb; margin: 1.5rem 0;">
+
+      <h3 style="font-size:1rem; margin-bottom:0.5rem;">Cihaz Listesi</h3>
+      <div id="addedDevicesList" style="margin-bottom: 1rem;">
+         <!-- Eklenen cihazlar buraya gelecek -->
+      </div>
+
+      <div class="device-input-group">
+        <h4 style="margin:0 0 0.5rem 0; font-size:0.9rem;">Yeni Cihaz Ekle</h4>
+        <div class="form-group">
+            <label>MAC Adresi</label>
+            <input type="text" id="newMac" placeholder="aa:bb:cc:dd:ee:ff">
+        </div>
+        <div class="form-group">
+            <label>Encryption Key</label>
+            <input type="text" id="newKey" placeholder="32 karakterlik hex anahtar">
+        </div>
+        <button type="button" class="btn-secondary" onclick="addDevice()">Listeye Ekle</button>
+      </div>
+
+      <!-- Gizli input: JSON string olarak cihazları tutacak -->
+      <input type="hidden" id="devicesJson" name="devices">
+
+      <button type="submit" class="save-btn">Kaydet</button>
+    </form>
+  </div>
+`;
+
+let devices = [];
+
+// Sunucu önbellekten hemen cevap verir; tarama sürüyorsa bitene kadar tekrar sorulur
+let scanTimer = null;
+function scanWifi(refresh = true, attempt = 0) {
+    const select = document.getElementById('ssid_select');
+    if (attempt === 0) {
+        clearTimeout(scanTimer);
+        select.innerHTML = '<option value="">Taranıyor...</option>';
+    }
+    fetch('/api/wifi-scan' + (refresh && attempt === 0 ? '?refresh=1' : ''))
+    .then(res => res.json())
+    .then(data => {
+        if (data.scanning && attempt < 15) {
+            scanTimer = setTimeout(() => scanWifi(false, attempt + 1), 1000);
+            if (data.networks.length === 0) return;
+        }
+        if(data.networks.length === 0) {
+            select.innerHTML = '<option value="">Ağ bulunamadı</option>';
+            return;
+        }
+
+        // Ağlar SSID'e göre tekil, güçlüden zayıfa sıralı gelir
+        const current = select.value;
+        let html = '<option value="">Ağ seçin...</option>';
+        data.networks.forEach(net => {
+            html += `<option value="${net.ssid}">${net.ssid} (${net.rssi} dBm, K${net.channel})</option>`;
+        });
+        select.innerHTML = html;
+        select.value = current;
+    })
+    .catch(err => {
+        console.error('WiFi tarama hatası:', err);
+        select.innerHTML = '<option value="">Tarama başarısız</option>';
+    });
+}
+
+function loadSettings() {
+    fetch('/api/config')
+    .then(res => res.json())
+    .then(data => {
+        document.getElementById('ssid').value = data.ssid || '';
+        document.getElementById('boatId').value = data.boatId || '';
+        document.getElementById('uplinkFormat').value = String(data.uplinkFormat || 0);
+        devices = data.devices || [];
+        renderDeviceList();
+        scanWifi(false); // Sayfa açılınca: önbellek eskiyse taranır
+    })
+    .catch(err => console.error('Ayar okuma hatasi:', err));
+}
+
+function addDevice() {
+    const mac = document.getElementById('newMac').value.trim();
+    const key = document.getElementById('newKey').value.trim();
+
+    if(!mac || !key) {
+        alert('MAC ve Key alanları boş olamaz!');
+        return;
+    }
+
+    devices.push({ mac: mac, key: key });
+    renderDeviceList();
+
+    document.getElementById('newMac').value = '';
+    document.getElementById('newKey').value = '';
+}
+
+function removeDevice(index) {
+    devices.splice(index, 1);
+    renderDeviceList();
+}
+
+function renderDeviceList() {
+    const list = document.getElementById('addedDevicesList');
+    if(devices.length === 0) {
+        list.innerHTML = '<div style="color:#9ca3af; font-style:italic;">Henüz cihaz eklenmemiş.</div>';
+        return;
+    }
+
+    let html = '';
+    devices.forEach((d, i) => {
+        html += `
+            <div class="added-device">
+                <div>
+                    <div style="font-weight:600;">${d.mac}</div>
+                    <div style="font-size:0.75rem; color:#6b7280;">Key: ${d.key.substring(0,6)}...</div>
+                </div>
+                <button type="button" class="btn-danger" onclick="removeDevice(${i})">Sil</button>
+            </div>
+        `;
+    });
+    list.innerHTML = html;
+}
+
+function submitForm(e) {
+    // Cihaz listesini JSON string'e çevirip gizli input'a ata
+    document.getElementById('devicesJson').value = JSON.stringify(devices);
+    return true;
+}
@@ -0,0 +1,120 @@
+"""
+Supabase uplink'i icin yerel HTTPS stand-in sunucusu.
+
+Firmware'in UplinkClient'i (keep-alive, DNS onbellegi) bu sunucuya karsi
+denenebilir: her istek icin baglanti numarasi, o baglantidaki istek sirasi,
+TLS oturumunun yeniden kullanilip kullanilmadigi ve govde boyutu yazilir.
+Cevap kisa bir onaydir ({"success": true}).
+
+Kullanim:
+    python3 scripts/uplink_standin.py --port 8443
+    # Firmware'de config_supabaseUrl = "https://<bilgisayar-ip>:8443"
+    # TLS'siz deneme icin: --plain  (config_supabaseUrl = "http://...")
+    # Bosta kalan baglantiyi kapatmayi denemek icin: --idle-timeout 30
+
+Sertifika verilmezse openssl ile gecici self-signed sertifika uretilir
+(firmware sertifikayi dogrulamaz, bkz. UplinkClient.h).
+"""
+
+import argparse
+import itertools
+import json
+import os
+import ssl
+import subprocess
+import tempfile
+import time
+import zlib
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+
+connection_ids = itertools.count(1)
+
+
+class Handler(BaseHTTPRequestHandler):
+    protocol_version = "HTTP/1.1"  # keep-alive
+
+    def setup(self):
+        super().setup()
+        self.connection_id = next(connection_ids)
+        self.request_no = 0
+        self.connected_at = time.time()
+        if self.server.idle_timeout:
+            self.request.settimeout(self.server.idle_timeout)
+        reused = getattr(self.request, "session_reused", None)
+        print(f"[baglanti {self.connection_id}] {self.client_address[0]} acildi (tls oturum devami: {reused})")
+
+    def finish(self):
+        super().finish()
+        print(f"[baglanti {self.connection_id}] kapandi ({self.request_no} istek, "
+              f"{time.time() - self.connected_at:.1f} sn)")
+
+    def do_POST(self):
+        self.request_no += 1
+        length = int(self.headers.get("Content-Length", "0"))
+        body = self.rfile.read(length)
+        encoding = self.headers.get("Content-Encoding", "")
+        content_type = self.headers.get("Content-Type", "")
+
+        detail = ""
+        try:
+            raw = zlib.decompress(body) if encoding == "deflate" else body
+            if content_type.startswith("application/json"):
+                rows = json.loads(raw).get("payload", [])
+                aged = sum(1 for r in rows if "age_s" in r)
+                detail = f"{len(rows)} satir, {aged} gecikmeli"
+            else:
+                detail = f"ikili {len(raw)} byte"
+        except (zlib.error, ValueError) as exc:
+            detail = f"cozulemedi: {exc}"
+
+        print(f"[baglanti {self.connection_id} #{self.request_no}] POST {self.path} "
+              f"{length} byte {encoding or '-'} {content_type} prefer={self.headers.get('Prefer', '-')} | {detail}")
+
+        ack = b'{"success":true}'
+        self.send_response(200)
+        self.send_header("Content-Type", "application/json")
+        self.send_header("Content-Length", str(len(ack)))
+        self.end_headers()
+        self.wfile.write(ack)
+
+    def log_message(self, fmt, *args):
+        pass
+
+
+def make_cert(directory):
+    cert = os.path.join(directory, "standin.crt")
+    key = os.path.join(directory, "standin.key")
+    subprocess.run(["openssl", "req", "-x509", "-newkey", "rsa:2048", "-nodes", "-days", "7",
+                    "-subj", "/CN=uplink-standin", "-keyout", key, "-out", cert],
+                   check=True, capture_output=True)
+    return cert, key
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Yerel uplink stand-in sunucusu")
+    parser.add_argument("--port", type=int, default=8443)
+    parser.add_argument("--cert")
+    parser.add_argument("--key")
+    parser.add_argument("--plain", action="store_true", help="TLS olmadan dinle")
+    parser.add_argument("--idle-timeout", type=float, default=0,
+                        help="Bosta kalan baglantiyi bu kadar saniye sonra kapat")
+    args = parser.parse_args()
+
+    server = ThreadingHTTPServer(("0.0.0.0", args.port), Handler)
+    server.idle_timeout = args.idle_timeout
+
+    if not args.plain:
+        cert, key = args.cert, args.key
+        if not cert:
+            cert, key = make_cert(tempfile.mkdtemp())
+        context = ssl.SSLContext(ssl.PROTOCOL_TLS_SERVER)
+        context.load_cert_chain(cert, key)
+        server.socket = context.wrap_socket(server.socket, server_side=True)
+
+    scheme = "http" if args.plain else "https"
+    print(f"Dinleniyor: {scheme}://0.0.0.0:{args.port}")
+    server.serve_forever()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,190 @@
+// Firmware ikili telemetri formatının çözücüsü (sürüm 1).
+// Düzen firmware/src/TelemetryCodec.h, çıktı TelemetryDecoder.cpp'deki
+// telemetryToJson() ile aynı: ingest_telemetry satırları. Alan tablosu veya
+// zarf değişirse ikisi birlikte güncellenmeli.
+
+const MAGIC_0 = 0x56 // 'V'
+const MAGIC_1 = 0x54 // 'T'
+const FORMAT_VERSION = 1
+const FLAG_AGE = 0x01
+const FLAG_SAMPLES = 0x02
+
+// TELEMETRY_FIELDS: kolon adı, ölçek, tamsayı mı, varsayılan (bitmap'te yoksa)
+const FIELDS: [string, number, boolean, number][] = [
+  ['voltage', 0.01, false, 0],
+  ['current', 0.001, false, 0],
+  ['power', 0.1, false, 0],
+  ['temperature', 0.1, false, -999],
+  ['alarm', 1, true, 0],
+  ['soc', 0.1, false, 0],
+  ['pv_power', 1, false, 0],
+  ['pv_voltage', 0.01, false, 0],
+  ['pv_current', 0.1, false, 0],
+  ['load_current', 0.1, false, 0],
+  ['device_state', 1, true, 0],
+  ['yield_today', 0.01, false, 0],
+  ['efficiency', 0.1, false, 0],
+  ['consumed_ah', 0.1, false, 0],
+  ['remaining_mins', 1, true, 0],
+  ['aux_voltage', 0.01, false, 0],
+  ['load_state', 1, true, 0],
+]
+const TF_ALARM = 4
+const TF_DEVICE_STATE = 10
+
+// TELEMETRY_SAMPLE_METRICS: interval_stats anahtarı, ölçeği veren alan
+const SAMPLE_METRICS: [string, number][] = [
+  ['voltage', 0],
+  ['current', 1],
+  ['power', 2],
+  ['pv_power', 6],
+]
+const SM_VOLTAGE = 0
+const SM_PV_POWER = 3
+
+// Durum kodu olmayan kayıt tipleri (BATTERY_MONITOR, SMART_LITHIUM, LYNX_BMS,
+// DC_ENERGY_METER, SMART_BATTERY_SENSE, UNKNOWN): charge_state boş gider
+const NO_DEVICE_STATE = new Set([0x02, 0x05, 0x0A, 0x0D, 0x20, 0xFF])
+
+// victronStateName()
+const STATE_NAMES: Record<number, string> = {
+  0: 'Off', 1: 'Low Power', 2: 'Fault', 3: 'Bulk', 4: 'Absorption', 5: 'Float',
+  6: 'Storage', 7: 'Equalize', 9: 'Inverting', 11: 'Power Supply', 245: 'WakeUp',
+  246: 'Repeated Absorption', 247: 'Auto Equalize', 248: 'BatterySafe', 252: 'Ext.Control',
+}
+
+export class DecodeError extends Error {}
+
+class Reader {
+  pos = 0
+  constructor(private data: Uint8Array) {}
+
+  byte(): number {
+    if (this.pos >= this.data.length) throw new DecodeError('Eksik veri')
+    return this.data[this.pos++]
+  }
+
+  varint(): number {
+    let value = 0
+    for (let shift = 0; shift < 35; shift += 7) {
+      const b = this.byte()
+      value += (b & 0x7F) * 2 ** shift
+      if (!(b & 0x80)) return value % 2 ** 32 // Firmware gibi uint32
+    }
+    throw new DecodeError('Bozuk varint')
+  }
+
+  // zigzag, sabit nokta
+  fixed(scale: number): number {
+    const zz = this.varint()
+    return ((zz >>> 1) ^ -(zz & 1)) * scale
+  }
+}
+
+function decimalsFor(scale: number): number {
+  if (scale >= 1) return 0
+  if (scale >= 0.1) return 1
+  if (scale >= 0.01) return 2
+  return 3
+}
+
+// Firmware JSON'undaki "%.*f" ile aynı yuvarlama
+function round(value: number, scale: number): number {
+  return Number(value.toFixed(decimalsFor(scale)))
+}
+
+function metricScale(metric: number): number {
+  return FIELDS[SAMPLE_METRICS[metric][1]][1]
+}
+
+function hex2(value: number): string {
+  return value.toString(16).padStart(2, '0')
+}
+
+// Aralık bloğu -> min/max kolonları + "interval_stats"
+function readSamples(r: Reader, row: Record<string, unknown>) {
+  const stats: Record<string, unknown> = {}
+  const statsMask = r.byte()
+  if (statsMask >> SAMPLE_METRICS.length) throw new DecodeError('Bilinmeyen metrik')
+  for (let m = 0; m < SAMPLE_METRICS.length; m++) {
+    if (!(statsMask & (1 << m))) continue
+    const scale = metricScale(m)
+    const n = r.varint()
+    const min = round(r.fixed(scale), scale)
+    const max = round(r.fixed(scale), scale)
+    const avg = round(r.fixed(scale), scale)
+    stats[SAMPLE_METRICS[m][0]] = { n, min, max, avg }
+    if (m === SM_VOLTAGE) {
+      row.min_battery_voltage = min
+      row.max_battery_voltage = max
+    }
+    if (m === SM_PV_POWER) row.max_pv_power = max
+  }
+
+  const rawMask = r.byte()
+  if (rawMask >> SAMPLE_METRICS.length) throw new DecodeError('Bilinmeyen metrik')
+  if (rawMask !== 0) {
+    const count = r.byte()
+    const samples: Record<string, number[]> = { age_ms: [] }
+    for (let m = 0; m < SAMPLE_METRICS.length; m++) {
+      if (rawMask & (1 << m)) samples[SAMPLE_METRICS[m][0]] = []
+    }
+    for (let i = 0; i < count; i++) {
+      samples.age_ms.push(r.varint() * 100)
+      for (let m = 0; m < SAMPLE_METRICS.length; m++) {
+        if (rawMask & (1 << m)) samples[SAMPLE_METRICS[m][0]].push(round(r.fixed(metricScale(m)), metricScale(m)))
+      }
+    }
+    if (count > 0) stats.samples = samples
+  }
+
+  if (statsMask !== 0 || rawMask !== 0) row.interval_stats = stats
+}
+
+// Tek zarf; satırlar rows'a eklenir
+function decodeEnvelope(r: Reader, rows: Record<string, unknown>[]) {
+  if (r.byte() !== MAGIC_0 || r.byte() !== MAGIC_1) throw new DecodeError('Zarf başlığı yok')
+  if (r.byte() !== FORMAT_VERSION) throw new DecodeError('Bilinmeyen sürüm')
+  const flags = r.byte()
+  if (flags & ~(FLAG_AGE | FLAG_SAMPLES)) throw new DecodeError('Bilinmeyen bayrak')
+  const ageSeconds = (flags & FLAG_AGE) ? r.varint() : -1
+
+  const nameLen = r.byte()
+  const nameBytes: number[] = []
+  for (let i = 0; i < nameLen; i++) nameBytes.push(r.byte())
+  const boatName = new TextDecoder().decode(new Uint8Array(nameBytes))
+
+  const count = r.byte()
+  for (let n = 0; n < count; n++) {
+    const mac: string[] = []
+    for (let i = 0; i < 6; i++) mac.push(hex2(r.byte()))
+    const deviceType = r.byte()
+    const row: Record<string, unknown> = { mac_address: mac.join(':'), boat_name: boatName }
+
+    const bitmap = r.varint()
+    if (bitmap >= 2 ** FIELDS.length) throw new DecodeError('Bilinmeyen alan')
+    let deviceState = 0
+    for (let f = 0; f < FIELDS.length; f++) {
+      const [name, scale, isInt, defaultValue] = FIELDS[f]
+      let value = defaultValue
+      if (bitmap & (1 << f)) value = r.fixed(scale)
+      row[name] = isInt ? Math.trunc(value) : round(value, scale)
+      if (f === TF_ALARM) row.device_type = deviceType
+      if (f === TF_DEVICE_STATE) deviceState = Math.trunc(value)
+    }
+
+    row.charge_state = NO_DEVICE_STATE.has(deviceType) ? '' : (STATE_NAMES[deviceState] ?? 'Unknown')
+    if (flags & FLAG_SAMPLES) readSamples(r, row)
+    if (ageSeconds >= 0) row.age_s = ageSeconds
+    rows.push(row)
+  }
+}
+
+// Gövde arka arkaya zarflardan oluşur (flash kuyruğu boşaltma); biri bozuksa hepsi reddedilir
+export function decodeTelemetry(data: Uint8Array): Record<string, unknown>[] {
+  if (data.length === 0) throw new DecodeError('Boş gövde')
+  const r = new Reader(data)
+  const rows: Record<string, unknown>[] = []
+  while (r.pos < data.length) decodeEnvelope(r, rows)
+  return rows
+}
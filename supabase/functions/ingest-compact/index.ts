@@ -0,0 +1,74 @@
+import { serve } from "https://deno.land/std@0.168.0/http/server.ts"
+import { createClient } from "https://esm.sh/@supabase/supabase-js@2"
+import { decodeTelemetry, DecodeError } from "./decode.ts"
+
+// Firmware'in kotalı bağlantılar için kompakt uplink formatları
+// (firmware/src/Uplink.cpp, TELEMETRY_COMPACT_PATH):
+//   - application/json + Content-Encoding: deflate -> {"payload":[...]} (zlib)
+//   - application/x-victron-telemetry              -> ikili zarflar (decode.ts)
+// İkisi de ingest_telemetry satırlarına açılıp aynı RPC'ye iletilir; age_s
+// geri tarihleme ve aralık kolonları orada işlenir.
+//
+// Cevap kodları firmware'de anlam taşır: 4xx (408/429 hariç) kalıcı red,
+// kayıt atılır; 5xx tekrar denenir ve flash kuyruğunda bekler.
+
+const corsHeaders = {
+  'Access-Control-Allow-Origin': '*',
+  'Access-Control-Allow-Headers': 'authorization, x-client-info, apikey, content-type, content-encoding',
+}
+
+const BINARY_TYPE = 'application/x-victron-telemetry'
+
+function reply(body: unknown, status = 200) {
+  return new Response(JSON.stringify(body), {
+    status,
+    headers: { ...corsHeaders, 'Content-Type': 'application/json' },
+  })
+}
+
+async function inflate(data: Uint8Array): Promise<Uint8Array> {
+  // Ara katman açmış olabilir: zlib akışı JSON/ikili zarf ile başlamaz
+  if (data.length > 0 && (data[0] === 0x7B || data[0] === 0x56)) return data
+  const stream = new Blob([data]).stream().pipeThrough(new DecompressionStream('deflate'))
+  return new Uint8Array(await new Response(stream).arrayBuffer())
+}
+
+serve(async (req) => {
+  if (req.method === 'OPTIONS') {
+    return new Response('ok', { headers: corsHeaders })
+  }
+
+  let rows: unknown
+  try {
+    let body = new Uint8Array(await req.arrayBuffer())
+    if ((req.headers.get('content-encoding') ?? '').toLowerCase() === 'deflate') {
+      body = await inflate(body)
+    }
+
+    const contentType = (req.headers.get('content-type') ?? '').toLowerCase()
+    if (contentType.startsWith(BINARY_TYPE)) {
+      rows = decodeTelemetry(body)
+    } else {
+      const { payload } = JSON.parse(new TextDecoder().decode(body))
+      if (!Array.isArray(payload)) throw new DecodeError('"payload" dizisi bekleniyor')
+      rows = payload
+    }
+  } catch (error) {
+    // Bozuk gövde: tekrar gönderilse de çözülemez
+    return reply({ success: false, error: error.message }, 400)
+  }
+
+  try {
+    const supabaseClient = createClient(
+      Deno.env.get('SUPABASE_URL') ?? '',
+      Deno.env.get('SUPABASE_SERVICE_ROLE_KEY') ?? ''
+    )
+
+    const { data, error } = await supabaseClient.rpc('ingest_telemetry', { payload: rows })
+    if (error) throw error
+
+    return reply(data)
+  } catch (error) {
+    return reply({ success: false, error: error.message }, 500)
+  }
+})
@@ -0,0 +1,91 @@
+-- Firmware flash kuyruğu (gecikmeli gönderim) ve aralık istatistikleri.
+-- database/update_schema_v3.sql + update_ingest.sql ile aynı değişiklik; tekne eşlemesi 001 gibi MAC ile.
+
+-- Aralık istatistikleri (firmware TELEMETRY_FLAG_SAMPLES): min/max kolonları 001'de var
+ALTER TABLE public.telemetry ADD COLUMN IF NOT EXISTS interval_stats JSONB;
+
+-- RPC Fonksiyonu: Telemetri Verisini İşle (Otomatik Tekne Kaydı ile)
+-- 001'e göre: gecikmeli ölçüm (age_s) ölçüm zamanıyla, aralık istatistikleri
+-- interval_stats ile kaydedilir.
+CREATE OR REPLACE FUNCTION public.ingest_telemetry(payload JSONB)
+RETURNS JSONB
+LANGUAGE plpgsql
+SECURITY DEFINER
+AS $$
+DECLARE
+    measurement JSONB;
+    boat_uuid UUID;
+    _mac_address TEXT;
+    _boat_name TEXT;
+    result_ids BIGINT[];
+BEGIN
+    -- Gelen JSON array içindeki her ölçümü işle
+    FOR measurement IN SELECT * FROM jsonb_array_elements(payload)
+    LOOP
+        _mac_address := measurement->>'mac_address';
+        _boat_name := COALESCE(measurement->>'boat_name', 'Unknown Boat');
+
+        -- 1. Tekneyi Bul veya Oluştur (MAC Adresine Göre)
+        IF _mac_address IS NOT NULL THEN
+            SELECT id INTO boat_uuid FROM public.boats WHERE mac_address = _mac_address;
+            
+            IF boat_uuid IS NULL THEN
+                INSERT INTO public.boats (name, mac_address)
+                VALUES (_boat_name, _mac_address)
+                RETURNING id INTO boat_uuid;
+            END IF;
+        ELSE
+            -- MAC adresi yoksa, boat_id ile dene (Eski uyumluluk)
+            boat_uuid := (measurement->>'boat_id')::UUID;
+        END IF;
+
+        -- 2. Veriyi Telemetry Tablosuna Yaz
+        IF boat_uuid IS NOT NULL THEN
+            INSERT INTO public.telemetry (
+                boat_id,
+                voltage, current, temperature, alarm, device_type,
+                soc, power, pv_voltage, pv_current, pv_power,
+                load_current, load_state, device_state, charge_state,
+                yield_today, total_yield, max_pv_voltage, max_pv_power,
+                min_battery_voltage, max_battery_voltage,
+                consumed_ah, remaining_mins, efficiency, aux_voltage,
+                interval_stats, created_at
+            )
+            VALUES (
+                boat_uuid,
+                (measurement->>'voltage')::NUMERIC,
+                (measurement->>'current')::NUMERIC,
+                (measurement->>'temperature')::NUMERIC,
+                (measurement->>'alarm')::INTEGER,
+                (measurement->>'device_type')::INTEGER,
+                (measurement->>'soc')::NUMERIC,
+                (measurement->>'power')::NUMERIC,
+                (measurement->>'pv_voltage')::NUMERIC,
+                (measurement->>'pv_current')::NUMERIC,
+                (measurement->>'pv_power')::NUMERIC,
+                (measurement->>'load_current')::NUMERIC,
+                (measurement->>'load_state')::INTEGER,
+                (measurement->>'device_state')::INTEGER,
+                (measurement->>'charge_state'),
+                (measurement->>'yield_today')::NUMERIC,
+                (measurement->>'total_yield')::NUMERIC,
+                (measurement->>'max_pv_voltage')::NUMERIC,
+                (measurement->>'max_pv_power')::NUMERIC,
+                (measurement->>'min_battery_voltage')::NUMERIC,
+                (measurement->>'max_battery_voltage')::NUMERIC,
+                (measurement->>'consumed_ah')::NUMERIC,
+                (measurement->>'remaining_mins')::NUMERIC,
+                (measurement->>'efficiency')::NUMERIC,
+                (measurement->>'aux_voltage')::NUMERIC,
+                measurement->'interval_stats',
+                -- Flash kuyruğundan gecikmeli gelen ölçüm: age_s saniye önce alındı
+                CASE WHEN measurement ? 'age_s'
+                     THEN NOW() - make_interval(secs => (measurement->>'age_s')::NUMERIC)
+                     ELSE NOW() END
+            );
+        END IF;
+    END LOOP;
+
+    RETURN jsonb_build_object('status', 'success', 'message', 'Telemetry ingested');
+END;
+$$;
@@ -76,8 +76,11 @@ create table if not exists telemetry (
   max_pv_voltage numeric,
   max_pv_power numeric,
   min_battery_voltage numeric,
-  max_battery_voltage numeric
+  max_battery_voltage numeric,
+  interval_stats jsonb
 );
+-- Tablo önceki sürümle oluşturulduysa
+alter table telemetry add column if not exists interval_stats jsonb;
 
 -- 4. PERMISSIONS
 GRANT ALL ON TABLE boats TO anon, authenticated, service_role;
@@ -188,7 +191,12 @@ BEGIN
             consumed_ah,
             remaining_mins,
             aux_voltage,
-            load_state
+            load_state,
+            min_battery_voltage,
+            max_battery_voltage,
+            max_pv_power,
+            interval_stats,
+            created_at
         ) VALUES (
             v_boat_id,
             item->>'mac_address',
@@ -208,7 +216,16 @@ BEGIN
             (item->>'consumed_ah')::numeric,
             (item->>'remaining_mins')::numeric,
             (item->>'aux_voltage')::numeric,
-            (item->>'load_state')::int
+            (item->>'load_state')::int,
+            -- Aralık istatistikleri; eski firmware göndermez
+            (item->>'min_battery_voltage')::numeric,
+            (item->>'max_battery_voltage')::numeric,
+            (item->>'max_pv_power')::numeric,
+            item->'interval_stats',
+            -- Flash kuyruğundan gecikmeli gelen ölçüm: age_s saniye önce alındı
+            CASE WHEN item ? 'age_s'
+                 THEN NOW() - make_interval(secs => (item->>'age_s')::numeric)
+                 ELSE NOW() END
         );
         v_count := v_count + 1;
     END IF;
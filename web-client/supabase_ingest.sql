@@ -1,5 +1,6 @@
 -- Bu fonksiyon ESP32'den gelen verileri alıp telemetry tablosuna kaydeder.
 -- Firmware kodu bu fonksiyonu RPC olarak çağırıyor.
+-- Aralık kolonları için önce database/update_schema_v3.sql çalıştırılmalı.
 
 CREATE OR REPLACE FUNCTION ingest_telemetry(payload jsonb)
 RETURNS jsonb
@@ -52,7 +53,12 @@ BEGIN
             consumed_ah,
             remaining_mins,
             aux_voltage,
-            load_state
+            load_state,
+            min_battery_voltage,
+            max_battery_voltage,
+            max_pv_power,
+            interval_stats,
+            created_at
         ) VALUES (
             v_boat_id,
             item->>'mac_address',
@@ -72,7 +78,16 @@ BEGIN
             (item->>'consumed_ah')::numeric,
             (item->>'remaining_mins')::numeric,
             (item->>'aux_voltage')::numeric,
-            (item->>'load_state')::int
+            (item->>'load_state')::int,
+            -- Aralık istatistikleri (update_schema_v3.sql); eski firmware göndermez
+            (item->>'min_battery_voltage')::numeric,
+            (item->>'max_battery_voltage')::numeric,
+            (item->>'max_pv_power')::numeric,
+            item->'interval_stats',
+            -- Flash kuyruğundan gecikmeli gelen ölçüm: age_s saniye önce alındı
+            CASE WHEN item ? 'age_s'
+                 THEN NOW() - make_interval(secs => (item->>'age_s')::numeric)
+                 ELSE NOW() END
         );
         
         v_count := v_count + 1;